@@ -31,6 +31,7 @@
 #include <hpx/parallel/algorithms/lexicographical_compare.hpp>
 #include <hpx/parallel/algorithms/make_heap.hpp>
 #include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/merge_k.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/mismatch.hpp>
 #include <hpx/parallel/algorithms/move.hpp>
@@ -56,6 +57,7 @@
 // Parallelism TS V2
 #include <hpx/parallel/algorithms/ends_with.hpp>
 #include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/algorithms/for_loop_nd.hpp>
 #include <hpx/parallel/algorithms/shift_left.hpp>
 #include <hpx/parallel/algorithms/shift_right.hpp>
 #include <hpx/parallel/algorithms/starts_with.hpp>
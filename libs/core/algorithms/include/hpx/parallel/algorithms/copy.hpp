@@ -521,7 +521,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             parallel(ExPolicy&& policy, FwdIter1 first, FwdIter2 last,
                 FwdIter3 dest, Pred&& pred, Proj&& proj /* = Proj()*/)
             {
-                typedef hpx::util::zip_iterator<FwdIter1, bool*> zip_iterator;
                 typedef util::detail::algorithm_result<ExPolicy,
                     util::in_out_result<FwdIter1, FwdIter3>>
                     result;
@@ -536,6 +535,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 difference_type count = detail::distance(first, last);
 
+                // The flags are written only for the partitions which have
+                // to be counted before their output position is known, and
+                // are read back when these partitions are copied. This way
+                // the predicate is evaluated exactly once for each element.
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
                 std::shared_ptr<bool[]> flags(new bool[count]);
 #else
@@ -545,20 +548,19 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
+                typedef hpx::util::zip_iterator<FwdIter1, bool*> zip_iterator;
                 typedef util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter3>, std::size_t>
+                    util::in_out_result<FwdIter1, FwdIter3>, std::size_t, void,
+                    util::scan_partitioner_single_pass_tag>
                     scan_partitioner_type;
 
-                auto f1 = [pred = HPX_FORWARD(Pred, pred),
-                              proj = HPX_FORWARD(decltype(proj), proj)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) -> std::size_t {
+                auto f1 = [pred, proj](zip_iterator part_begin,
+                              std::size_t part_size) mutable -> std::size_t {
                     std::size_t curr = 0;
 
                     // Note: replacing the invoke() with HPX_INVOKE()
-                    // below makes gcc generate errors
-
-                    // MSVC complains if proj is captured by ref below
+                    // below makes gcc generate errors, MSVC complains if
+                    // proj is captured by ref below
                     util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
                         [&pred, proj, &curr](zip_iterator it) mutable -> void {
                             bool f = hpx::util::invoke(
@@ -570,15 +572,38 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                     return curr;
                 };
-                auto f3 = [dest, flags](zip_iterator part_begin,
-                              std::size_t part_size, std::size_t val) mutable {
+                auto f3 = [dest, flags, pred = HPX_FORWARD(Pred, pred),
+                              proj = HPX_FORWARD(Proj, proj)](
+                              zip_iterator part_begin, std::size_t part_size,
+                              std::size_t val,
+                              bool counted) mutable -> std::size_t {
                     HPX_UNUSED(flags);
-                    std::advance(dest, val);
+
+                    FwdIter3 out = dest;
+                    std::advance(out, val);
+                    if (counted)
+                    {
+                        util::loop_n<std::decay_t<ExPolicy>>(part_begin,
+                            part_size, [&out, &val](zip_iterator it) mutable {
+                                if (get<1>(*it))
+                                {
+                                    *out++ = get<0>(*it);
+                                    ++val;
+                                }
+                            });
+                        return val;
+                    }
+
                     util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&dest](zip_iterator it) mutable {
-                            if (get<1>(*it))
-                                *dest++ = get<0>(*it);
+                        [&pred, proj, &out, &val](zip_iterator it) mutable {
+                            if (hpx::util::invoke(
+                                    pred, hpx::util::invoke(proj, get<0>(*it))))
+                            {
+                                *out++ = get<0>(*it);
+                                ++val;
+                            }
                         });
+                    return val;
                 };
 
                 auto f4 = [first, dest, flags](std::vector<std::size_t>&& items,
@@ -601,12 +626,13 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return scan_partitioner_type::call(
                     HPX_FORWARD(ExPolicy, policy),
                     make_zip_iterator(first, flags.get()), count, init,
-                    // step 1 performs first part of scan algorithm
+                    // step 1 counts the elements of a partition if its
+                    // offset is not known yet
                     HPX_MOVE(f1),
                     // step 2 propagates the partition results from left
                     // to right
                     std::plus<std::size_t>(),
-                    // step 3 runs final accumulation on each partition
+                    // step 3 copies the elements of each partition
                     HPX_MOVE(f3),
                     // step 4 use this return value
                     HPX_MOVE(f4));
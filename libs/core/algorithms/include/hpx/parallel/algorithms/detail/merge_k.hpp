@@ -0,0 +1,363 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // minimal number of output elements merged by one task
+    static constexpr std::size_t merge_k_limit_per_task = 1 << 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The order in which the elements of k sorted runs appear in their stable
+    // merge: elements are ordered by value, equivalent elements by the index
+    // of their run and then by their position in it. Returns whether the
+    // element x of the run i precedes the element y of the run j.
+    template <typename Comp, typename T1, typename T2>
+    bool merge_k_precedes(
+        Comp& comp, std::size_t i, T1 const& x, std::size_t j, T2 const& y)
+    {
+        return i < j ? !HPX_INVOKE(comp, y, x) : HPX_INVOKE(comp, x, y);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A loser tree holds the runs at its leaves and the loser of the match
+    // played at each of its inner nodes. Replacing the overall winner needs
+    // to replay the matches on the path to the root only, which takes
+    // ceil(log2(k)) comparisons per merged element.
+    template <typename Iter, typename Comp>
+    class merge_k_loser_tree
+    {
+    public:
+        merge_k_loser_tree(std::vector<util::range<Iter>> const& runs,
+            Comp& comp)
+          : comp_(comp)
+          , k_(runs.size())
+          , tree_(k_, 0)
+        {
+            heads_.reserve(k_);
+            ends_.reserve(k_);
+            for (auto const& run : runs)
+            {
+                heads_.push_back(run.begin());
+                ends_.push_back(run.end());
+            }
+
+            if (k_ > 1)
+            {
+                tree_[0] = build(1);
+            }
+        }
+
+        // Moves the next count elements of the merge to dest, emit(dest, it)
+        // transfers a single element.
+        template <typename OutIter, typename Emit>
+        OutIter merge(OutIter dest, std::size_t count, Emit& emit)
+        {
+            for (/**/; count != 0; (void) --count, ++dest)
+            {
+                std::size_t winner = tree_[0];
+                HPX_ASSERT(heads_[winner] != ends_[winner]);
+
+                emit(dest, heads_[winner]);
+                ++heads_[winner];
+
+                // replay the matches of the winner's run up to the root
+                for (std::size_t node = (winner + k_) / 2; node != 0;
+                     node /= 2)
+                {
+                    if (precedes(tree_[node], winner))
+                    {
+                        std::swap(tree_[node], winner);
+                    }
+                }
+                tree_[0] = winner;
+            }
+            return dest;
+        }
+
+    private:
+        // an exhausted run loses against all others
+        bool precedes(std::size_t i, std::size_t j) const
+        {
+            if (heads_[i] == ends_[i])
+                return false;
+            if (heads_[j] == ends_[j])
+                return true;
+            return merge_k_precedes(comp_, i, *heads_[i], j, *heads_[j]);
+        }
+
+        // The inner nodes are 1 ... k - 1, the leaves are k ... 2k - 1, the
+        // children of the node n are 2n and 2n + 1.
+        std::size_t build(std::size_t node)
+        {
+            if (node >= k_)
+            {
+                return node - k_;
+            }
+
+            std::size_t left = build(2 * node);
+            std::size_t right = build(2 * node + 1);
+            if (precedes(left, right))
+            {
+                tree_[node] = right;
+                return left;
+            }
+            tree_[node] = left;
+            return right;
+        }
+
+        Comp& comp_;
+        std::size_t k_;
+        std::vector<Iter> heads_;
+        std::vector<Iter> ends_;
+        std::vector<std::size_t> tree_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Multi-sequence selection: computes for each of the sorted runs the
+    // number of its elements among the first rank elements of their stable
+    // merge.
+    //
+    // The split position of each run is known to lie in a window which
+    // initially covers the whole run. Each round ranks the weighted median
+    // of the middle elements of all windows by a binary search in every run
+    // and shrinks the windows to the side of it holding the split, which
+    // discards at least a quarter of the elements left in all windows.
+    template <typename Iter, typename Comp>
+    std::vector<std::size_t> merge_k_select(
+        std::vector<util::range<Iter>> const& runs, std::size_t rank,
+        Comp& comp)
+    {
+        std::size_t const k = runs.size();
+
+        std::vector<std::size_t> lower(k, 0);
+        std::vector<std::size_t> upper(k);
+        std::size_t total = 0;
+        for (std::size_t i = 0; i != k; ++i)
+        {
+            upper[i] = runs[i].size();
+            total += upper[i];
+        }
+
+        HPX_ASSERT(rank <= total);
+        if (rank == 0)
+        {
+            return lower;
+        }
+        if (rank == total)
+        {
+            return upper;
+        }
+
+        auto element = [&](std::size_t i, std::size_t pos) -> decltype(auto) {
+            return *std::next(runs[i].begin(), pos);
+        };
+
+        std::vector<std::size_t> candidates;
+        candidates.reserve(k);
+        std::vector<std::size_t> counts(k);
+
+        while (true)
+        {
+            std::size_t window = 0;
+            candidates.clear();
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                if (lower[i] != upper[i])
+                {
+                    candidates.push_back(i);
+                    window += upper[i] - lower[i];
+                }
+            }
+
+            if (candidates.empty())
+            {
+                break;
+            }
+
+            auto middle = [&](std::size_t i) {
+                return lower[i] + (upper[i] - lower[i]) / 2;
+            };
+
+            std::sort(candidates.begin(), candidates.end(),
+                [&](std::size_t i, std::size_t j) {
+                    return merge_k_precedes(comp, i, element(i, middle(i)), j,
+                        element(j, middle(j)));
+                });
+
+            // the weighted median of the middle elements of all windows
+            std::size_t pivot = candidates.back();
+            std::size_t weight = 0;
+            for (std::size_t i : candidates)
+            {
+                weight += upper[i] - lower[i];
+                if (2 * weight >= window)
+                {
+                    pivot = i;
+                    break;
+                }
+            }
+
+            std::size_t const pivot_pos = middle(pivot);
+            auto const& value = element(pivot, pivot_pos);
+
+            // the number of elements preceding the pivot in each run
+            std::size_t pivot_rank = 0;
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                if (i == pivot)
+                {
+                    counts[i] = pivot_pos;
+                }
+                else if (i < pivot)
+                {
+                    counts[i] = std::distance(runs[i].begin(),
+                        std::upper_bound(runs[i].begin(), runs[i].end(), value,
+                            [&](auto const& x, auto const& y) {
+                                return HPX_INVOKE(comp, x, y);
+                            }));
+                }
+                else
+                {
+                    counts[i] = std::distance(runs[i].begin(),
+                        std::lower_bound(runs[i].begin(), runs[i].end(), value,
+                            [&](auto const& x, auto const& y) {
+                                return HPX_INVOKE(comp, x, y);
+                            }));
+                }
+                pivot_rank += counts[i];
+            }
+
+            if (pivot_rank < rank)
+            {
+                // the pivot and all elements preceding it are selected
+                for (std::size_t i = 0; i != k; ++i)
+                {
+                    lower[i] = (std::max)(lower[i], counts[i]);
+                }
+                lower[pivot] = pivot_pos + 1;
+            }
+            else
+            {
+                // neither the pivot nor any element following it is
+                for (std::size_t i = 0; i != k; ++i)
+                {
+                    upper[i] = (std::min)(upper[i], counts[i]);
+                }
+            }
+        }
+        return lower;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename OutIter, typename Comp, typename Emit>
+    OutIter sequential_merge_k(std::vector<util::range<Iter>> const& runs,
+        OutIter dest, std::size_t count, Comp& comp, Emit& emit)
+    {
+        if (runs.size() == 1)
+        {
+            for (Iter it = runs[0].begin(); count != 0;
+                 (void) --count, ++it, ++dest)
+            {
+                emit(dest, it);
+            }
+            return dest;
+        }
+
+        merge_k_loser_tree<Iter, Comp> tree(runs, comp);
+        return tree.merge(dest, count, emit);
+    }
+
+    // Merges the sorted runs into dest. The output is split into parts of
+    // the same length by multi-sequence selection, the parts are merged
+    // concurrently. Exceptions are reported the same way as by the
+    // partitioners.
+    template <typename ExPolicy, typename Iter, typename OutIter,
+        typename Comp, typename Emit>
+    OutIter merge_k_runs(ExPolicy&& policy,
+        std::vector<util::range<Iter>> const& runs, OutIter dest, Comp& comp,
+        Emit&& emit)
+    {
+        std::size_t total = 0;
+        for (auto const& run : runs)
+        {
+            total += run.size();
+        }
+
+        std::size_t num_parts = 1;
+        if constexpr (!hpx::is_sequenced_execution_policy_v<ExPolicy>)
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            num_parts = (std::min)(cores, total / merge_k_limit_per_task);
+        }
+
+        if (num_parts <= 1)
+        {
+            return sequential_merge_k(runs, dest, total, comp, emit);
+        }
+
+        // each part selects both of its boundaries itself, which avoids
+        // synchronizing with its neighbors
+        auto merge_part = [&](std::size_t part) {
+            std::size_t const first = total * part / num_parts;
+            std::size_t const last = total * (part + 1) / num_parts;
+
+            std::vector<std::size_t> lower = merge_k_select(runs, first, comp);
+            std::vector<std::size_t> upper = merge_k_select(runs, last, comp);
+
+            std::vector<util::range<Iter>> parts;
+            parts.reserve(runs.size());
+            for (std::size_t i = 0; i != runs.size(); ++i)
+            {
+                if (lower[i] != upper[i])
+                {
+                    parts.emplace_back(std::next(runs[i].begin(), lower[i]),
+                        std::next(runs[i].begin(), upper[i]));
+                }
+            }
+
+            sequential_merge_k(
+                parts, std::next(dest, first), last - first, comp, emit);
+        };
+
+        auto shape = hpx::util::make_iterator_range(
+            hpx::util::make_counting_iterator(std::size_t(0)),
+            hpx::util::make_counting_iterator(num_parts));
+
+        auto workitems =
+            execution::bulk_async_execute(policy.executor(), merge_part, shape);
+        hpx::wait_all_nothrow(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<std::decay_t<ExPolicy>>::call(
+            workitems, errors);
+
+        return std::next(dest, total);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
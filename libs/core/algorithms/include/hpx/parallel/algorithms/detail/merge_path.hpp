@@ -0,0 +1,60 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Merge path: the merge of two sorted sequences of the lengths len1 and
+    // len2 is a monotonic path through a len1 x len2 grid. Each diagonal
+    // (the set of positions with the same number of elements merged so far)
+    // is crossed exactly once, its crossing point can be found using a
+    // binary search along the diagonal. Splitting the merge at evenly
+    // spaced diagonals yields partitions of exactly the same output length,
+    // regardless of the distribution of the input elements.
+    //
+    // Returns the number of elements of [first1, first1 + len1) among the
+    // first diag elements of the merged sequence, the remaining
+    // diag - result elements are taken from [first2, first2 + len2). The
+    // elements of the first sequence precede equivalent elements of the
+    // second one, as for a stable merge.
+    template <typename Iter1, typename Iter2, typename Comp, typename Proj1,
+        typename Proj2>
+    std::size_t merge_path_search(Iter1 first1, std::size_t len1,
+        Iter2 first2, std::size_t len2, std::size_t diag, Comp&& comp,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        HPX_ASSERT(diag <= len1 + len2);
+
+        std::size_t low = diag > len2 ? diag - len2 : 0;
+        std::size_t high = (std::min)(diag, len1);
+
+        while (low < high)
+        {
+            std::size_t mid = low + (high - low) / 2;
+            if (HPX_INVOKE(comp,
+                    HPX_INVOKE(proj2, *std::next(first2, diag - mid - 1)),
+                    HPX_INVOKE(proj1, *std::next(first1, mid))))
+            {
+                high = mid;
+            }
+            else
+            {
+                low = mid + 1;
+            }
+        }
+        return low;
+    }
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,286 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/algorithms/traits/is_value_proxy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // provide implementation of std::min_element supporting
+    // iterators/sentinels, returns the first smallest element
+    template <typename ExPolicy>
+    struct sequential_min_element_t
+      : hpx::functional::detail::tag_fallback<
+            sequential_min_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename Sent, typename F, typename Proj>
+        friend inline constexpr FwdIter tag_fallback_invoke(
+            sequential_min_element_t<ExPolicy>, FwdIter first, Sent last,
+            F const& f, Proj const& proj)
+        {
+            if (first == last)
+                return first;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto smallest = first;
+
+            element_type value = HPX_INVOKE(proj, *smallest);
+            for (++first; first != last; ++first)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *first);
+                if (HPX_INVOKE(f, curr_value, value))
+                {
+                    smallest = first;
+                    value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return smallest;
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline constexpr FwdIter tag_fallback_invoke(
+            sequential_min_element_t<ExPolicy>, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto smallest = it;
+
+            element_type value = HPX_INVOKE(proj, *smallest);
+            for (++it; --count != 0; ++it)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *it);
+                if (HPX_INVOKE(f, curr_value, value))
+                {
+                    smallest = it;
+                    value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return smallest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_min_element_t<ExPolicy> sequential_min_element =
+        sequential_min_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj>
+    inline constexpr FwdIter sequential_min_element(
+        FwdIter first, Sent last, F const& f, Proj const& proj)
+    {
+        return sequential_min_element_t<ExPolicy>{}(first, last, f, proj);
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline constexpr FwdIter sequential_min_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_min_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+#endif
+
+    // provide implementation of std::max_element supporting
+    // iterators/sentinels, returns the last largest element
+    template <typename ExPolicy>
+    struct sequential_max_element_t
+      : hpx::functional::detail::tag_fallback<
+            sequential_max_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename Sent, typename F, typename Proj>
+        friend inline constexpr FwdIter tag_fallback_invoke(
+            sequential_max_element_t<ExPolicy>, FwdIter first, Sent last,
+            F const& f, Proj const& proj)
+        {
+            if (first == last)
+                return first;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto largest = first;
+
+            element_type value = HPX_INVOKE(proj, *largest);
+            for (++first; first != last; ++first)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *first);
+                if (!HPX_INVOKE(f, curr_value, value))
+                {
+                    largest = first;
+                    value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return largest;
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline constexpr FwdIter tag_fallback_invoke(
+            sequential_max_element_t<ExPolicy>, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto largest = it;
+
+            element_type value = HPX_INVOKE(proj, *largest);
+            for (++it; --count != 0; ++it)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *it);
+                if (!HPX_INVOKE(f, curr_value, value))
+                {
+                    largest = it;
+                    value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return largest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_max_element_t<ExPolicy> sequential_max_element =
+        sequential_max_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj>
+    inline constexpr FwdIter sequential_max_element(
+        FwdIter first, Sent last, F const& f, Proj const& proj)
+    {
+        return sequential_max_element_t<ExPolicy>{}(first, last, f, proj);
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline constexpr FwdIter sequential_max_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_max_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+#endif
+
+    // provide implementation of std::minmax_element supporting
+    // iterators/sentinels
+    template <typename ExPolicy>
+    struct sequential_minmax_element_t
+      : hpx::functional::detail::tag_fallback<
+            sequential_minmax_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename Sent, typename F, typename Proj>
+        friend inline constexpr util::min_max_result<FwdIter>
+        tag_fallback_invoke(sequential_minmax_element_t<ExPolicy>,
+            FwdIter first, Sent last, F const& f, Proj const& proj)
+        {
+            util::min_max_result<FwdIter> result = {first, first};
+
+            if (first == last || ++first == last)
+                return result;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            element_type min_value = HPX_INVOKE(proj, *result.min);
+            element_type max_value = min_value;
+            for (/**/; first != last; ++first)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *first);
+                if (HPX_INVOKE(f, curr_value, min_value))
+                {
+                    result.min = first;
+                    min_value = curr_value;
+                }
+
+                if (!HPX_INVOKE(f, curr_value, max_value))
+                {
+                    result.max = first;
+                    max_value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return result;
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline constexpr util::min_max_result<FwdIter>
+        tag_fallback_invoke(sequential_minmax_element_t<ExPolicy>, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            util::min_max_result<FwdIter> result = {it, it};
+
+            if (count == 0 || count == 1)
+                return result;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            element_type min_value = HPX_INVOKE(proj, *it);
+            element_type max_value = min_value;
+            for (++it; --count != 0; ++it)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *it);
+                if (HPX_INVOKE(f, curr_value, min_value))
+                {
+                    result.min = it;
+                    min_value = curr_value;
+                }
+
+                if (!HPX_INVOKE(f, curr_value, max_value))
+                {
+                    result.max = it;
+                    max_value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return result;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_minmax_element_t<ExPolicy>
+        sequential_minmax_element = sequential_minmax_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj>
+    inline constexpr util::min_max_result<FwdIter> sequential_minmax_element(
+        FwdIter first, Sent last, F const& f, Proj const& proj)
+    {
+        return sequential_minmax_element_t<ExPolicy>{}(first, last, f, proj);
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline constexpr util::min_max_result<FwdIter> sequential_minmax_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_minmax_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,167 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // provide implementation of std::mismatch supporting iterators/sentinels
+    template <typename ExPolicy>
+    struct sequential_mismatch_t
+      : hpx::functional::detail::tag_fallback<sequential_mismatch_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Sent1, typename Iter2, typename F,
+            typename Proj1, typename Proj2>
+        friend inline constexpr util::in_in_result<Iter1, Iter2>
+        tag_fallback_invoke(sequential_mismatch_t<ExPolicy>, Iter1 first1,
+            Sent1 last1, Iter2 first2, F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            while (first1 != last1 &&
+                HPX_INVOKE(
+                    f, HPX_INVOKE(proj1, *first1), HPX_INVOKE(proj2, *first2)))
+            {
+                (void) ++first1, ++first2;
+            }
+            return {first1, first2};
+        }
+
+        template <typename Iter1, typename Sent1, typename Iter2,
+            typename Sent2, typename F, typename Proj1, typename Proj2>
+        friend inline constexpr util::in_in_result<Iter1, Iter2>
+        tag_fallback_invoke(sequential_mismatch_t<ExPolicy>, Iter1 first1,
+            Sent1 last1, Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1,
+            Proj2&& proj2)
+        {
+            while (first1 != last1 && first2 != last2 &&
+                HPX_INVOKE(
+                    f, HPX_INVOKE(proj1, *first1), HPX_INVOKE(proj2, *first2)))
+            {
+                (void) ++first1, ++first2;
+            }
+            return {first1, first2};
+        }
+
+        // cancels the token with the index of the first mismatch in the
+        // given partition
+        template <typename ZipIter, typename Token, typename F, typename Proj1,
+            typename Proj2>
+        friend inline constexpr void tag_fallback_invoke(
+            sequential_mismatch_t<ExPolicy>, std::size_t base_idx,
+            ZipIter part_begin, std::size_t part_count, Token& tok, F&& f,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            using reference = typename ZipIter::reference;
+
+            // Note: replacing the invoke() with HPX_INVOKE()
+            // below makes gcc generate errors
+            util::loop_idx_n<ExPolicy>(base_idx, part_begin, part_count, tok,
+                [&f, &proj1, &proj2, &tok](
+                    reference t, std::size_t i) mutable -> void {
+                    if (!hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_mismatch_t<ExPolicy> sequential_mismatch =
+        sequential_mismatch_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
+        typename F, typename Proj1, typename Proj2>
+    inline constexpr util::in_in_result<Iter1, Iter2> sequential_mismatch(
+        Iter1 first1, Sent1 last1, Iter2 first2, F&& f, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        return sequential_mismatch_t<ExPolicy>{}(first1, last1, first2,
+            HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+            HPX_FORWARD(Proj2, proj2));
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
+        typename Sent2, typename F, typename Proj1, typename Proj2>
+    inline constexpr util::in_in_result<Iter1, Iter2> sequential_mismatch(
+        Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        return sequential_mismatch_t<ExPolicy>{}(first1, last1, first2, last2,
+            HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+            HPX_FORWARD(Proj2, proj2));
+    }
+
+    template <typename ExPolicy, typename ZipIter, typename Token, typename F,
+        typename Proj1, typename Proj2>
+    inline constexpr void sequential_mismatch(std::size_t base_idx,
+        ZipIter part_begin, std::size_t part_count, Token& tok, F&& f,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        return sequential_mismatch_t<ExPolicy>{}(base_idx, part_begin,
+            part_count, tok, HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+            HPX_FORWARD(Proj2, proj2));
+    }
+#endif
+
+    // cancels the token if the given partitions of the two sequences differ
+    template <typename ExPolicy>
+    struct sequential_equal_t
+      : hpx::functional::detail::tag_fallback<sequential_equal_t<ExPolicy>>
+    {
+    private:
+        template <typename ZipIter, typename Token, typename F, typename Proj1,
+            typename Proj2>
+        friend inline constexpr void tag_fallback_invoke(
+            sequential_equal_t<ExPolicy>, ZipIter part_begin,
+            std::size_t part_count, Token& tok, F&& f, Proj1&& proj1,
+            Proj2&& proj2)
+        {
+            using reference = typename ZipIter::reference;
+
+            util::loop_n<ExPolicy>(part_begin, part_count, tok,
+                [&f, &proj1, &proj2, &tok](ZipIter const& curr) -> void {
+                    reference t = *curr;
+                    if (!hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel();
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_equal_t<ExPolicy> sequential_equal =
+        sequential_equal_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename ZipIter, typename Token, typename F,
+        typename Proj1, typename Proj2>
+    inline constexpr void sequential_equal(ZipIter part_begin,
+        std::size_t part_count, Token& tok, F&& f, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        return sequential_equal_t<ExPolicy>{}(part_begin, part_count, tok,
+            HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+            HPX_FORWARD(Proj2, proj2));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
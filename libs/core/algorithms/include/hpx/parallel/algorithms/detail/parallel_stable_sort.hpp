@@ -11,16 +11,26 @@
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/executors/exception_list.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/parallel/algorithms/detail/merge_k.hpp>
 #include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/algorithms/detail/spin_sort.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/low_level.hpp>
+#include <hpx/parallel/util/range.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <list>
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -30,6 +40,11 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
     static constexpr std::size_t stable_sort_limit_per_task = 1 << 16;
 
+    // bounds of the number of runs sorted independently and merged at once by
+    // parallel_stable_sort_runs
+    static constexpr std::size_t stable_sort_min_runs = 64;
+    static constexpr std::size_t stable_sort_max_runs = 256;
+
     /// \struct parallel_stable_sort
     /// \brief This a structure for to implement a parallel stable sort
     ///        exception safe
@@ -168,4 +183,82 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             compare{});
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Sorts large inputs as one run per task: the runs are moved to a
+    // temporary buffer and sorted there independently, their k-way merge
+    // moves the elements back. Unlike the recursive merging of
+    // parallel_stable_sort_helper, the elements are moved twice only,
+    // regardless of the number of runs.
+    template <typename ExPolicy, typename Iter, typename Compare>
+    Iter parallel_stable_sort_runs(
+        ExPolicy&& policy, Iter first, std::size_t count, Compare&& comp)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        std::size_t const num_runs = (std::min)(
+            count / stable_sort_limit_per_task, stable_sort_max_runs);
+        HPX_ASSERT(num_runs != 0);
+
+        // leave memory uninitialized, the runs are constructed when moved
+        // to the buffer and destroyed after they have been merged
+        struct buffer
+        {
+            ~buffer()
+            {
+                for (std::size_t i = 0; i != runs.size(); ++i)
+                {
+                    if (constructed[i])
+                    {
+                        util::destroy(runs[i].begin(), runs[i].end());
+                    }
+                }
+                std::free(ptr);
+            }
+
+            value_type* ptr = nullptr;
+            std::vector<util::range<value_type*>> runs;
+            std::vector<char> constructed;
+        };
+
+        buffer buf;
+        buf.ptr =
+            static_cast<value_type*>(std::malloc(sizeof(value_type) * count));
+        if (buf.ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        buf.runs.reserve(num_runs);
+        for (std::size_t i = 0; i != num_runs; ++i)
+        {
+            buf.runs.emplace_back(buf.ptr + count * i / num_runs,
+                buf.ptr + count * (i + 1) / num_runs);
+        }
+        buf.constructed.resize(num_runs, 0);
+
+        auto sort_run = [&](std::size_t i) {
+            util::range<value_type*> const& run = buf.runs[i];
+            util::uninit_move(run.begin(),
+                std::next(first, run.begin() - buf.ptr),
+                std::next(first, run.end() - buf.ptr));
+            buf.constructed[i] = 1;
+
+            spin_sort(run.begin(), run.end(), comp);
+        };
+
+        auto shape = hpx::util::make_iterator_range(
+            hpx::util::make_counting_iterator(std::size_t(0)),
+            hpx::util::make_counting_iterator(num_runs));
+
+        auto workitems =
+            execution::bulk_async_execute(policy.executor(), sort_run, shape);
+        hpx::wait_all_nothrow(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<std::decay_t<ExPolicy>>::call(
+            workitems, errors);
+
+        return merge_k_runs(HPX_FORWARD(ExPolicy, policy), buf.runs, first,
+            comp, [](Iter& dest, value_type*& it) { *dest = HPX_MOVE(*it); });
+    }
 }}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,365 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // Sequences shorter than this are sorted using comparisons, the radix
+    // sort does not pay off for those.
+    static constexpr std::size_t radix_sort_limit = 4096;
+
+    // Minimal number of elements each task handles during a radix sort pass.
+    static constexpr std::size_t radix_sort_limit_per_task = 65536;
+
+    // Number of bits sorted by each pass.
+    static constexpr std::size_t radix_sort_bits = 8;
+    static constexpr std::size_t radix_sort_buckets = 1 << radix_sort_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map keys onto unsigned integers which compare the same way as the keys
+    // compare using operator<().
+    template <typename T, typename Enable = void>
+    struct radix_sort_key
+    {
+        static constexpr bool value = false;
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr bool value = true;
+        using type = std::make_unsigned_t<T>;
+
+        static constexpr type encode(T key) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                // negative values go before all positive values
+                return type(key) ^ (type(1) << (sizeof(T) * CHAR_BIT - 1));
+            }
+            else
+            {
+                return type(key);
+            }
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        static constexpr bool value = true;
+        using type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static type encode(T key) noexcept
+        {
+            // -0.0 and 0.0 compare equal, stable sorts have to keep their
+            // relative order
+            if (key == T(0))
+            {
+                key = T(0);
+            }
+
+            type bits;
+            std::memcpy(&bits, &key, sizeof(T));
+
+            // negative values are ordered by decreasing magnitude
+            constexpr type sign_bit = type(1) << (sizeof(T) * CHAR_BIT - 1);
+            return (bits & sign_bit) ? type(~bits) : type(bits | sign_bit);
+        }
+    };
+
+    template <typename Compare, typename T>
+    struct is_radix_sort_compare : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_compare<less, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_compare<std::less<T>, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_compare<std::less<>, T> : std::true_type
+    {
+    };
+
+    // The radix sort is used for contiguous sequences of integral or floating
+    // point keys which are sorted in ascending order without a projection.
+    template <typename Iter, typename Compare, typename Proj>
+    inline constexpr bool is_radix_sortable_v =
+        hpx::traits::is_contiguous_iterator_v<Iter> &&
+        std::is_same_v<std::decay_t<Proj>, util::projection_identity> &&
+        radix_sort_key<hpx::traits::iter_value_t<Iter>>::value &&
+        is_radix_sort_compare<std::decay_t<Compare>,
+            hpx::traits::iter_value_t<Iter>>::value;
+
+    // The values moved along with the keys are kept in a scratch buffer as
+    // well, moving them must not throw.
+    template <typename KeyIter, typename ValueIter, typename Compare>
+    inline constexpr bool is_radix_sortable_by_key_v =
+        is_radix_sortable_v<KeyIter, Compare, util::projection_identity> &&
+        hpx::traits::is_contiguous_iterator_v<ValueIter> &&
+        std::is_default_constructible_v<
+            hpx::traits::iter_value_t<ValueIter>> &&
+        std::is_nothrow_move_assignable_v<
+            hpx::traits::iter_value_t<ValueIter>>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Placeholder for the values if only keys are sorted.
+    struct radix_sort_no_values
+    {
+        using value_type = char;
+    };
+
+    template <typename ValueIter>
+    struct radix_sort_value
+    {
+        using type = hpx::traits::iter_value_t<ValueIter>;
+    };
+
+    template <>
+    struct radix_sort_value<radix_sort_no_values>
+    {
+        using type = radix_sort_no_values::value_type;
+    };
+
+    using radix_sort_histogram = std::array<std::size_t, radix_sort_buckets>;
+
+    template <typename Key>
+    HPX_FORCEINLINE std::size_t radix_sort_digit(
+        Key key, std::size_t shift) noexcept
+    {
+        return std::size_t((radix_sort_key<Key>::encode(key) >> shift) &
+            (radix_sort_buckets - 1));
+    }
+
+    // Invoke f for each chunk, the chunks are run concurrently if there is
+    // more than one.
+    template <typename ExPolicy, typename F>
+    void radix_sort_for_each_chunk(
+        ExPolicy& policy, std::size_t num_chunks, F&& f)
+    {
+        if (num_chunks == 1)
+        {
+            f(std::size_t(0));
+            return;
+        }
+
+        auto shape = hpx::util::make_iterator_range(
+            hpx::util::make_counting_iterator(std::size_t(0)),
+            hpx::util::make_counting_iterator(num_chunks));
+
+        hpx::when_all(
+            execution::bulk_async_execute(policy.executor(), f, shape))
+            .get();
+    }
+
+    // Move the elements from [key_src, key_src + count) to key_dst ordered by
+    // the digit at the given shift, keeping the relative order of elements
+    // with the same digit. Each chunk counts its digits first, the exclusive
+    // prefix sum over (digit, chunk) gives the position each chunk scatters
+    // its elements to.
+    //
+    // Returns false without moving anything if all keys have the same digit.
+    template <typename ExPolicy, typename KeySrc, typename KeyDst,
+        typename ValueSrc, typename ValueDst>
+    bool radix_sort_pass(ExPolicy& policy, std::size_t count,
+        std::vector<radix_sort_histogram>& histograms, std::size_t shift,
+        KeySrc key_src, KeyDst key_dst, ValueSrc value_src, ValueDst value_dst)
+    {
+        constexpr bool has_values =
+            !std::is_same_v<ValueSrc, radix_sort_no_values>;
+
+        std::size_t const num_chunks = histograms.size();
+        auto chunk_begin = [count, num_chunks](std::size_t chunk) {
+            return count * chunk / num_chunks;
+        };
+
+        radix_sort_for_each_chunk(
+            policy, num_chunks, [&](std::size_t chunk) {
+                radix_sort_histogram histogram = {};
+
+                std::size_t const end = chunk_begin(chunk + 1);
+                for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+                {
+                    ++histogram[radix_sort_digit(key_src[i], shift)];
+                }
+                histograms[chunk] = histogram;
+            });
+
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+        {
+            std::size_t total = 0;
+            for (radix_sort_histogram& histogram : histograms)
+            {
+                std::size_t const n = histogram[digit];
+                histogram[digit] = offset + total;
+                total += n;
+            }
+
+            if (total == count)
+            {
+                return false;
+            }
+            offset += total;
+        }
+
+        radix_sort_for_each_chunk(
+            policy, num_chunks, [&](std::size_t chunk) {
+                // the local copy can't alias with the destination
+                radix_sort_histogram positions = histograms[chunk];
+
+                std::size_t const end = chunk_begin(chunk + 1);
+                for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+                {
+                    std::size_t const pos =
+                        positions[radix_sort_digit(key_src[i], shift)]++;
+
+                    key_dst[pos] = key_src[i];
+                    if constexpr (has_values)
+                    {
+                        value_dst[pos] = HPX_MOVE(value_src[i]);
+                    }
+                }
+            });
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Stable least significant digit radix sort of the keys in
+    // [keys, keys + count), the values (if any) are moved along with their
+    // keys.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter>
+    void radix_sort(
+        ExPolicy& policy, KeyIter keys, ValueIter values, std::size_t count)
+    {
+        using key_type = hpx::traits::iter_value_t<KeyIter>;
+        using value_type = typename radix_sort_value<ValueIter>::type;
+
+        constexpr bool has_values =
+            !std::is_same_v<ValueIter, radix_sort_no_values>;
+
+        std::size_t num_chunks = 1;
+        if constexpr (!hpx::is_sequenced_execution_policy_v<ExPolicy>)
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            num_chunks = (std::min)(cores,
+                (count + radix_sort_limit_per_task - 1) /
+                    radix_sort_limit_per_task);
+            if (num_chunks == 0)
+            {
+                num_chunks = 1;
+            }
+        }
+
+        std::vector<radix_sort_histogram> histograms(num_chunks);
+
+        std::vector<key_type> key_buffer(count);
+        std::vector<value_type> value_buffer(has_values ? count : 0);
+
+        auto value_buffer_first = [&]() {
+            if constexpr (has_values)
+            {
+                return value_buffer.data();
+            }
+            else
+            {
+                return radix_sort_no_values();
+            }
+        }();
+
+        // the elements alternate between the input sequence and the buffer,
+        // passes which would not reorder anything are skipped
+        bool in_buffer = false;
+        for (std::size_t shift = 0; shift < sizeof(key_type) * CHAR_BIT;
+             shift += radix_sort_bits)
+        {
+            bool const moved = in_buffer ?
+                radix_sort_pass(policy, count, histograms, shift,
+                    key_buffer.data(), keys, value_buffer_first, values) :
+                radix_sort_pass(policy, count, histograms, shift, keys,
+                    key_buffer.data(), values, value_buffer_first);
+
+            if (moved)
+            {
+                in_buffer = !in_buffer;
+            }
+        }
+
+        if (in_buffer)
+        {
+            radix_sort_for_each_chunk(
+                policy, num_chunks, [&](std::size_t chunk) {
+                    std::size_t const end = count * (chunk + 1) / num_chunks;
+                    for (std::size_t i = count * chunk / num_chunks; i != end;
+                         ++i)
+                    {
+                        keys[i] = key_buffer[i];
+                        if constexpr (has_values)
+                        {
+                            values[i] = HPX_MOVE(value_buffer[i]);
+                        }
+                    }
+                });
+        }
+    }
+
+    // Run the radix sort and return the result as required by the execution
+    // policy.
+    template <typename ExPolicy, typename Result, typename KeyIter,
+        typename ValueIter>
+    hpx::future<Result> radix_sort_async(ExPolicy&& policy, KeyIter keys,
+        ValueIter values, std::size_t count, Result result)
+    {
+        return execution::async_execute(policy.executor(),
+            [policy, keys, values, count,
+                result = HPX_MOVE(result)]() mutable -> Result {
+                radix_sort(policy, keys, values, count);
+                return HPX_MOVE(result);
+            });
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,128 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/algorithms/detail/accumulate.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // provide implementation of std::reduce supporting iterators/sentinels
+    template <typename ExPolicy>
+    struct sequential_reduce_t
+      : hpx::functional::detail::tag_fallback<sequential_reduce_t<ExPolicy>>
+    {
+    private:
+        template <typename InIterB, typename InIterE, typename T,
+            typename Reduce>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_reduce_t<ExPolicy>, InIterB first, InIterE last, T init,
+            Reduce&& r)
+        {
+            return detail::accumulate(
+                first, last, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+        }
+
+        template <typename Iter, typename T, typename Reduce>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_reduce_t<ExPolicy>, Iter part_begin,
+            std::size_t part_size, T init, Reduce&& r)
+        {
+            return util::accumulate_n(
+                part_begin, part_size, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_reduce_t<ExPolicy> sequential_reduce =
+        sequential_reduce_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIterB, typename InIterE,
+        typename T, typename Reduce>
+    inline constexpr T sequential_reduce(
+        InIterB first, InIterE last, T init, Reduce&& r)
+    {
+        return sequential_reduce_t<ExPolicy>{}(
+            first, last, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    inline constexpr T sequential_reduce(
+        Iter part_begin, std::size_t part_size, T init, Reduce&& r)
+    {
+        return sequential_reduce_t<ExPolicy>{}(
+            part_begin, part_size, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+    }
+#endif
+
+    // provide implementation of std::transform_reduce supporting
+    // iterators/sentinels
+    template <typename ExPolicy>
+    struct sequential_transform_reduce_t
+      : hpx::functional::detail::tag_fallback<
+            sequential_transform_reduce_t<ExPolicy>>
+    {
+    private:
+        template <typename InIterB, typename InIterE, typename T,
+            typename Reduce, typename Convert>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_transform_reduce_t<ExPolicy>, InIterB first,
+            InIterE last, T init, Reduce&& r, Convert&& conv)
+        {
+            for (/**/; first != last; ++first)
+            {
+                init = HPX_INVOKE(r, HPX_MOVE(init), HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+
+        template <typename Iter, typename T, typename Reduce, typename Convert>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_transform_reduce_t<ExPolicy>, Iter part_begin,
+            std::size_t part_size, T init, Reduce&& r, Convert&& conv)
+        {
+            for (/**/; part_size != 0; (void) --part_size, ++part_begin)
+            {
+                init = HPX_INVOKE(
+                    r, HPX_MOVE(init), HPX_INVOKE(conv, *part_begin));
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_transform_reduce_t<ExPolicy>
+        sequential_transform_reduce = sequential_transform_reduce_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIterB, typename InIterE,
+        typename T, typename Reduce, typename Convert>
+    inline constexpr T sequential_transform_reduce(
+        InIterB first, InIterE last, T init, Reduce&& r, Convert&& conv)
+    {
+        return sequential_transform_reduce_t<ExPolicy>{}(first, last,
+            HPX_MOVE(init), HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Convert>
+    inline constexpr T sequential_transform_reduce(Iter part_begin,
+        std::size_t part_size, T init, Reduce&& r, Convert&& conv)
+    {
+        return sequential_transform_reduce_t<ExPolicy>{}(part_begin, part_size,
+            HPX_MOVE(init), HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,165 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // minimal number of elements a range has to have for the splitters to
+    // be selected from a sample, smaller ranges are handled sequentially
+    static constexpr std::size_t sample_select_limit = 1 << 16;
+
+    // maximal number of elements of the sample drawn from the range
+    static constexpr std::size_t sample_select_max_sample = 1 << 14;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Rearranges the elements in [first, last) such that the element at nth
+    // is the one which would be there if the range was sorted, no element
+    // before it being greater and no element after it being less than it.
+    //
+    // Two splitters bracketing the rank of nth are picked from a random
+    // sample of the range. The elements are partitioned in parallel into
+    // the ones less than the lower splitter, the ones between the splitters
+    // and the ones greater than the upper splitter. The selection continues
+    // on the bucket holding nth only, which is the small middle one with
+    // high probability (see R. W. Floyd and R. L. Rivest, "Expected time
+    // bounds for selection", Commun. ACM 18 (3), 1975).
+    template <typename ExPolicy, typename Iter, typename Comp>
+    void sample_select(
+        ExPolicy&& policy, Iter first, Iter nth, Iter last, Comp& comp)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        if (nth == last)
+        {
+            return;
+        }
+
+        // the splitters are copies of elements of the range
+        if constexpr (!std::is_copy_constructible_v<value_type>)
+        {
+            std::nth_element(first, nth, last, comp);
+        }
+        else
+        {
+            std::size_t cores = 1;
+            if constexpr (!hpx::is_sequenced_execution_policy_v<ExPolicy>)
+            {
+                cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+            }
+
+            std::minstd_rand gen(std::uint32_t(last - first));
+
+            while (true)
+            {
+                std::size_t const count = std::size_t(last - first);
+                if (cores <= 1 || count < sample_select_limit)
+                {
+                    std::nth_element(first, nth, last, comp);
+                    return;
+                }
+
+                // draw one element from each of the equally sized strides
+                // of the range
+                std::size_t const sample_size =
+                    (std::min)(count / 16, sample_select_max_sample);
+                std::size_t const stride = count / sample_size;
+
+                std::vector<value_type> sample;
+                sample.reserve(sample_size);
+                for (std::size_t i = 0; i != sample_size; ++i)
+                {
+                    sample.push_back(
+                        *std::next(first, i * stride + gen() % stride));
+                }
+                std::sort(sample.begin(), sample.end(), comp);
+
+                // the expected number of sample elements less than nth, the
+                // splitters are a couple of standard deviations away from it
+                std::size_t const rank = std::size_t(
+                    double(nth - first) * double(sample_size) / double(count));
+                std::size_t const spread =
+                    std::size_t(2.5 * std::sqrt(double(sample_size))) + 1;
+
+                bool const has_lower = rank > spread;
+                bool const has_upper = rank + spread < sample_size;
+                value_type const& lower = sample[has_lower ? rank - spread : 0];
+                value_type const& upper =
+                    sample[has_upper ? rank + spread : sample_size - 1];
+
+                Iter lower_last = first;
+                if (has_lower)
+                {
+                    lower_last = detail::partition<Iter>().call(
+                        policy(hpx::execution::non_task), first, last,
+                        [&](value_type const& x) {
+                            return HPX_INVOKE(comp, x, lower);
+                        },
+                        util::projection_identity{});
+
+                    // nth is less than the lower splitter
+                    if (nth < lower_last)
+                    {
+                        last = lower_last;
+                        continue;
+                    }
+                }
+
+                Iter upper_first = last;
+                if (has_upper)
+                {
+                    upper_first = detail::partition<Iter>().call(
+                        policy(hpx::execution::non_task), lower_last, last,
+                        [&](value_type const& x) {
+                            return !HPX_INVOKE(comp, upper, x);
+                        },
+                        util::projection_identity{});
+
+                    // nth is greater than the upper splitter
+                    if (!(nth < upper_first))
+                    {
+                        first = upper_first;
+                        continue;
+                    }
+                }
+
+                // all elements between equivalent splitters are equivalent
+                if (has_lower && has_upper && !HPX_INVOKE(comp, lower, upper))
+                {
+                    return;
+                }
+
+                // the sample did not narrow down the range
+                if (lower_last == first && upper_first == last)
+                {
+                    std::nth_element(first, nth, last, comp);
+                    return;
+                }
+
+                first = lower_last;
+                last = upper_first;
+            }
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
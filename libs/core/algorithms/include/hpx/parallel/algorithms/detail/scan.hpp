@@ -0,0 +1,52 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // The parallel scans combine the result of all preceding partitions with
+    // each of the elements of a partition once the partition results are
+    // known: *it = op(val, *it).
+    template <typename ExPolicy>
+    struct sequential_scan_combine_t
+      : hpx::functional::detail::tag_fallback<
+            sequential_scan_combine_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Op>
+        friend inline constexpr void tag_fallback_invoke(
+            sequential_scan_combine_t<ExPolicy>, Iter it, std::size_t count,
+            T const& val, Op&& op)
+        {
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                *it = HPX_INVOKE(op, val, *it);
+            }
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_scan_combine_t<ExPolicy>
+        sequential_scan_combine = sequential_scan_combine_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename T, typename Op>
+    inline constexpr void sequential_scan_combine(
+        Iter it, std::size_t count, T const& val, Op&& op)
+    {
+        return sequential_scan_combine_t<ExPolicy>{}(
+            it, count, val, HPX_FORWARD(Op, op));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
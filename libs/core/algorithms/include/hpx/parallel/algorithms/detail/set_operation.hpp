@@ -13,6 +13,7 @@
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/foreach_partitioner.hpp>
@@ -110,8 +111,6 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         std::size_t cores = execution::processing_units_count(
             policy.parameters(), policy.executor());
 
-        std::size_t step = (len1 + cores - 1) / cores;
-
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
         std::shared_ptr<buffer_type[]> buffer(
             new buffer_type[combiner(len1, len2)]);
@@ -122,91 +121,68 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         boost::shared_array<set_chunk_data> chunks(new set_chunk_data[cores]);
 #endif
 
-        // first step, is applied to all partitions
-        auto f1 = [=](set_chunk_data* curr_chunk,
-                      std::size_t part_size) mutable -> void {
-            HPX_ASSERT(part_size == 1);
-            HPX_UNUSED(part_size);
-
-            // find start in sequence 1
-            std::size_t start1 = (curr_chunk - chunks.get()) * step;
-            std::size_t end1 = (std::min)(start1 + step, std::size_t(len1));
-
-            if (start1 >= end1)
-            {
-                return;
-            }
-
-            bool first_partition = (start1 == 0);
-            bool last_partition = (end1 == std::size_t(len1));
-
-            auto start_value = HPX_INVOKE(proj1, first1[start1]);
-            auto end_value = HPX_INVOKE(proj1, first1[end1]);
-
-            // all but the last chunk require special handling
-            if (!last_partition)
+        // Find the positions in both sequences where the merge path crosses
+        // the given diagonal. The positions are moved to the beginning of the
+        // run of elements equivalent to the element following them, which
+        // makes sure that equivalent elements of both sequences are handled
+        // by the same partition.
+        auto split = [=](std::size_t diag) mutable {
+            std::size_t const size1 = len1;
+            std::size_t const size2 = len2;
+            if (diag == size1 + size2)
             {
-                // this chunk will be handled by the next one if all
-                // elements of this partition are equal
-                if (!HPX_INVOKE(f, start_value, end_value))
-                {
-                    return;
-                }
-
-                // move backwards to find earliest element which is equal to
-                // the last element of the current chunk
-                if (end1 != 0)
-                {
-                    auto end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-
-                    while (!HPX_INVOKE(f, end_value1, end_value) && --end1 != 0)
-                    {
-                        end_value = HPX_MOVE(end_value1);
-                        end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-                    }
-                }
+                return std::make_pair(size1, size2);
             }
 
-            // move backwards to find earliest element which is equal to
-            // the first element of the current chunk
-            if (start1 != 0)
+            std::size_t pos1 = merge_path_search(
+                first1, size1, first2, size2, diag, f, proj1, proj2);
+            std::size_t pos2 = diag - pos1;
+
+            auto run_start = [&](auto const& value) {
+                return std::make_pair(
+                    std::size_t(detail::lower_bound(first1, first1 + pos1,
+                                    value, f, proj1) -
+                        first1),
+                    std::size_t(detail::lower_bound(first2, first2 + pos2,
+                                    value, f, proj2) -
+                        first2));
+            };
+
+            if (pos1 != size1 &&
+                (pos2 == size2 ||
+                    !HPX_INVOKE(f, HPX_INVOKE(proj2, first2[pos2]),
+                        HPX_INVOKE(proj1, first1[pos1]))))
             {
-                auto start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-
-                while (
-                    !HPX_INVOKE(f, start_value1, start_value) && --start1 != 0)
-                {
-                    start_value = HPX_MOVE(start_value1);
-                    start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-                }
+                return run_start(HPX_INVOKE(proj1, first1[pos1]));
             }
+            return run_start(HPX_INVOKE(proj2, first2[pos2]));
+        };
 
-            // find start and end in sequence 2
-            std::size_t start2 = 0;
-            if (!first_partition)
-            {
-                start2 = detail::lower_bound(
-                             first2, first2 + len2, start_value, f, proj2) -
-                    first2;
-            }
+        // first step, is applied to all chunks, each chunk covers the same
+        // number of input elements (a partition may consist of several
+        // chunks depending on the chunk size of the execution policy)
+        auto f1 = [=](set_chunk_data* curr_chunk,
+                      std::size_t part_size) mutable -> void {
+            std::size_t const total = len1 + len2;
 
-            std::size_t end2 = len2;
-            if (!last_partition)
+            for (/**/; part_size != 0; (void) --part_size, ++curr_chunk)
             {
-                end2 = detail::lower_bound(first2 + start2, first2 + len2,
-                           end_value, f, proj2) -
-                    first2;
+                std::size_t const chunk = curr_chunk - chunks.get();
+
+                auto const start = split(total * chunk / cores);
+                auto const end = split(total * (chunk + 1) / cores);
+
+                // perform requested set-operation into the proper place of
+                // the intermediate buffer
+                curr_chunk->start = combiner(start.first, start.second);
+                auto buffer_dest = buffer.get() + curr_chunk->start;
+                auto op_result = setop(first1 + start.first,
+                    first1 + end.first, first2 + start.second,
+                    first2 + end.second, buffer_dest, f);
+                curr_chunk->first1 = op_result.in1 - first1;
+                curr_chunk->first2 = op_result.in2 - first2;
+                curr_chunk->len = op_result.out - buffer_dest;
             }
-
-            // perform requested set-operation into the proper place of the
-            // intermediate buffer
-            curr_chunk->start = combiner(start1, start2);
-            auto buffer_dest = buffer.get() + curr_chunk->start;
-            auto op_result = setop(first1 + start1, first1 + end1,
-                first2 + start2, first2 + end2, buffer_dest, f);
-            curr_chunk->first1 = op_result.in1 - first1;
-            curr_chunk->first2 = op_result.in2 - first2;
-            curr_chunk->len = op_result.out - buffer_dest;
         };
 
         // second step, is executed after all partitions are done running
@@ -231,15 +207,11 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             {
                 set_chunk_data* curr_chunk = chunk++;
                 chunk->start_index = curr_chunk->start_index + curr_chunk->len;
-                if (curr_chunk->first1 != std::size_t(-1))
-                {
-                    first1_pos = (std::max)(first1_pos, curr_chunk->first1);
-                }
-                if (curr_chunk->first2 != std::size_t(-1))
-                {
-                    first2_pos = (std::max)(first2_pos, curr_chunk->first2);
-                }
+                first1_pos = (std::max)(first1_pos, curr_chunk->first1);
+                first2_pos = (std::max)(first2_pos, curr_chunk->first2);
             }
+            first1_pos = (std::max)(first1_pos, chunk->first1);
+            first2_pos = (std::max)(first2_pos, chunk->first2);
 
             // finally, copy data to destination
             parallel::util::
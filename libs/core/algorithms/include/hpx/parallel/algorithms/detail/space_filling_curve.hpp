@@ -0,0 +1,108 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // the number of bits needed to represent all values less than extent
+    inline std::size_t curve_bits(std::size_t extent) noexcept
+    {
+        std::size_t bits = 1;
+        while (bits < 64 && (std::size_t(1) << bits) < extent)
+        {
+            ++bits;
+        }
+        return bits;
+    }
+
+    // Interleaves the lowest bits of the coordinates, the first coordinate
+    // providing the most significant bit of each group.
+    template <std::size_t N>
+    std::uint64_t interleave_bits(
+        std::array<std::size_t, N> const& coords, std::size_t bits) noexcept
+    {
+        HPX_ASSERT(N * bits <= 64);
+
+        std::uint64_t key = 0;
+        for (std::size_t bit = bits; bit-- != 0; /**/)
+        {
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                key = (key << 1) | ((coords[d] >> bit) & 1);
+            }
+        }
+        return key;
+    }
+
+    // The position of the given point along the Z-order curve covering a
+    // cube with an edge length of 2^bits.
+    template <std::size_t N>
+    std::uint64_t morton_key(
+        std::array<std::size_t, N> const& coords, std::size_t bits) noexcept
+    {
+        return interleave_bits(coords, bits);
+    }
+
+    // The position of the given point along the Hilbert curve covering a
+    // cube with an edge length of 2^bits. Consecutive points along the
+    // curve are neighbors, see J. Skilling, "Programming the Hilbert curve",
+    // AIP Conference Proceedings 707, 381 (2004).
+    template <std::size_t N>
+    std::uint64_t hilbert_key(
+        std::array<std::size_t, N> coords, std::size_t bits) noexcept
+    {
+        std::size_t const m = std::size_t(1) << (bits - 1);
+
+        // inverse undo excess work
+        for (std::size_t q = m; q > 1; q >>= 1)
+        {
+            std::size_t const p = q - 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                if (coords[d] & q)
+                {
+                    coords[0] ^= p;
+                }
+                else
+                {
+                    std::size_t const t = (coords[0] ^ coords[d]) & p;
+                    coords[0] ^= t;
+                    coords[d] ^= t;
+                }
+            }
+        }
+
+        // gray encode
+        for (std::size_t d = 1; d != N; ++d)
+        {
+            coords[d] ^= coords[d - 1];
+        }
+
+        std::size_t t = 0;
+        for (std::size_t q = m; q > 1; q >>= 1)
+        {
+            if (coords[N - 1] & q)
+            {
+                t ^= q - 1;
+            }
+        }
+        for (std::size_t d = 0; d != N; ++d)
+        {
+            coords[d] ^= t;
+        }
+
+        return interleave_bits(coords, bits);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
@@ -297,6 +297,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -398,60 +399,98 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 FwdIter2 final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 3
-                // steps. The first calculates the scan results for each
-                // partition. The second accumulates the result from left to
-                // right to be used by the third step--which operates on the
-                // same partitions the first step operated on.
-
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
 
-                auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
-                              T val) mutable -> void {
-                    FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-                    *dst++ = val;
-
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(dst, part_size - 1,
-                        [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                auto f4 = [last_iter, final_dest](std::vector<T>&&,
+                              std::vector<hpx::future<void>>&& data) {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    data.clear();
+                    return util::in_out_result<FwdIter1, FwdIter2>{
+                        last_iter, final_dest};
                 };
 
-                return util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter2>, T>::
-                    call(
-                        HPX_FORWARD(ExPolicy, policy),
-                        make_zip_iterator(first, dest), count, init,
-                        // step 1 performs first part of scan algorithm
-                        [op, last](zip_iterator part_begin,
-                            std::size_t part_size) -> T {
-                            T part_init = get<0>(*part_begin++);
-
-                            auto iters = part_begin.get_iterator_tuple();
-                            if (get<0>(iters) != last)
-                            {
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    // Vector-pack policies perform the scan in 3 steps, as the
+                    // third step can combine whole packs of elements with the
+                    // result of the preceding partitions (see
+                    // inclusive_scan).
+                    auto f3 = [op](zip_iterator part_begin,
+                                  std::size_t part_size,
+                                  T val) mutable -> void {
+                        FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
+                        *dst++ = val;
+
+                        sequential_scan_combine<std::decay_t<ExPolicy>>(
+                            dst, part_size - 1, val, op);
+                    };
+
+                    return util::scan_partitioner<ExPolicy,
+                        util::in_out_result<FwdIter1, FwdIter2>, T>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            make_zip_iterator(first, dest), count, init,
+                            // step 1 performs first part of scan algorithm
+                            [op, last](zip_iterator part_begin,
+                                std::size_t part_size) -> T {
+                                T part_init = get<0>(*part_begin++);
+
+                                auto iters = part_begin.get_iterator_tuple();
+                                if (get<0>(iters) != last)
+                                {
+                                    return sequential_exclusive_scan_n(
+                                        get<0>(iters), part_size - 1,
+                                        get<1>(iters), part_init, op);
+                                }
+                                return part_init;
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            op,
+                            // step 3 runs final accumulation on each partition
+                            HPX_MOVE(f3),
+                            // step 4 use this return value
+                            HPX_MOVE(f4));
+                }
+                else
+                {
+                    // The scan is performed in a single pass over the data.
+                    // Each partition is scanned once the combined result of
+                    // all preceding partitions is known. Partitions for which
+                    // this result is not available yet are reduced first to
+                    // allow later partitions to proceed.
+                    return util::scan_partitioner<ExPolicy,
+                        util::in_out_result<FwdIter1, FwdIter2>, T, void,
+                        util::scan_partitioner_single_pass_tag>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            make_zip_iterator(first, dest), count, init,
+                            // step 1 reduces a partition
+                            [op](zip_iterator part_begin,
+                                std::size_t part_size) -> T {
+                                FwdIter1 it =
+                                    get<0>(part_begin.get_iterator_tuple());
+                                T part_init = *it;
+                                return util::accumulate_n(++it, part_size - 1,
+                                    HPX_MOVE(part_init), op);
+                            },
+                            // step 2 combines the results of adjacent
+                            // partitions
+                            op,
+                            // step 3 scans a partition given the combined
+                            // result of all preceding partitions
+                            [op](zip_iterator part_begin, std::size_t part_size,
+                                T val, bool) -> T {
+                                auto iters = part_begin.get_iterator_tuple();
                                 return sequential_exclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
-                            }
-                            return part_init;
-                        },
-                        // step 2 propagates the partition results from left
-                        // to right
-                        op,
-                        // step 3 runs final accumulation on each partition
-                        HPX_MOVE(f3),
-                        // step 4 use this return value
-                        [last_iter, final_dest](std::vector<T>&&,
-                            std::vector<hpx::future<void>>&& data) {
-                            // make sure iterators embedded in function object that is
-                            // attached to futures are invalidated
-                            data.clear();
-                            return util::in_out_result<FwdIter1, FwdIter2>{
-                                last_iter, final_dest};
-                        });
+                                    get<0>(iters), part_size, get<1>(iters),
+                                    HPX_MOVE(val), op);
+                            },
+                            // step 4 use this return value
+                            HPX_MOVE(f4));
+                }
             }
         };
         /// \endcond
@@ -0,0 +1,661 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_nd.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// The orders in which the tiles of an index space are visited.
+    enum class tile_order
+    {
+        row_major,    ///< the last dimension varies fastest
+        morton,       ///< along the Z-order curve
+        hilbert       ///< along the Hilbert curve
+    };
+
+    /// A box of an N-dimensional index space, covering [first[d], last[d])
+    /// in each dimension d.
+    template <typename I, std::size_t N>
+    struct index_tile
+    {
+        std::array<I, N> first;
+        std::array<I, N> last;
+    };
+
+    /// Splits the index space [first, last) into tiles of the given extents
+    /// and returns them in the given order. The tiles at the upper end of
+    /// each dimension are clipped to the index space. The result can be used
+    /// as the shape of \a hpx::parallel::execution::bulk_async_execute and
+    /// as the index space of \a for_loop_nd.
+    ///
+    /// Distributing contiguous parts of a space-filling curve to different
+    /// workers keeps the tiles handled by each of them close to each other,
+    /// which improves the reuse of data shared by neighboring tiles.
+    ///
+    /// \tparam I           The type of the indices. This should be an
+    ///                     integral type.
+    /// \tparam N           The number of dimensions of the index space.
+    ///
+    /// \param first        Refers to the first index in each dimension.
+    /// \param last         Refers to the index past the last one in each
+    ///                     dimension.
+    /// \param extents      The number of indices covered by a tile in each
+    ///                     dimension. If omitted, the tiles cover 4096
+    ///                     indices.
+    /// \param order        The order in which the tiles are returned. This
+    ///                     defaults to \a tile_order::hilbert.
+    ///
+    /// \returns  The \a make_tiled_shape algorithm returns a
+    ///           \a std::vector<index_tile<I, N>>.
+    ///
+    /// \throws   hpx::exception with the error code hpx::bad_parameter if the
+    ///           tiles can't be ordered along the Morton or Hilbert curve
+    ///           because there are more than 2^(64/N) tiles in one
+    ///           dimension.
+    ///
+    template <typename I, std::size_t N>
+    std::vector<index_tile<I, N>> make_tiled_shape(
+        std::array<I, N> const& first, std::array<I, N> const& last,
+        std::array<std::size_t, N> const& extents,
+        tile_order order = tile_order::hilbert);
+
+    /// The for_loop_nd implements loop functionality over an N-dimensional
+    /// index space. The index space is split into cache sized tiles which are
+    /// handed out to the workers in the order of the Hilbert curve.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam I           The type of the indices. This should be an
+    ///                     integral type.
+    /// \tparam N           The number of dimensions of the index space, one,
+    ///                     two or three.
+    /// \tparam Args        A parameter pack, it's last element is a function
+    ///                     object to be invoked for each iteration, the others
+    ///                     have to be conforming to the reduction concept.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the first index in each dimension.
+    /// \param last         Refers to the index past the last one in each
+    ///                     dimension.
+    /// \param args         The last element of this parameter pack is the
+    ///                     function (object) to invoke, while the remaining
+    ///                     elements of the parameter pack are instances of
+    ///                     reduction objects.
+    ///                     The function (or function object) which will be
+    ///                     invoked for each of the indices should expose a
+    ///                     signature equivalent to:
+    ///                     \code
+    ///                     <ignored> pred(I i0, ..., I iN-1, ...);
+    ///                     \endcode \n
+    ///                     It will receive the index in each dimension and
+    ///                     one argument for each of the reduction objects
+    ///                     passed to the algorithms, representing their
+    ///                     current values.
+    ///
+    /// The iterations within a tile are executed in row-major order. The
+    /// application of function objects in parallel algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The application of function objects in parallel algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a for_loop_nd algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a void otherwise.
+    ///
+    template <typename ExPolicy, typename I, std::size_t N, typename... Args>
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy>::type
+    for_loop_nd(ExPolicy&& policy, std::array<I, N> const& first,
+        std::array<I, N> const& last, Args&&... args);
+
+    /// The for_loop_nd implements loop functionality over an N-dimensional
+    /// index space given by tiles, as returned by \a make_tiled_shape. The
+    /// tiles are handed out to the workers in their given order.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Shape       The type of the range of tiles (deduced). Its
+    ///                     value type must be \a index_tile<I, N>.
+    /// \tparam Args        A parameter pack, it's last element is a function
+    ///                     object to be invoked for each iteration, the others
+    ///                     have to be conforming to the reduction concept.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param shape        Refers to the tiles the loop runs over.
+    /// \param args         The last element of this parameter pack is the
+    ///                     function (object) to invoke, while the remaining
+    ///                     elements of the parameter pack are instances of
+    ///                     reduction objects.
+    ///                     The function (or function object) which will be
+    ///                     invoked for each of the indices should expose a
+    ///                     signature equivalent to:
+    ///                     \code
+    ///                     <ignored> pred(I i0, ..., I iN-1, ...);
+    ///                     \endcode \n
+    ///                     It will receive the index in each dimension and
+    ///                     one argument for each of the reduction objects
+    ///                     passed to the algorithms, representing their
+    ///                     current values.
+    ///
+    /// \returns  The \a for_loop_nd algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a void otherwise.
+    ///
+    template <typename ExPolicy, typename Shape, typename... Args>
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy>::type
+    for_loop_nd(ExPolicy&& policy, Shape&& shape, Args&&... args);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/local/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/type_support/pack.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/space_filling_curve.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/algorithms/for_loop_reduction.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace experimental {
+    ///////////////////////////////////////////////////////////////////////////
+    enum class tile_order
+    {
+        row_major,
+        morton,
+        hilbert
+    };
+
+    template <typename I, std::size_t N>
+    struct index_tile
+    {
+        std::array<I, N> first;
+        std::array<I, N> last;
+    };
+}}    // namespace hpx::experimental
+
+namespace hpx { namespace parallel { inline namespace v2 {
+    ///////////////////////////////////////////////////////////////////////////
+    // for_loop_nd
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // the number of iterations covered by a default sized tile
+        static constexpr std::size_t for_loop_nd_tile_size = 4096;
+
+        template <std::size_t N>
+        constexpr std::array<std::size_t, N> default_tile_extents() noexcept
+        {
+            static_assert(N >= 1 && N <= 3,
+                "for_loop_nd supports one, two and three dimensions");
+
+            if constexpr (N == 1)
+            {
+                return {{for_loop_nd_tile_size}};
+            }
+            else if constexpr (N == 2)
+            {
+                return {{64, 64}};
+            }
+            else
+            {
+                return {{16, 16, 16}};
+            }
+        }
+
+        template <typename I, std::size_t N>
+        std::vector<hpx::experimental::index_tile<I, N>> make_tiled_shape(
+            std::array<I, N> const& first, std::array<I, N> const& last,
+            std::array<std::size_t, N> const& extents,
+            hpx::experimental::tile_order order)
+        {
+            static_assert(std::is_integral<I>::value,
+                "for_loop_nd requires integral indices");
+
+            using tile_type = hpx::experimental::index_tile<I, N>;
+
+            // the number of tiles in each dimension
+            std::array<std::size_t, N> tiles;
+            std::array<std::size_t, N> tile_extents;
+            std::size_t count = 1;
+            std::size_t max_tiles = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                if (!(first[d] < last[d]))
+                {
+                    return {};
+                }
+
+                std::size_t const size = std::size_t(last[d] - first[d]);
+                tile_extents[d] = (std::max)(extents[d], std::size_t(1));
+                tiles[d] = (size + tile_extents[d] - 1) / tile_extents[d];
+
+                count *= tiles[d];
+                max_tiles = (std::max)(max_tiles, tiles[d]);
+            }
+
+            // the keys along the space filling curves have 64 bits
+            std::size_t const bits = v1::detail::curve_bits(max_tiles);
+            if (order != hpx::experimental::tile_order::row_major &&
+                N * bits > 64)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hpx::experimental::make_tiled_shape",
+                    "too many tiles to order them along a space filling "
+                    "curve, use larger tiles or tile_order::row_major");
+            }
+
+            std::vector<std::pair<std::uint64_t, tile_type>> keyed;
+            keyed.reserve(count);
+
+            std::array<std::size_t, N> coords{};
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                tile_type tile;
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    tile.first[d] =
+                        first[d] + static_cast<I>(coords[d] * tile_extents[d]);
+                    tile.last[d] = static_cast<I>((std::min)(
+                        std::size_t(last[d] - tile.first[d]), tile_extents[d]));
+                    tile.last[d] += tile.first[d];
+                }
+
+                std::uint64_t key = i;
+                if (order == hpx::experimental::tile_order::morton)
+                {
+                    key = v1::detail::morton_key(coords, bits);
+                }
+                else if (order == hpx::experimental::tile_order::hilbert)
+                {
+                    key = v1::detail::hilbert_key(coords, bits);
+                }
+                keyed.emplace_back(key, tile);
+
+                // advance to the next tile in row-major order
+                for (std::size_t d = N; d-- != 0; /**/)
+                {
+                    if (++coords[d] != tiles[d])
+                    {
+                        break;
+                    }
+                    coords[d] = 0;
+                }
+            }
+
+            if (order != hpx::experimental::tile_order::row_major)
+            {
+                std::sort(keyed.begin(), keyed.end(),
+                    [](auto const& lhs, auto const& rhs) {
+                        return lhs.first < rhs.first;
+                    });
+            }
+
+            std::vector<tile_type> result;
+            result.reserve(count);
+            for (auto const& p : keyed)
+            {
+                result.push_back(p.second);
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct is_for_loop_nd_reduction : std::false_type
+        {
+        };
+
+        template <typename T, typename Op>
+        struct is_for_loop_nd_reduction<reduction_helper<T, Op>>
+          : std::true_type
+        {
+        };
+
+        // Invokes f for all indices of the tile, the last dimension varying
+        // fastest.
+        template <std::size_t D, typename I, std::size_t N, typename F>
+        void for_loop_nd_tile(hpx::experimental::index_tile<I, N> const& tile,
+            std::array<I, N>& index, F& f)
+        {
+            for (index[D] = tile.first[D]; index[D] != tile.last[D];
+                 ++index[D])
+            {
+                if constexpr (D + 1 == N)
+                {
+                    f(index);
+                }
+                else
+                {
+                    for_loop_nd_tile<D + 1>(tile, index, f);
+                }
+            }
+        }
+
+        template <typename Tile, typename F, typename... Ts>
+        struct part_tiles;
+
+        template <typename I, std::size_t N, typename F, typename... Ts>
+        struct part_tiles<hpx::experimental::index_tile<I, N>, F, Ts...>
+        {
+            static_assert(
+                hpx::util::all_of<is_for_loop_nd_reduction<Ts>...>::value,
+                "for_loop_nd supports reduction objects only");
+
+            using tile_type = hpx::experimental::index_tile<I, N>;
+            using fun_type = std::decay_t<F>;
+
+            std::shared_ptr<std::vector<tile_type> const> tiles_;
+            fun_type f_;
+            hpx::tuple<Ts...> args_;
+
+            template <typename F_, typename Args>
+            part_tiles(std::shared_ptr<std::vector<tile_type> const> tiles,
+                F_&& f, Args&& args)
+              : tiles_(HPX_MOVE(tiles))
+              , f_(HPX_FORWARD(F_, f))
+              , args_(HPX_FORWARD(Args, args))
+            {
+            }
+
+            template <std::size_t... Ds, std::size_t... Is>
+            HPX_FORCEINLINE void invoke(std::array<I, N> const& index,
+                hpx::util::index_pack<Ds...>, hpx::util::index_pack<Is...>)
+            {
+                HPX_INVOKE(
+                    f_, index[Ds]..., hpx::get<Is>(args_).iteration_value()...);
+            }
+
+            void operator()(std::size_t part_begin, std::size_t part_steps,
+                std::size_t part_index)
+            {
+                auto pack =
+                    typename hpx::util::make_index_pack<sizeof...(Ts)>::type();
+                init_iteration(args_, pack, part_index);
+
+                auto invoke_index = [&](std::array<I, N> const& index) {
+                    invoke(index,
+                        typename hpx::util::make_index_pack<N>::type(), pack);
+                };
+
+                std::array<I, N> index;
+                for (/**/; part_steps != 0; --part_steps, ++part_begin)
+                {
+                    for_loop_nd_tile<0>(
+                        (*tiles_)[part_begin], index, invoke_index);
+                }
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct for_loop_nd_algo : public v1::detail::algorithm<for_loop_nd_algo>
+        {
+            constexpr for_loop_nd_algo() noexcept
+              : for_loop_nd_algo::algorithm("for_loop_nd_algo")
+            {
+            }
+
+            template <typename ExPolicy, typename Tile, typename F,
+                typename... Ts>
+            static hpx::util::unused_type sequential(ExPolicy&&,
+                std::shared_ptr<std::vector<Tile> const> tiles, F&& f,
+                Ts&&... ts)
+            {
+                std::size_t const size = tiles->size();
+
+                part_tiles<Tile, F, std::decay_t<Ts>...> part(HPX_MOVE(tiles),
+                    HPX_FORWARD(F, f),
+                    hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...));
+                part(0, size, 0);
+
+                // make sure live-out variables are properly set on return
+                auto pack =
+                    typename hpx::util::make_index_pack<sizeof...(Ts)>::type();
+                exit_iteration(part.args_, pack, size);
+
+                return hpx::util::unused_type();
+            }
+
+            template <typename ExPolicy, typename Tile, typename F,
+                typename... Ts>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy,
+                std::shared_ptr<std::vector<Tile> const> tiles, F&& f,
+                Ts&&... ts)
+            {
+                std::size_t const size = tiles->size();
+                if (size == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy>::get();
+                }
+
+                // we need to decay copy here to properly transport
+                // everything to the tasks
+                using args_type = hpx::tuple<std::decay_t<Ts>...>;
+                args_type args = hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...);
+
+                return util::partitioner<ExPolicy>::call_with_index(
+                    HPX_FORWARD(ExPolicy, policy), std::size_t(0), size, 1,
+                    part_tiles<Tile, F, std::decay_t<Ts>...>{
+                        HPX_MOVE(tiles), HPX_FORWARD(F, f), args},
+                    [=](std::vector<hpx::future<void>>&&) mutable -> void {
+                        auto pack = typename hpx::util::make_index_pack<
+                            sizeof...(Ts)>::type();
+                        // make sure live-out variables are properly set on
+                        // return
+                        exit_iteration(args, pack, size);
+                    });
+            }
+        };
+
+        // reshuffle arguments, last argument is function object, will go
+        // first
+        template <typename ExPolicy, typename Tile, std::size_t... Is,
+            typename... Args>
+        typename util::detail::algorithm_result<ExPolicy>::type for_loop_nd(
+            ExPolicy&& policy, std::shared_ptr<std::vector<Tile> const> tiles,
+            hpx::util::index_pack<Is...>, Args&&... args)
+        {
+            auto&& t = hpx::forward_as_tuple(HPX_FORWARD(Args, args)...);
+
+            return for_loop_nd_algo().call(HPX_FORWARD(ExPolicy, policy),
+                HPX_MOVE(tiles), hpx::get<sizeof...(Args) - 1>(t),
+                hpx::get<Is>(t)...);
+        }
+
+        template <typename Shape>
+        auto make_shared_tiles(Shape&& shape)
+        {
+            using tile_type = std::decay_t<decltype(
+                *hpx::util::begin(std::declval<Shape&>()))>;
+
+            return std::make_shared<std::vector<tile_type> const>(
+                hpx::util::begin(shape), hpx::util::end(shape));
+        }
+
+        template <typename T>
+        struct is_index_tile : std::false_type
+        {
+        };
+
+        template <typename I, std::size_t N>
+        struct is_index_tile<hpx::experimental::index_tile<I, N>>
+          : std::true_type
+        {
+        };
+
+        template <typename Shape, typename Enable = void>
+        struct is_tiled_shape : std::false_type
+        {
+        };
+
+        template <typename Shape>
+        struct is_tiled_shape<Shape,
+            std::enable_if_t<hpx::traits::is_range<Shape>::value>>
+          : is_index_tile<std::decay_t<decltype(
+                *hpx::util::begin(std::declval<Shape&>()))>>
+        {
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v2
+
+namespace hpx { namespace experimental {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename I, std::size_t N>
+    std::vector<index_tile<I, N>> make_tiled_shape(
+        std::array<I, N> const& first, std::array<I, N> const& last,
+        std::array<std::size_t, N> const& extents,
+        tile_order order = tile_order::hilbert)
+    {
+        return hpx::parallel::v2::detail::make_tiled_shape(
+            first, last, extents, order);
+    }
+
+    template <typename I, std::size_t N>
+    std::vector<index_tile<I, N>> make_tiled_shape(
+        std::array<I, N> const& first, std::array<I, N> const& last)
+    {
+        return hpx::parallel::v2::detail::make_tiled_shape(first, last,
+            hpx::parallel::v2::detail::default_tile_extents<N>(),
+            tile_order::hilbert);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::experimental::for_loop_nd
+    inline constexpr struct for_loop_nd_t final
+      : hpx::detail::tag_parallel_algorithm<for_loop_nd_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename I, std::size_t N,
+            typename... Args,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                std::is_integral<I>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(for_loop_nd_t, ExPolicy&& policy,
+            std::array<I, N> const& first, std::array<I, N> const& last,
+            Args&&... args)
+        {
+            static_assert(sizeof...(Args) >= 1,
+                "for_loop_nd must be called with at least a function object");
+
+            using hpx::util::make_index_pack;
+            return parallel::v2::detail::for_loop_nd(
+                HPX_FORWARD(ExPolicy, policy),
+                parallel::v2::detail::make_shared_tiles(
+                    make_tiled_shape(first, last)),
+                typename make_index_pack<sizeof...(Args) - 1>::type(),
+                HPX_FORWARD(Args, args)...);
+        }
+
+        // clang-format off
+        template <typename I, std::size_t N, typename... Args,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_integral<I>::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(for_loop_nd_t,
+            std::array<I, N> const& first, std::array<I, N> const& last,
+            Args&&... args)
+        {
+            static_assert(sizeof...(Args) >= 1,
+                "for_loop_nd must be called with at least a function object");
+
+            using hpx::util::make_index_pack;
+            return parallel::v2::detail::for_loop_nd(hpx::execution::seq,
+                parallel::v2::detail::make_shared_tiles(
+                    make_tiled_shape(first, last)),
+                typename make_index_pack<sizeof...(Args) - 1>::type(),
+                HPX_FORWARD(Args, args)...);
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Shape, typename... Args,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                parallel::v2::detail::is_tiled_shape<
+                    std::decay_t<Shape>>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(
+            for_loop_nd_t, ExPolicy&& policy, Shape&& shape, Args&&... args)
+        {
+            static_assert(sizeof...(Args) >= 1,
+                "for_loop_nd must be called with at least a function object");
+
+            using hpx::util::make_index_pack;
+            return parallel::v2::detail::for_loop_nd(
+                HPX_FORWARD(ExPolicy, policy),
+                parallel::v2::detail::make_shared_tiles(shape),
+                typename make_index_pack<sizeof...(Args) - 1>::type(),
+                HPX_FORWARD(Args, args)...);
+        }
+
+        // clang-format off
+        template <typename Shape, typename... Args,
+            HPX_CONCEPT_REQUIRES_(
+                parallel::v2::detail::is_tiled_shape<
+                    std::decay_t<Shape>>::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(
+            for_loop_nd_t, Shape&& shape, Args&&... args)
+        {
+            static_assert(sizeof...(Args) >= 1,
+                "for_loop_nd must be called with at least a function object");
+
+            using hpx::util::make_index_pack;
+            return parallel::v2::detail::for_loop_nd(hpx::execution::seq,
+                parallel::v2::detail::make_shared_tiles(shape),
+                typename make_index_pack<sizeof...(Args) - 1>::type(),
+                HPX_FORWARD(Args, args)...);
+        }
+    } for_loop_nd{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
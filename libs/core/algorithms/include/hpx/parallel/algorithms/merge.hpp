@@ -170,6 +170,7 @@ namespace hpx {
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 
@@ -180,11 +181,13 @@ namespace hpx {
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/rotate.hpp>
-#include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 
@@ -243,172 +246,65 @@ namespace hpx { namespace parallel { inline namespace v1 {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        struct lower_bound_helper;
-
-        struct upper_bound_helper
-        {
-            // upper_bound with projection function.
-            template <typename Iter, typename Sent, typename T, typename Comp,
-                typename Proj>
-            static constexpr Iter call(
-                Iter first, Sent last, T const& value, Comp&& comp, Proj&& proj)
-            {
-                return detail::upper_bound(first, last, value,
-                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
-            }
-
-            using another_type = lower_bound_helper;
-        };
-
-        struct lower_bound_helper
-        {
-            // lower_bound with projection function.
-            template <typename Iter, typename Sent, typename T, typename Comp,
-                typename Proj>
-            static constexpr Iter call(
-                Iter first, Sent last, T const& value, Comp&& comp, Proj&& proj)
-            {
-                return detail::lower_bound(first, last, value,
-                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
-            }
-
-            using another_type = upper_bound_helper;
-        };
-
-        ///////////////////////////////////////////////////////////////////////
+        // Each partition produces the same number of output elements, the
+        // input sequences are split where the merge path crosses the
+        // partition boundaries.
         template <typename ExPolicy, typename Iter1, typename Sent1,
             typename Iter2, typename Sent2, typename Iter3, typename Comp,
-            typename Proj1, typename Proj2, typename BinarySearchHelper>
-        void parallel_merge_helper(ExPolicy policy, Iter1 first1, Sent1 last1,
+            typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<ExPolicy,
+            util::in_in_out_result<Iter1, Iter2, Iter3>>::type
+        parallel_merge(ExPolicy&& policy, Iter1 first1, Sent1 last1,
             Iter2 first2, Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1,
-            Proj2&& proj2, bool range_reversal, BinarySearchHelper)
+            Proj2&& proj2)
         {
-            constexpr std::size_t threshold = 65536;
-
-            std::size_t size1 = detail::distance(first1, last1);
-            std::size_t size2 = detail::distance(first2, last2);
-
-            // Perform sequential merge if data size is smaller than threshold.
-            if (size1 + size2 <= threshold)
-            {
-                if (range_reversal)
-                {
-                    sequential_merge(first2, last2, first1, last1, dest,
-                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj2, proj2),
-                        HPX_FORWARD(Proj1, proj1));
-                }
-                else
-                {
-                    sequential_merge(first1, last1, first2, last2, dest,
-                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj1, proj1),
-                        HPX_FORWARD(Proj2, proj2));
-                }
-                return;
-            }
-
-            // Let size1 is bigger than size2 always.
-            if (size1 < size2)
-            {
-                // For stability of algorithm, must switch binary search methods
-                // when swapping size1 and size2.
-                parallel_merge_helper(policy, first2, last2, first1, last1,
-                    dest, HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj2, proj2),
-                    HPX_FORWARD(Proj1, proj1), !range_reversal,
-                    typename BinarySearchHelper::another_type());
-                return;
-            }
-
-            HPX_ASSERT(size1 >= size2);
-            HPX_ASSERT(size1 >= 1ul);
-
-            Iter1 mid1 = first1 + size1 / 2;
-            Iter2 boundary2 = BinarySearchHelper::call(
-                first2, last2, HPX_INVOKE(proj1, *mid1), comp, proj2);
-            Iter3 target = dest + (mid1 - first1) + (boundary2 - first2);
-
-            *target = *mid1;
+            using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
 
-            hpx::future<void> fut =
-                execution::async_execute(policy.executor(), [&]() -> void {
-                    // Process left side ranges.
-                    parallel_merge_helper(policy, first1, mid1, first2,
-                        boundary2, dest, comp, proj1, proj2, range_reversal,
-                        BinarySearchHelper());
-                });
+            std::size_t const len1 = detail::distance(first1, last1);
+            std::size_t const len2 = detail::distance(first2, last2);
 
-            try
+            if (len1 + len2 == 0)
             {
-                // Process right side ranges.
-                parallel_merge_helper(policy, mid1 + 1, last1, boundary2, last2,
-                    target + 1, HPX_FORWARD(Comp, comp),
-                    HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2),
-                    range_reversal, BinarySearchHelper());
+                return util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(result_type{first1, first2, dest});
             }
-            catch (...)
-            {
-                fut.wait();
 
-                std::vector<hpx::future<void>> futures;
-                futures.reserve(2);
-                futures.emplace_back(HPX_MOVE(fut));
-                futures.emplace_back(hpx::make_exceptional_future<void>(
-                    std::current_exception()));
-
-                std::list<std::exception_ptr> errors;
-                util::detail::handle_local_exceptions<ExPolicy>::call(
-                    futures, errors);
-
-                // Not reachable.
-                HPX_ASSERT(false);
-                return;
-            }
-
-            fut.get();
-        }
-
-        template <typename ExPolicy, typename Iter1, typename Sent1,
-            typename Iter2, typename Sent2, typename Iter3, typename Comp,
-            typename Proj1, typename Proj2>
-        hpx::future<util::in_in_out_result<Iter1, Iter2, Iter3>> parallel_merge(
-            ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
-            Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1, Proj2&& proj2)
-        {
-            using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
-
-            auto f1 = [first1, last1, first2, last2, dest,
-                          policy = HPX_FORWARD(ExPolicy, policy),
+            auto f1 = [first1, len1, first2, len2, dest,
                           comp = HPX_FORWARD(Comp, comp),
                           proj1 = HPX_FORWARD(Proj1, proj1),
-                          proj2 = HPX_FORWARD(
-                              Proj2, proj2)]() mutable -> result_type {
-                try
-                {
-                    parallel_merge_helper(HPX_MOVE(policy), first1, last1,
-                        first2, last2, dest, HPX_MOVE(comp), HPX_MOVE(proj1),
-                        HPX_MOVE(proj2), false, lower_bound_helper());
-
-                    auto len1 = detail::distance(first1, last1);
-                    auto len2 = detail::distance(first2, last2);
-                    return {std::next(first1, len1), std::next(first2, len2),
-                        std::next(dest, len1 + len2)};
-                }
-                catch (...)
-                {
-                    util::detail::handle_local_exceptions<ExPolicy>::call(
-                        std::current_exception());
-                    HPX_ASSERT(false);
-                    // To silence no return statement in all control blocks
-                    auto len1 = detail::distance(first1, last1);
-                    auto len2 = detail::distance(first2, last2);
-                    return {std::next(first1, len1), std::next(first2, len2),
-                        std::next(dest, len1 + len2)};
-                }
+                          proj2 = HPX_FORWARD(Proj2, proj2)](
+                          hpx::util::counting_iterator<std::size_t> it,
+                          std::size_t part_size) mutable -> void {
+                std::size_t const diag_begin = *it;
+                std::size_t const diag_end = diag_begin + part_size;
+
+                std::size_t const begin1 = merge_path_search(first1, len1,
+                    first2, len2, diag_begin, comp, proj1, proj2);
+                std::size_t const end1 = merge_path_search(first1, len1,
+                    first2, len2, diag_end, comp, proj1, proj2);
+
+                sequential_merge(std::next(first1, begin1),
+                    std::next(first1, end1),
+                    std::next(first2, diag_begin - begin1),
+                    std::next(first2, diag_end - end1),
+                    std::next(dest, diag_begin), comp, proj1, proj2);
+            };
 
-                // Not reachable.
-                HPX_ASSERT(false);
+            auto f2 = [first1, len1, first2, len2, dest](
+                          std::vector<hpx::future<void>>&& data) mutable
+                -> result_type {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+
+                return {std::next(first1, len1), std::next(first2, len2),
+                    std::next(dest, len1 + len2)};
             };
 
-            return execution::async_execute(policy.executor(), HPX_MOVE(f1));
+            return util::partitioner<ExPolicy, result_type, void>::call(
+                HPX_FORWARD(ExPolicy, policy),
+                hpx::util::make_counting_iterator(std::size_t(0)), len1 + len2,
+                HPX_MOVE(f1), HPX_MOVE(f2));
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -447,10 +343,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
-                    return algorithm_result::get(parallel_merge(
-                        HPX_FORWARD(ExPolicy, policy), first1, last1, first2,
-                        last2, dest, HPX_FORWARD(Comp, comp),
-                        HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2)));
+                    return parallel_merge(HPX_FORWARD(ExPolicy, policy),
+                        first1, last1, first2, last2, dest,
+                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj1, proj1),
+                        HPX_FORWARD(Proj2, proj2));
                 }
                 catch (...)
                 {
@@ -539,7 +435,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             Iter middle, Sent last, Comp&& comp, Proj&& proj)
         {
             const std::size_t threshold = 65536ul;
-            HPX_ASSERT(threshold >= 5ul);
 
             std::size_t left_size = middle - first;
             std::size_t right_size = last - middle;
@@ -553,117 +448,57 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return;
             }
 
-            if (left_size >= right_size)
-            {
-                // Means that always 'pivot' < 'middle'.
-                HPX_ASSERT(left_size >= 3ul);
-
-                // Select pivot in left-side range.
-                Iter pivot = first + left_size / 2;
-                Iter boundary = lower_bound_helper::call(
-                    middle, last, HPX_INVOKE(proj, *pivot), comp, proj);
-                Iter target = pivot + (boundary - middle);
-
-                // Swap two blocks, [pivot, middle) and [middle, boundary).
-                // After this, [first, last) will be divided into three blocks,
-                //   [first, target), target, and [target+1, last).
-                // And all elements of [first, target) are less than
-                //   the thing of target.
-                // And all elements of [target+1, last) are greater or equal than
-                //   the thing of target.
-                detail::sequential_rotate(pivot, middle, boundary);
-
-                hpx::future<void> fut =
-                    execution::async_execute(policy.executor(), [&]() -> void {
-                        // Process the range which is left-side of 'target'.
-                        parallel_inplace_merge_helper(
-                            policy, first, pivot, target, comp, proj);
-                    });
+            // Split both ranges where the merge path crosses the middle of
+            // the output, which divides the work into two equal halves
+            // regardless of the distribution of the elements.
+            std::size_t const diag = (left_size + right_size) / 2;
+            std::size_t const split = merge_path_search(
+                first, left_size, middle, right_size, diag, comp, proj, proj);
 
-                try
-                {
-                    // Process the range which is right-side of 'target'.
-                    parallel_inplace_merge_helper(
-                        policy, target + 1, boundary, last, comp, proj);
-                }
-                catch (...)
-                {
-                    fut.wait();
+            Iter left_split = first + split;
+            Iter right_split = middle + (diag - split);
+            Iter target = first + diag;
 
-                    std::vector<hpx::future<void>> futures;
-                    futures.reserve(2);
-                    futures.emplace_back(HPX_MOVE(fut));
-                    futures.emplace_back(hpx::make_exceptional_future<void>(
-                        std::current_exception()));
+            // Swap two blocks, [left_split, middle) and [middle, right_split).
+            // After this, all elements of [first, target) are less than or
+            //   equal to the elements of [target, last), both ranges consist
+            //   of two sorted blocks each.
+            detail::sequential_rotate(left_split, middle, right_split);
 
-                    std::list<std::exception_ptr> errors;
-                    util::detail::handle_local_exceptions<ExPolicy>::call(
-                        futures, errors);
-
-                    // Not reachable.
-                    HPX_ASSERT(false);
-                }
+            hpx::future<void> fut =
+                execution::async_execute(policy.executor(), [&]() -> void {
+                    // Process the range which is left-side of 'target'.
+                    parallel_inplace_merge_helper(
+                        policy, first, left_split, target, comp, proj);
+                });
 
-                if (fut.valid())    // NOLINT
-                {
-                    fut.get();
-                }
+            try
+            {
+                // Process the range which is right-side of 'target'.
+                parallel_inplace_merge_helper(policy, target,
+                    target + (left_size - split), last, comp, proj);
             }
-            else    // left_size < right_size
+            catch (...)
             {
-                // Means that always 'pivot' < 'last'.
-                HPX_ASSERT(right_size >= 3ul);
-
-                // Select pivot in right-side range.
-                Iter pivot = middle + right_size / 2;
-                Iter boundary = upper_bound_helper::call(
-                    first, middle, HPX_INVOKE(proj, *pivot), comp, proj);
-                Iter target = boundary + (pivot - middle);
-
-                // Swap two blocks, [boundary, middle) and [middle, pivot+1).
-                // After this, [first, last) will be divided into three blocks,
-                //   [first, target), target, and [target+1, last).
-                // And all elements of [first, target) are less than
-                //   the thing of target.
-                // And all elements of [target+1, last) are greater or equal than
-                //   the thing of target.
-                detail::sequential_rotate(boundary, middle, pivot + 1);
-
-                hpx::future<void> fut =
-                    execution::async_execute(policy.executor(), [&]() -> void {
-                        // Process the range which is left-side of 'target'.
-                        parallel_inplace_merge_helper(
-                            policy, first, boundary, target, comp, proj);
-                    });
-
-                try
-                {
-                    // Process the range which is right-side of 'target'.
-                    parallel_inplace_merge_helper(
-                        policy, target + 1, pivot + 1, last, comp, proj);
-                }
-                catch (...)
-                {
-                    fut.wait();
+                fut.wait();
 
-                    std::vector<hpx::future<void>> futures;
-                    futures.reserve(2);
-                    futures.emplace_back(HPX_MOVE(fut));
-                    futures.emplace_back(hpx::make_exceptional_future<void>(
-                        std::current_exception()));
+                std::vector<hpx::future<void>> futures;
+                futures.reserve(2);
+                futures.emplace_back(HPX_MOVE(fut));
+                futures.emplace_back(hpx::make_exceptional_future<void>(
+                    std::current_exception()));
 
-                    std::list<std::exception_ptr> errors;
-                    util::detail::handle_local_exceptions<ExPolicy>::call(
-                        futures, errors);
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_local_exceptions<ExPolicy>::call(
+                    futures, errors);
 
-                    // Not reachable.
-                    HPX_ASSERT(false);
-                }
+                // Not reachable.
+                HPX_ASSERT(false);
+            }
 
-                if (fut.valid())    // NOLINT
-                {
-                    fut.get();
-                }
+            if (fut.valid())    // NOLINT
+            {
+                fut.get();
             }
         }
 
@@ -0,0 +1,308 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Merges the sorted ranges held by \a runs into one sorted range
+    /// beginning at \a dest. The order of equivalent elements is preserved:
+    /// equivalent elements appear in the order of the ranges holding them
+    /// and in their order within each range. The destination range cannot
+    /// overlap with any of the input ranges.
+    ///
+    /// The output is split into parts of the same length by multi-sequence
+    /// selection, the parts are merged concurrently using a loser tree.
+    ///
+    /// \note   Complexity: Performs O(N log(K)) applications of the
+    ///         comparison \a comp, where N is the total number of elements
+    ///         and K is the number of ranges in \a runs.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Rng         The type of the range of source ranges (deduced).
+    ///                     The iterators of the source ranges must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a merge_k requires \a Comp to meet the
+    ///                     requirements of \a CopyConstructible. This defaults
+    ///                     to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param runs         Refers to the sorted ranges of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The types \a Type1 and \a Type2 must be such
+    ///                     that the iterators of the source ranges can be
+    ///                     dereferenced and then implicitly converted to
+    ///                     both \a Type1 and \a Type2
+    ///
+    /// The assignments in the parallel \a merge_k algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a merge_k algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a merge_k algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise.
+    ///           The \a merge_k algorithm returns the destination iterator to
+    ///           the end of the constructed range.
+    ///
+    template <typename ExPolicy, typename Rng, typename RandIter,
+        typename Comp = hpx::parallel::v1::detail::less>
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        RandIter>::type
+    merge_k(ExPolicy&& policy, Rng&& runs, RandIter dest,
+        Comp&& comp = Comp());
+
+    /// Merges the sorted ranges held by \a runs into one sorted range
+    /// beginning at \a dest. The order of equivalent elements is preserved:
+    /// equivalent elements appear in the order of the ranges holding them
+    /// and in their order within each range. The destination range cannot
+    /// overlap with any of the input ranges.
+    ///
+    /// \note   Complexity: Performs O(N log(K)) applications of the
+    ///         comparison \a comp, where N is the total number of elements
+    ///         and K is the number of ranges in \a runs.
+    ///
+    /// \tparam Rng         The type of the range of source ranges (deduced).
+    ///                     The iterators of the source ranges must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>
+    ///
+    /// \param runs         Refers to the sorted ranges of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The types \a Type1 and \a Type2 must be such
+    ///                     that the iterators of the source ranges can be
+    ///                     dereferenced and then implicitly converted to
+    ///                     both \a Type1 and \a Type2
+    ///
+    /// \returns  The \a merge_k algorithm returns a \a RandIter.
+    ///           The \a merge_k algorithm returns the destination iterator to
+    ///           the end of the constructed range.
+    ///
+    template <typename Rng, typename RandIter,
+        typename Comp = hpx::parallel::v1::detail::less>
+    RandIter merge_k(Rng&& runs, RandIter dest, Comp&& comp = Comp());
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/local/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/merge_k.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/range.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // merge_k
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // the iterator type of the ranges held by Rng
+        template <typename Rng>
+        using merge_k_iterator_t = std::decay_t<decltype(hpx::util::begin(
+            *hpx::util::begin(std::declval<Rng&>())))>;
+
+        template <typename Rng>
+        std::vector<util::range<merge_k_iterator_t<Rng>>> get_merge_k_runs(
+            Rng&& runs)
+        {
+            std::vector<util::range<merge_k_iterator_t<Rng>>> result;
+            for (auto&& run : runs)
+            {
+                result.emplace_back(hpx::util::begin(run), hpx::util::end(run));
+            }
+            return result;
+        }
+
+        struct merge_k_copy
+        {
+            template <typename OutIter, typename Iter>
+            void operator()(OutIter& dest, Iter& it) const
+            {
+                *dest = *it;
+            }
+        };
+
+        template <typename RandIter>
+        struct merge_k : public detail::algorithm<merge_k<RandIter>, RandIter>
+        {
+            merge_k()
+              : merge_k::algorithm("merge_k")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp>
+            static RandIter sequential(ExPolicy&& policy,
+                std::vector<util::range<Iter>> const& runs, RandIter dest,
+                Comp&& comp)
+            {
+                return merge_k_runs(HPX_FORWARD(ExPolicy, policy), runs, dest,
+                    comp, merge_k_copy());
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandIter>::type
+            parallel(ExPolicy&& policy, std::vector<util::range<Iter>> runs,
+                RandIter dest, Comp&& comp)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, RandIter>;
+
+                if constexpr (hpx::is_async_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy, runs = HPX_MOVE(runs), dest,
+                            comp = HPX_FORWARD(Comp, comp)]() mutable
+                        -> RandIter {
+                            return merge_k_runs(
+                                policy, runs, dest, comp, merge_k_copy());
+                        }));
+                }
+                else
+                {
+                    try
+                    {
+                        return algorithm_result::get(merge_k_runs(
+                            HPX_FORWARD(ExPolicy, policy), runs, dest, comp,
+                            merge_k_copy()));
+                    }
+                    catch (...)
+                    {
+                        return algorithm_result::get(
+                            detail::handle_exception<ExPolicy, RandIter>::call(
+                                std::current_exception()));
+                    }
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace experimental {
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::experimental::merge_k
+    inline constexpr struct merge_k_t final
+      : hpx::detail::tag_parallel_algorithm<merge_k_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Rng, typename RandIter,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_range<Rng>::value &&
+                hpx::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(merge_k_t, ExPolicy&& policy, Rng&& runs,
+            RandIter dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                (hpx::traits::is_random_access_iterator<
+                    hpx::parallel::v1::detail::merge_k_iterator_t<Rng>>::value),
+                "Requires at least random access iterator.");
+            static_assert(
+                (hpx::traits::is_random_access_iterator<RandIter>::value),
+                "Requires at least random access iterator.");
+
+            return hpx::parallel::v1::detail::merge_k<RandIter>().call(
+                HPX_FORWARD(ExPolicy, policy),
+                hpx::parallel::v1::detail::get_merge_k_runs(runs), dest,
+                HPX_FORWARD(Comp, comp));
+        }
+
+        // clang-format off
+        template <typename Rng, typename RandIter,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range<Rng>::value &&
+                hpx::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(
+            merge_k_t, Rng&& runs, RandIter dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                (hpx::traits::is_random_access_iterator<
+                    hpx::parallel::v1::detail::merge_k_iterator_t<Rng>>::value),
+                "Requires at least random access iterator.");
+            static_assert(
+                (hpx::traits::is_random_access_iterator<RandIter>::value),
+                "Requires at least random access iterator.");
+
+            return hpx::parallel::v1::detail::merge_k<RandIter>().call(
+                hpx::execution::seq,
+                hpx::parallel::v1::detail::get_merge_k_runs(runs), dest,
+                HPX_FORWARD(Comp, comp));
+        }
+    } merge_k{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
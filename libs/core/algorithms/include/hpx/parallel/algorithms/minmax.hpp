@@ -376,6 +376,7 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -396,34 +397,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // min_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        constexpr FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            auto smallest = it;
-
-            element_type value = HPX_INVOKE(proj, *smallest);
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, value))
-                    {
-                        smallest = curr;
-                        value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return smallest;
-        }
-
-        ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct min_element : public detail::algorithm<min_element<Iter>, Iter>
         {
@@ -448,15 +421,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         decltype(smallest)>::value_type>;
 
                 element_type value = HPX_INVOKE(proj, *smallest);
-                util::loop_n<std::decay_t<ExPolicy>>(
-                    ++it, count - 1, [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, **curr);
-                        if (HPX_INVOKE(f, curr_value, value))
-                        {
-                            smallest = *curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
+                for (++it; --count != 0; ++it)
+                {
+                    element_type curr_value = HPX_INVOKE(proj, **it);
+                    if (HPX_INVOKE(f, curr_value, value))
+                    {
+                        smallest = *it;
+                        value = HPX_MOVE(curr_value);
+                    }
+                }
 
                 return smallest;
             }
@@ -469,28 +442,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename FwdIter, typename Sent,
                 typename F, typename Proj>
             static FwdIter sequential(
-                ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                if (first == last)
-                    return first;
-
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                auto smallest = first;
-
-                element_type value = HPX_INVOKE(proj, *smallest);
-                util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (HPX_INVOKE(f, curr_value, value))
-                        {
-                            smallest = curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return smallest;
+                return sequential_min_element<std::decay_t<ExPolicy>>(
+                    first, last, f, proj);
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -506,10 +461,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         FwdIter>::get(HPX_MOVE(first));
                 }
 
-                auto f1 = [f, proj, policy](
+                auto f1 = [f, proj](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_min_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_min_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 = [policy, f = HPX_FORWARD(F, f),
                               proj = HPX_FORWARD(Proj, proj)](
@@ -560,34 +515,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // max_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        constexpr FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            auto largest = it;
-
-            element_type value = HPX_INVOKE(proj, *largest);
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (!HPX_INVOKE(f, curr_value, value))
-                    {
-                        largest = curr;
-                        value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return largest;
-        }
-
-        ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct max_element : public detail::algorithm<max_element<Iter>, Iter>
         {
@@ -611,15 +538,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         decltype(largest)>::value_type>;
 
                 element_type value = HPX_INVOKE(proj, *largest);
-                util::loop_n<std::decay_t<ExPolicy>>(
-                    ++it, count - 1, [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, **curr);
-                        if (!HPX_INVOKE(f, curr_value, value))
-                        {
-                            largest = *curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
+                for (++it; --count != 0; ++it)
+                {
+                    element_type curr_value = HPX_INVOKE(proj, **it);
+                    if (!HPX_INVOKE(f, curr_value, value))
+                    {
+                        largest = *it;
+                        value = HPX_MOVE(curr_value);
+                    }
+                }
 
                 return largest;
             }
@@ -632,28 +559,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename FwdIter, typename Sent,
                 typename F, typename Proj>
             static FwdIter sequential(
-                ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                if (first == last)
-                    return first;
-
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                auto largest = first;
-
-                element_type value = HPX_INVOKE(proj, *largest);
-                util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (!HPX_INVOKE(f, curr_value, value))
-                        {
-                            largest = curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return largest;
+                return sequential_max_element<std::decay_t<ExPolicy>>(
+                    first, last, f, proj);
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -669,10 +578,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         FwdIter>::get(HPX_MOVE(first));
                 }
 
-                auto f1 = [f, proj, policy](
+                auto f1 = [f, proj](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_max_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_max_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 = [policy, f = HPX_FORWARD(F, f),
                               proj = HPX_FORWARD(Proj, proj)](
@@ -723,40 +632,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // minmax_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        minmax_element_result<FwdIter> sequential_minmax_element(ExPolicy&&,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
-        {
-            minmax_element_result<FwdIter> result = {it, it};
-
-            if (count == 0 || count == 1)
-                return result;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            element_type min_value = HPX_INVOKE(proj, *it);
-            element_type max_value = min_value;
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, min_value))
-                    {
-                        result.min = curr;
-                        min_value = curr_value;
-                    }
-
-                    if (!HPX_INVOKE(f, curr_value, max_value))
-                    {
-                        result.max = curr;
-                        max_value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return result;
-        }
-
         template <typename Iter>
         struct minmax_element
           : public detail::algorithm<minmax_element<Iter>,
@@ -782,24 +657,22 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 element_type min_value = HPX_INVOKE(proj, *result.min);
                 element_type max_value = HPX_INVOKE(proj, *result.max);
-                util::loop_n<std::decay_t<ExPolicy>>(
-                    ++it, count - 1, [&](PairIter const& curr) -> void {
-                        element_type curr_min_value =
-                            HPX_INVOKE(proj, *curr->min);
-                        if (HPX_INVOKE(f, curr_min_value, min_value))
-                        {
-                            result.min = curr->min;
-                            min_value = HPX_MOVE(curr_min_value);
-                        }
-
-                        element_type curr_max_value =
-                            HPX_INVOKE(proj, *curr->max);
-                        if (!HPX_INVOKE(f, curr_max_value, max_value))
-                        {
-                            result.max = curr->max;
-                            max_value = HPX_MOVE(curr_max_value);
-                        }
-                    });
+                for (++it; --count != 0; ++it)
+                {
+                    element_type curr_min_value = HPX_INVOKE(proj, *it->min);
+                    if (HPX_INVOKE(f, curr_min_value, min_value))
+                    {
+                        result.min = it->min;
+                        min_value = HPX_MOVE(curr_min_value);
+                    }
+
+                    element_type curr_max_value = HPX_INVOKE(proj, *it->max);
+                    if (!HPX_INVOKE(f, curr_max_value, max_value))
+                    {
+                        result.max = it->max;
+                        max_value = HPX_MOVE(curr_max_value);
+                    }
+                }
 
                 return result;
             }
@@ -812,37 +685,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename FwdIter, typename Sent,
                 typename F, typename Proj>
             static minmax_element_result<FwdIter> sequential(
-                ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                auto min = first, max = first;
-
-                if (first == last || ++first == last)
-                {
-                    return minmax_element_result<FwdIter>{min, max};
-                }
-
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                element_type min_value = HPX_INVOKE(proj, *min);
-                element_type max_value = HPX_INVOKE(proj, *max);
-                util::loop(HPX_FORWARD(ExPolicy, policy), first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (HPX_INVOKE(f, curr_value, min_value))
-                        {
-                            min = curr;
-                            min_value = curr_value;
-                        }
-
-                        if (!HPX_INVOKE(f, curr_value, max_value))
-                        {
-                            max = curr;
-                            max_value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return minmax_element_result<FwdIter>{min, max};
+                return sequential_minmax_element<std::decay_t<ExPolicy>>(
+                    first, last, f, proj);
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -861,10 +707,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         result_type>::get(HPX_MOVE(result));
                 }
 
-                auto f1 = [f, proj, policy](FwdIter it, std::size_t part_count)
+                auto f1 = [f, proj](FwdIter it, std::size_t part_count)
                     -> minmax_element_result<FwdIter> {
-                    return sequential_minmax_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_minmax_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 =
                     [policy, f = HPX_FORWARD(F, f),
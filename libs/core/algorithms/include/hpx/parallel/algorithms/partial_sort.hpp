@@ -119,6 +119,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/sample_select.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -343,7 +344,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
         ///////////////////////////////////////////////////////////////////////
         ///
-        /// Internal function to divide and sort the ranges
+        /// Internal function to select and sort the smallest elements
         ///
         /// \param first : iterator to the first element
         /// \param middle: iterator defining the last element to be sorted
@@ -351,28 +352,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \param level : level of depth from the top level call
         /// \param comp : object for to Comp elements
         ///
-        struct sort_thread_helper
-        {
-            template <typename... Ts>
-            decltype(auto) operator()(Ts&&... ts) const
-            {
-                return sort_thread(HPX_FORWARD(Ts, ts)...);
-            }
-        };
-
-        template <typename ExPolicy, typename Iter, typename Comp>
-        hpx::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-            Iter middle, Iter last, std::uint32_t level, Comp&& comp = Comp());
-
-        struct parallel_partial_sort_helper
-        {
-            template <typename... Ts>
-            decltype(auto) operator()(Ts&&... ts) const
-            {
-                return parallel_partial_sort(HPX_FORWARD(Ts, ts)...);
-            }
-        };
-
+        /// The smallest elements are moved to the front of the range by the
+        /// parallel selection, only those are sorted afterwards.
+        ///
         template <typename ExPolicy, typename Iter, typename Comp>
         hpx::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
             Iter middle, Iter last, std::uint32_t level, Comp&& comp)
@@ -386,59 +368,36 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return hpx::make_ready_future(last);
             }
 
-            if (nmid < 4096 || level < 12)
+            if (std::size_t(nelem) < sample_select_limit)
             {
                 recursive_partial_sort(first, middle, last, level, comp);
                 return hpx::make_ready_future(last);
             }
 
-            Iter c_last = filter(first, last, comp);
-            if (middle >= c_last)
-            {
-                // figure out the chunk size to use
-                std::size_t const cores = execution::processing_units_count(
-                    policy.parameters(), policy.executor());
-
-                // number of elements to sort
-                std::size_t chunk_size = execution::get_chunk_size(
-                    policy.parameters(), policy.executor(), 0, cores, nelem);
-
-                hpx::future<Iter> left = execution::async_execute(
-                    policy.executor(), sort_thread_helper(), policy, first,
-                    c_last, comp, chunk_size);
-
-                hpx::future<Iter> right;
-                if (middle != c_last)
-                {
-                    right = execution::async_execute(policy.executor(),
-                        parallel_partial_sort_helper(), policy, c_last + 1,
-                        middle, last, level - 1, comp);
-                }
-                else
-                {
-                    right = hpx::make_ready_future(last);
-                }
+            sample_select(policy, first, middle, last, comp);
 
-                return hpx::dataflow(
-                    [last](hpx::future<Iter>&& left,
-                        hpx::future<Iter>&& right) -> Iter {
-                        if (left.has_exception() || right.has_exception())
-                        {
-                            std::list<std::exception_ptr> errors;
-                            if (left.has_exception())
-                                errors.push_back(left.get_exception_ptr());
-                            if (right.has_exception())
-                                errors.push_back(right.get_exception_ptr());
-
-                            throw exception_list(HPX_MOVE(errors));
-                        }
-                        return last;
-                    },
-                    HPX_MOVE(left), HPX_MOVE(right));
+            if (nmid < 4096)
+            {
+                std::sort(first, middle, comp);
+                return hpx::make_ready_future(last);
             }
 
-            return parallel_partial_sort(HPX_FORWARD(ExPolicy, policy), first,
-                middle, c_last, level - 1, HPX_FORWARD(Comp, comp));
+            // figure out the chunk size to use
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            // number of elements to sort
+            std::size_t chunk_size = execution::get_chunk_size(
+                policy.parameters(), policy.executor(), 0, cores, nmid);
+
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [last](hpx::future<Iter>&& sorted) -> Iter {
+                    sorted.get();
+                    return last;
+                },
+                sort_thread(std::decay_t<ExPolicy>(policy), first, middle,
+                    std::decay_t<Comp>(comp), chunk_size));
         }
         /// \endcond NOINTERNAL
     }    // end namespace detail
@@ -478,8 +478,6 @@ namespace hpx {
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
-#else
-#include <memory>
 #endif
 
 #include <algorithm>
@@ -488,6 +486,7 @@ namespace hpx {
 #include <exception>
 #include <iterator>
 #include <list>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -1546,7 +1545,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 FwdIter2 dest_true, FwdIter3 dest_false, Pred&& pred,
                 Proj&& proj)
             {
-                using zip_iterator = hpx::util::zip_iterator<FwdIter1, bool*>;
                 using result = util::detail::algorithm_result<ExPolicy,
                     hpx::tuple<FwdIter1, FwdIter2, FwdIter3>>;
                 using difference_type =
@@ -1562,6 +1560,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 difference_type count =
                     detail::advance_and_get_distance(last_iter, last);
 
+                // The flags are written only for the partitions which have
+                // to be counted before their output positions are known, and
+                // are read back when these partitions are copied. This way
+                // the predicate is evaluated exactly once for each element.
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
                 std::shared_ptr<bool[]> flags(new bool[count]);
 #else
@@ -1571,22 +1573,20 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
+                using zip_iterator = hpx::util::zip_iterator<FwdIter1, bool*>;
                 using scan_partitioner_type = util::scan_partitioner<ExPolicy,
                     hpx::tuple<FwdIter1, FwdIter2, FwdIter3>,
-                    output_iterator_offset>;
+                    output_iterator_offset, void,
+                    util::scan_partitioner_single_pass_tag>;
 
                 // Note: replacing the invoke() with HPX_INVOKE()
                 // below makes gcc generate errors
-                auto f1 = [pred = HPX_FORWARD(Pred, pred),
-                              proj = HPX_FORWARD(Proj, proj)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) -> output_iterator_offset {
+                auto f1 = [pred, proj](zip_iterator part_begin,
+                              std::size_t part_size) mutable
+                    -> output_iterator_offset {
                     std::size_t true_count = 0;
-
-                    // MSVC complains if pred or proj is captured by ref below
                     util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [pred, proj, &true_count](
-                            zip_iterator it) mutable -> void {
+                        [&pred, proj, &true_count](zip_iterator it) mutable {
                             bool f = hpx::util::invoke(
                                 pred, hpx::util::invoke(proj, get<0>(*it)));
 
@@ -1605,31 +1605,43 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         get<0>(prev_sum) + get<0>(curr),
                         get<1>(prev_sum) + get<1>(curr));
                 };
-                auto f3 = [dest_true, dest_false, flags](
+                auto f3 = [dest_true, dest_false, flags,
+                              pred = HPX_FORWARD(Pred, pred),
+                              proj = HPX_FORWARD(Proj, proj)](
                               zip_iterator part_begin, std::size_t part_size,
-                              output_iterator_offset val) mutable -> void {
+                              output_iterator_offset val,
+                              bool counted) mutable -> output_iterator_offset {
                     HPX_UNUSED(flags);
-                    output_iterator_offset offset = val;
-                    std::size_t count_true = get<0>(offset);
-                    std::size_t count_false = get<1>(offset);
-                    std::advance(dest_true, count_true);
-                    std::advance(dest_false, count_false);
+
+                    FwdIter2 out_true = dest_true;
+                    FwdIter3 out_false = dest_false;
+                    std::advance(out_true, get<0>(val));
+                    std::advance(out_false, get<1>(val));
 
                     util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&dest_true, &dest_false](zip_iterator it) mutable {
-                            if (get<1>(*it))
-                                *dest_true++ = get<0>(*it);
+                        [&pred, proj, &out_true, &out_false, &val, counted](
+                            zip_iterator it) mutable {
+                            if (counted ?
+                                    get<1>(*it) :
+                                    hpx::util::invoke(pred,
+                                        hpx::util::invoke(proj, get<0>(*it))))
+                            {
+                                *out_true++ = get<0>(*it);
+                                ++get<0>(val);
+                            }
                             else
-                                *dest_false++ = get<0>(*it);
+                            {
+                                *out_false++ = get<0>(*it);
+                                ++get<1>(val);
+                            }
                         });
+                    return val;
                 };
 
-                auto f4 = [last_iter, dest_true, dest_false, flags](
+                auto f4 = [last_iter, dest_true, dest_false](
                               std::vector<output_iterator_offset>&& items,
                               std::vector<hpx::future<void>>&&) mutable
                     -> hpx::tuple<FwdIter1, FwdIter2, FwdIter3> {
-                    HPX_UNUSED(flags);
-
                     output_iterator_offset count_pair = items.back();
                     std::size_t count_true = get<0>(count_pair);
                     std::size_t count_false = get<1>(count_pair);
@@ -1642,12 +1654,13 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return scan_partitioner_type::call(
                     HPX_FORWARD(ExPolicy, policy),
                     make_zip_iterator(first, flags.get()), count, init,
-                    // step 1 performs first part of scan algorithm
+                    // step 1 counts the elements of a partition if its
+                    // offsets are not known yet
                     HPX_MOVE(f1),
                     // step 2 propagates the partition results from left
                     // to right
                     HPX_MOVE(f2),
-                    // step 3 runs final accumulation on each partition
+                    // step 3 copies the elements of each partition
                     HPX_MOVE(f3),
                     // step 4 use this return value
                     HPX_MOVE(f4));
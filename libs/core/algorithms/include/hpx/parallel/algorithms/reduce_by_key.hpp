@@ -7,34 +7,32 @@
 /// \file parallel/algorithms/reduce_by_key.hpp
 
 #pragma once
-//
+
 #include <hpx/local/config.hpp>
-#include <hpx/execution/executors/execution.hpp>
-//
-#include <hpx/datastructures/tuple.hpp>
-#include <hpx/iterator_support/range.hpp>
-#include <hpx/iterator_support/transform_iterator.hpp>
-#include <hpx/parallel/algorithms/for_each.hpp>
-#include <hpx/parallel/algorithms/inclusive_scan.hpp>
-#include <hpx/parallel/algorithms/sort.hpp>
-#include <hpx/parallel/container_algorithms/copy.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/execution.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/result_types.hpp>
-#include <hpx/parallel/util/zip_iterator.hpp>
-//
-#include <cstdint>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
 #include <functional>
+#include <iterator>
+#include <list>
 #include <type_traits>
 #include <utility>
 #include <vector>
-//
-/// \cond NOINTERNAL
-#ifdef EXTRA_DEBUG
-#include <iostream>
-#define debug_reduce_by_key(a) std::cout << a
-#else
-#define debug_reduce_by_key(a)
-#endif
-/// \endcond
 
 namespace hpx { namespace parallel { inline namespace v1 {
     ///////////////////////////////////////////////////////////////////////////
@@ -42,164 +40,87 @@ namespace hpx { namespace parallel { inline namespace v1 {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // -------------------------------------------------------------------
-        // simple iterator helper object for access to prev/next items
-        // -------------------------------------------------------------------
-        struct reduce_stencil_transformer
-        {
-            // declare result type as a template
-            template <typename T>
-            struct result;
-
-            // specialize result for iterator type
-            template <typename This, typename Iterator>
-            struct result<This(Iterator)>
-            {
-                typedef typename std::iterator_traits<Iterator>::reference
-                    element_type;
-                typedef hpx::tuple<element_type, element_type, element_type>
-                    type;
-            };
-
-            // call operator for stencil transform
-            // it will dereference tuple(it-1, it, it+1)
-            template <typename Iterator>
-            typename result<reduce_stencil_transformer(Iterator)>::type
-            operator()(Iterator const& it) const
-            {
-                typedef
-                    typename result<reduce_stencil_transformer(Iterator)>::type
-                        type;
-                return type(*std::prev(it), *it, *std::next(it));
-            }
-        };
+        // Minimal number of elements each task reduces.
+        static constexpr std::size_t reduce_by_key_limit_per_task = 16384;
 
         // -------------------------------------------------------------------
-        // transform iterator using reduce_stencil_transformer helper
+        // result of the local reduction of a chunk of keys
         // -------------------------------------------------------------------
-        template <typename Iterator,
-            typename Transformer = detail::reduce_stencil_transformer>
-        class reduce_stencil_iterator
-          : public hpx::util::transform_iterator<Iterator, Transformer>
+        template <typename Key, typename Value>
+        struct reduce_by_key_chunk
         {
-        private:
-            typedef hpx::util::transform_iterator<Iterator, Transformer>
-                base_type;
+            // the segments which end inside the chunk
+            std::vector<Key> keys;
+            std::vector<Value> values;
 
-        public:
-            reduce_stencil_iterator() {}
+            // the first segment continues the last one of the previous chunk
+            bool continues = false;
 
-            explicit reduce_stencil_iterator(Iterator const& it)
-              : base_type(it, Transformer())
-            {
-            }
+            // the reduction of the last segment if it continues in the next
+            // chunk (carry-out)
+            bool open = false;
+            Value open_value{};
 
-            reduce_stencil_iterator(Iterator const& it, Transformer const& t)
-              : base_type(it, t)
-            {
-            }
+            // the position of the first segment of the chunk in the output
+            std::size_t offset = 0;
         };
 
-        template <typename Iterator, typename Transformer>
-        inline reduce_stencil_iterator<Iterator, Transformer>
-        make_reduce_stencil_iterator(Iterator const& it, Transformer const& t)
-        {
-            return reduce_stencil_iterator<Iterator, Transformer>(it, t);
-        }
-
         // -------------------------------------------------------------------
-        // state of a reduce by key step
+        // Reduces the segments of equal consecutive keys in [first, last) of
+        // the overall sequence [0, count), calls emit for each segment which
+        // ends in this range. Each key is read once (the keys bordering the
+        // range are compared as well). Returns the reduction of the last
+        // segment if it continues after last.
         // -------------------------------------------------------------------
-        struct reduce_key_series_states
+        template <typename RanIter, typename RanIter2, typename Compare,
+            typename Func, typename Emit, typename Chunk>
+        void reduce_by_key_segments(RanIter keys, RanIter2 values,
+            std::size_t first, std::size_t last, std::size_t count,
+            Compare& comp, Func& func, Emit&& emit, Chunk& chunk)
         {
-            bool start;    // START of a segment
-            bool end;      // END of a segment
-            reduce_key_series_states(bool s = false, bool e = false)
-              : start(s)
-              , end(e)
-            {
-            }
-        };
+            using key_type = typename std::iterator_traits<RanIter>::value_type;
+            using value_type =
+                typename std::iterator_traits<RanIter2>::value_type;
 
-        // -------------------------------------------------------------------
-        // callable that actually computes the state using the stencil iterator
-        // -------------------------------------------------------------------
-        template <typename Transformer, typename StencilIterType,
-            typename KeyStateIterType, typename Compare>
-        struct reduce_stencil_generate
-        {
-            typedef typename Transformer::template result<Transformer(
-                StencilIterType)>::element_type element_type;
-            typedef typename Transformer::template result<Transformer(
-                StencilIterType)>::type tuple_type;
-            typedef typename std::iterator_traits<KeyStateIterType>::reference
-                KeyStateType;
+            HPX_ASSERT(first < last && last <= count);
 
-            reduce_stencil_generate() {}
+            chunk.continues = first != 0 && comp(keys[first - 1], keys[first]);
 
-            void operator()(const tuple_type& value, KeyStateType& kiter,
-                const Compare& comp) const
+            key_type key = keys[first];
+            value_type value = values[first];
+            for (std::size_t i = first + 1; i != last; ++i)
             {
-                // resolves to a tuple of values for *(it-1), *it, *(it+1)
-
-                element_type left = hpx::get<0>(value);
-                element_type mid = hpx::get<1>(value);
-                element_type right = hpx::get<2>(value);
-
-                // we need to determine which of three states this
-                // index is. It can be:
-                // 1. Middle of a set of equivalent keys.
-                // 2. Start of a set of equivalent keys.
-                // 3. End of a set of equivalent keys.
-                // 4. Both the start and end of a set of keys
-
+                if (comp(key, keys[i]))
+                {
+                    value = func(value, values[i]);
+                }
+                else
                 {
-                    const bool leftMatches(comp(left, mid));
-                    const bool rightMatches(comp(mid, right));
-                    kiter =
-                        reduce_key_series_states(!leftMatches, !rightMatches);
+                    emit(HPX_MOVE(key), HPX_MOVE(value));
+                    key = keys[i];
+                    value = values[i];
                 }
             }
-        };
 
-        // -------------------------------------------------------------------
-        // helper that extracts the final output iterators from copy_if
-        // -------------------------------------------------------------------
-        // Zip iterator has 3 iterators inside
-        // Iter1, key type : Iter2, value type : Iter3, state type
-        template <typename ZIter, typename iKey, typename iVal>
-        util::in_out_result<iKey, iVal> make_pair_result(
-            ZIter zipiter, iKey key_start, iVal val_start)
-        {
-            // the iterator we want is 'second' part of pair type (from copy_if)
-            auto t = zipiter.out.get_iterator_tuple();
-            iKey key_end = hpx::get<0>(t);
-            return util::in_out_result<iKey, iVal>{key_end,
-                std::next(val_start, std::distance(key_start, key_end))};
-        }
-
-        // async version that returns future<pair> from future<zip_iterator<blah>>
-        template <typename ZIter, typename iKey, typename iVal>
-        hpx::future<util::in_out_result<iKey, iVal>> make_pair_result(
-            hpx::future<ZIter>&& ziter, iKey key_start, iVal val_start)
-        {
-            typedef util::in_out_result<iKey, iVal> result_type;
-
-            return hpx::make_future<result_type>(
-                HPX_MOVE(ziter), [=](ZIter zipiter) {
-                    auto t = zipiter.second.get_iterator_tuple();
-                    iKey key_end = hpx::get<0>(t);
-                    return result_type{key_end,
-                        std::next(
-                            val_start, std::distance(key_start, key_end))};
-                });
+            if (last == count || !comp(key, keys[last]))
+            {
+                emit(HPX_MOVE(key), HPX_MOVE(value));
+            }
+            else
+            {
+                chunk.open = true;
+                chunk.open_value = HPX_MOVE(value);
+            }
         }
 
         // -------------------------------------------------------------------
-        // The main algorithm is implemented here, it replaces any async
-        // execution policy with a non async one so that no waits are
-        // necessry on the internal algorithms. Async execution is handled
-        // by the wrapper layer that calls this.
+        // The keys are split into one chunk per task. Each chunk is reduced
+        // locally, the segments spanning chunk boundaries are fixed up
+        // sequentially afterwards by combining the carry-out of a chunk with
+        // the first segment of the next one. A single chunk is written to the
+        // output directly, otherwise the reduced segments of each chunk are
+        // copied once all chunks have been reduced, which allows for the
+        // output to alias the input.
         // -------------------------------------------------------------------
         template <typename ExPolicy, typename RanIter, typename RanIter2,
             typename FwdIter1, typename FwdIter2, typename Compare,
@@ -209,154 +130,115 @@ namespace hpx { namespace parallel { inline namespace v1 {
             RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
             Compare&& comp, Func&& func)
         {
-            using namespace hpx::parallel::v1::detail;
-            using namespace hpx::util;
-
-            // we need to determine based on the keys what is the keystate for
-            // each key. The states are start, middle, end of a series and the special
-            // state start and end of the sequence
-            std::vector<reduce_key_series_states> key_state;
-            using keystate_iter_type =
-                std::vector<reduce_key_series_states>::iterator;
-            using reducebykey_iter = detail::reduce_stencil_iterator<RanIter,
-                reduce_stencil_transformer>;
-            using element_type =
-                typename std::iterator_traits<RanIter>::reference;
-            using zip_ref = typename zip_iterator<reducebykey_iter,
-                keystate_iter_type>::reference;
-            //
-            const std::uint64_t number_of_keys =
-                std::distance(key_first, key_last);
-            //
-            key_state.assign(number_of_keys, reduce_key_series_states());
-            {
-                reduce_stencil_transformer r_s_t;
-                reducebykey_iter reduce_begin =
-                    make_reduce_stencil_iterator(key_first, r_s_t);
-                reducebykey_iter reduce_end =
-                    make_reduce_stencil_iterator(key_last, r_s_t);
+            using key_type = typename std::iterator_traits<RanIter>::value_type;
+            using value_type =
+                typename std::iterator_traits<RanIter2>::value_type;
+            using chunk_type = reduce_by_key_chunk<key_type, value_type>;
 
-                // FIXME: handle cases number_of_keys == 0 and
-                //        number_of_keys == 1
+            std::size_t const count = std::distance(key_first, key_last);
+            HPX_ASSERT(count != 0);
 
-                if (number_of_keys == 2)
-                {
-                    // for two entries, one is a start, the other an end,
-                    // if they are different, then they are both start/end
-                    element_type left = *key_first;
-                    element_type right = *std::next(key_first);
-                    key_state[0] =
-                        reduce_key_series_states(true, !comp(left, right));
-                    key_state[1] =
-                        reduce_key_series_states(!comp(left, right), true);
-                }
-                else
+            std::size_t num_chunks = 1;
+            if constexpr (!hpx::is_sequenced_execution_policy_v<ExPolicy>)
+            {
+                std::size_t const cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+
+                num_chunks = (std::min)(cores,
+                    (count + reduce_by_key_limit_per_task - 1) /
+                        reduce_by_key_limit_per_task);
+                if (num_chunks == 0)
                 {
-                    // do the first and last elements by hand to simplify the iterator
-                    // traversal as there is no prev/next for first/last
-                    element_type elem0 = *key_first;
-                    element_type elem1 = *std::next(key_first);
-                    key_state[0] =
-                        reduce_key_series_states(true, elem0 != elem1);
-                    // middle elements
-                    reduce_stencil_generate<reduce_stencil_transformer, RanIter,
-                        keystate_iter_type, Compare>
-                        kernel;
-                    hpx::for_each(policy(hpx::execution::non_task),
-                        make_zip_iterator(
-                            reduce_begin + 1, key_state.begin() + 1),
-                        make_zip_iterator(reduce_end - 1, key_state.end() - 1),
-                        [&kernel, &comp](zip_ref ref) {
-                            kernel(hpx::get<0>(ref), hpx::get<1>(ref), comp);
-                        });
-                    // Last element
-                    element_type elemN = *std::prev(key_last);
-                    element_type elemn = *std::prev(std::prev(key_last));
-                    key_state.back() =
-                        reduce_key_series_states(elemN != elemn, true);
+                    num_chunks = 1;
                 }
             }
+
+            if (num_chunks == 1)
             {
-                using zip_iterator_in = zip_iterator<RanIter2,
-                    std::vector<reduce_key_series_states>::iterator>;
-                using zip_type_in = typename zip_iterator_in::value_type;
-
-                using zip_iterator_vout = zip_iterator<FwdIter2,
-                    std::vector<reduce_key_series_states>::iterator>;
-
-                using value_type =
-                    typename std::iterator_traits<RanIter2>::value_type;
-
-                zip_iterator_in states_begin = make_zip_iterator(
-                    values_first, hpx::util::begin(key_state));
-                zip_iterator_in states_end = make_zip_iterator(
-                    values_first + number_of_keys, hpx::util::end(key_state));
-                zip_iterator_vout states_out_begin = make_zip_iterator(
-                    values_output, hpx::util::begin(key_state));
-                //
-
-                zip_type_in initial;
-                //
-                using lambda_type =
-                    hpx::tuple<value_type, reduce_key_series_states>;
-                hpx::inclusive_scan(
-                    policy(hpx::execution::non_task), states_begin, states_end,
-                    states_out_begin,
-                    // B is the current entry, A is the one passed in from 'previous'
-                    [&func](zip_type_in a, zip_type_in b) -> lambda_type {
-                        value_type a_val = hpx::get<0>(a);
-                        reduce_key_series_states a_state = hpx::get<1>(a);
-                        value_type b_val = hpx::get<0>(b);
-                        reduce_key_series_states b_state = hpx::get<1>(b);
-                        debug_reduce_by_key("{ " << a_val << "+" << b_val
-                                                 << " },\t" << a_state
-                                                 << b_state);
-                        // if carrying a start flag, then copy - don't add
-                        if (b_state.start)
-                        {
-                            debug_reduce_by_key(" = " << b_val << std::endl);
-                            return hpx::make_tuple(b_val,
-                                reduce_key_series_states(
-                                    a_state.start || b_state.start,
-                                    b_state.end));
-                        }
-                        // normal add of previous + this
-                        else
-                        {
-                            debug_reduce_by_key(
-                                " = " << func(a_val, b_val) << std::endl);
-                            value_type temp = func(a_val, b_val);
-                            return hpx::make_tuple(temp,
-                                reduce_key_series_states(
-                                    a_state.start || b_state.start,
-                                    b_state.end));
-                        }
+                // the output never overtakes the input
+                chunk_type chunk;
+                reduce_by_key_segments(
+                    key_first, values_first, 0, count, count, comp, func,
+                    [&](key_type&& key, value_type&& value) {
+                        *keys_output++ = HPX_MOVE(key);
+                        *values_output++ = HPX_MOVE(value);
+                    },
+                    chunk);
+                return {keys_output, values_output};
+            }
+
+            std::vector<chunk_type> chunks(num_chunks);
+            auto chunk_begin = [count, num_chunks](std::size_t chunk) {
+                return count * chunk / num_chunks;
+            };
+
+            auto shape = hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(num_chunks));
+
+            // runs f for each chunk, exceptions are reported the same way
+            // as by the partitioners
+            auto run_chunks = [&](auto const& f) {
+                auto workitems =
+                    execution::bulk_async_execute(policy.executor(), f, shape);
+                hpx::wait_all_nothrow(workitems);
+
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_local_exceptions<
+                    std::decay_t<ExPolicy>>::call(workitems, errors);
+            };
+
+            auto reduce_chunk = [&](std::size_t i) {
+                chunk_type& chunk = chunks[i];
+                reduce_by_key_segments(
+                    key_first, values_first, chunk_begin(i),
+                    chunk_begin(i + 1), count, comp, func,
+                    [&chunk](key_type&& key, value_type&& value) {
+                        chunk.keys.push_back(HPX_MOVE(key));
+                        chunk.values.push_back(HPX_MOVE(value));
                     },
-                    initial);
-
-                // now copy the values and keys for each element that
-                // is marked by an 'END' state to the final output
-                using zip2_ref = typename hpx::util::zip_iterator<RanIter,
-                    FwdIter2,
-                    std::vector<reduce_key_series_states>::iterator>::reference;
-
-                std::vector<value_type> temp(number_of_keys);
-                hpx::copy(policy(hpx::execution::non_task), values_output,
-                    values_output + number_of_keys, temp.begin());
-
-                return make_pair_result(
-                    hpx::ranges::copy_if(policy(hpx::execution::non_task),
-                        make_zip_iterator(key_first, temp.begin(),
-                            hpx::util::begin(key_state)),
-                        make_zip_iterator(key_last,
-                            temp.begin() + number_of_keys,
-                            hpx::util::end(key_state)),
-                        make_zip_iterator(keys_output, values_output,
-                            hpx::util::begin(key_state)),
-                        // copies to dest only when 'end' state is true
-                        [](zip2_ref it) { return hpx::get<2>(it).end; }),
-                    keys_output, values_output);
+                    chunk);
+            };
+
+            run_chunks(reduce_chunk);
+
+            // propagate the carry-out of each chunk into the first segment
+            // ending in a subsequent chunk
+            std::size_t offset = 0;
+            value_type* carry = nullptr;
+            for (chunk_type& chunk : chunks)
+            {
+                chunk.offset = offset;
+                if (chunk.continues)
+                {
+                    HPX_ASSERT(carry != nullptr);
+                    if (chunk.values.empty())
+                    {
+                        // the whole chunk belongs to the carried segment
+                        HPX_ASSERT(chunk.open);
+                        *carry = func(*carry, chunk.open_value);
+                        continue;
+                    }
+                    chunk.values.front() = func(*carry, chunk.values.front());
+                }
+
+                carry = chunk.open ? &chunk.open_value : nullptr;
+                offset += chunk.values.size();
             }
+            HPX_ASSERT(carry == nullptr);
+
+            auto copy_chunk = [&](std::size_t i) {
+                chunk_type& chunk = chunks[i];
+                std::move(chunk.keys.begin(), chunk.keys.end(),
+                    std::next(keys_output, chunk.offset));
+                std::move(chunk.values.begin(), chunk.values.end(),
+                    std::next(values_output, chunk.offset));
+            };
+
+            run_chunks(copy_chunk);
+
+            return {std::next(keys_output, offset),
+                std::next(values_output, offset)};
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -408,15 +290,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \endcond
     }    // namespace detail
 
-#ifdef EXTRA_DEBUG
-    std::ostream& operator<<(
-        std::ostream& os, const detail::reduce_key_series_states& rs)
-    {
-        os << "{ start=" << rs.start << ",end=" << rs.end << "} ";
-        return os;
-    }
-#endif
-
     //-----------------------------------------------------------------------------
     /// Reduce by Key performs an inclusive scan reduction operation on elements
     /// supplied in key/value pairs. The algorithm produces a single output
@@ -536,12 +409,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 (hpx::traits::is_forward_iterator<FwdIter2>::value),
             "iterators : Random_access for inputs and forward for outputs.");
 
-        const std::uint64_t number_of_keys = std::distance(key_first, key_last);
-
-        if (number_of_keys <= 1)
-        {    // we only have a single key/value so that is our output
-            *keys_output = *key_first;
-            *values_output = *values_first;
+        if (key_first == key_last)
+        {
             return result::get(util::in_out_result<FwdIter1, FwdIter2>{
                 keys_output, values_output});
         }
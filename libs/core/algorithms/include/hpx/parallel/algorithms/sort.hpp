@@ -22,7 +22,10 @@ namespace hpx {
     /// operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. Contiguous sequences of integral or
+    ///                     floating point keys which are sorted using
+    ///                     std::less without a projection are radix sorted,
+    ///                     which takes O(N) steps.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -55,7 +58,8 @@ namespace hpx {
     /// operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. See the first hpx::sort overload
+    ///                     for keys which are radix sorted instead.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -107,7 +111,8 @@ namespace hpx {
     /// operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. See the first hpx::sort overload
+    ///                     for keys which are radix sorted instead.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -157,7 +162,8 @@ namespace hpx {
     /// operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. See the first hpx::sort overload
+    ///                     for keys which are radix sorted instead.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -244,6 +250,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -424,10 +431,22 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename Sent, typename Comp,
                 typename Proj>
-            static RandomIt sequential(
-                ExPolicy, RandomIt first, Sent last, Comp&& comp, Proj&& proj)
+            static RandomIt sequential(ExPolicy policy, RandomIt first,
+                Sent last, Comp&& comp, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
+
+                if constexpr (is_radix_sortable_v<RandomIt, Comp, Proj>)
+                {
+                    std::size_t const count = last_iter - first;
+                    if (count >= radix_sort_limit)
+                    {
+                        radix_sort(
+                            policy, first, radix_sort_no_values(), count);
+                        return last_iter;
+                    }
+                }
+
                 std::sort(first, last_iter,
                     util::compare_projected<Comp&, Proj&>(comp, proj));
                 return last_iter;
@@ -446,6 +465,19 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
+                    // arithmetic keys are sorted without comparisons
+                    if constexpr (is_radix_sortable_v<RandomIt, Comp, Proj>)
+                    {
+                        std::size_t const count = last - first;
+                        if (count >= radix_sort_limit)
+                        {
+                            return algorithm_result::get(
+                                radix_sort_async(HPX_FORWARD(ExPolicy, policy),
+                                    first, radix_sort_no_values(), count,
+                                    last));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
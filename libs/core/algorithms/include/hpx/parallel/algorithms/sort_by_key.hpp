@@ -10,10 +10,12 @@
 #include <hpx/local/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
 
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -50,7 +52,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
     /// to using operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. See the first hpx::sort overload
+    ///                     for keys which are radix sorted instead.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -134,6 +137,32 @@ namespace hpx { namespace parallel { inline namespace v1 {
         ValueIter value_last = value_first;
         std::advance(value_last, std::distance(key_first, key_last));
 
+        // arithmetic keys are sorted without comparisons, keys and values are
+        // moved directly instead of through the zip_iterator
+        if constexpr (detail::is_radix_sortable_by_key_v<KeyIter, ValueIter,
+                          Compare>)
+        {
+            using result_type = sort_by_key_result<KeyIter, ValueIter>;
+
+            std::size_t const count = std::distance(key_first, key_last);
+            if (count >= detail::radix_sort_limit)
+            {
+                if constexpr (hpx::is_sequenced_execution_policy_v<ExPolicy> &&
+                    !hpx::is_async_execution_policy_v<ExPolicy>)
+                {
+                    detail::radix_sort(policy, key_first, value_first, count);
+                    return result_type(key_last, value_last);
+                }
+                else
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        result_type>::get(detail::radix_sort_async(
+                        HPX_FORWARD(ExPolicy, policy), key_first, value_first,
+                        count, result_type(key_last, value_last)));
+                }
+            }
+        }
+
         using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
 
         return detail::get_iter_pair<iterator_type>(
@@ -20,7 +20,8 @@ namespace hpx {
     /// operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. See the first hpx::sort overload
+    ///                     for keys which are radix sorted instead.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -53,7 +54,8 @@ namespace hpx {
     /// operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. See the first hpx::sort overload
+    ///                     for keys which are radix sorted instead.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -105,7 +107,8 @@ namespace hpx {
     /// operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. See the first hpx::sort overload
+    ///                     for keys which are radix sorted instead.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -155,7 +158,8 @@ namespace hpx {
     /// operator<()).
     ///
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
-    ///                     comparisons.
+    ///                     comparisons. See the first hpx::sort overload
+    ///                     for keys which are radix sorted instead.
     ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
@@ -243,6 +247,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/parallel_stable_sort.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/detail/spin_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -278,13 +283,25 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename Sentinel, typename Compare,
                 typename Proj>
-            static RandomIt sequential(ExPolicy, RandomIt first, Sentinel last,
-                Compare&& comp, Proj&& proj)
+            static RandomIt sequential(ExPolicy policy, RandomIt first,
+                Sentinel last, Compare&& comp, Proj&& proj)
             {
                 using compare_type = util::compare_projected<Compare&, Proj&>;
 
                 auto last_iter = detail::advance_to_sentinel(first, last);
 
+                // the radix sort is stable as well
+                if constexpr (is_radix_sortable_v<RandomIt, Compare, Proj>)
+                {
+                    std::size_t const count = last_iter - first;
+                    if (count >= radix_sort_limit)
+                    {
+                        radix_sort(
+                            policy, first, radix_sort_no_values(), count);
+                        return last_iter;
+                    }
+                }
+
                 spin_sort(first, last_iter, compare_type(comp, proj));
                 return last_iter;
             }
@@ -324,10 +341,33 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
+                    // arithmetic keys are sorted without comparisons
+                    if constexpr (is_radix_sortable_v<RandomIt, Compare, Proj>)
+                    {
+                        if (count >= radix_sort_limit)
+                        {
+                            return algorithm_result::get(
+                                radix_sort_async(HPX_FORWARD(ExPolicy, policy),
+                                    first, radix_sort_no_values(), count,
+                                    last_iter));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     compare_type comp(compare, proj);
 
+                    // large inputs are sorted as many independent runs which
+                    // are merged at once
+                    if (cores > 1 &&
+                        count / stable_sort_limit_per_task >=
+                            stable_sort_min_runs)
+                    {
+                        return algorithm_result::get(
+                            parallel_stable_sort_runs(policy, first, count,
+                                HPX_MOVE(comp)));
+                    }
+
                     return algorithm_result::get(
                         parallel_stable_sort(policy.executor(), first,
                             last_iter, cores, chunk_size, HPX_MOVE(comp)));
@@ -226,6 +226,8 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -327,52 +329,97 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 FwdIter2 final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 2
-                // subsequent parallel steps. The first calculates the scan
-                // results for each partition and the second produces the
-                // overall result
-
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
 
-                auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
-                              T val) mutable -> void {
-                    FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-                    *dst++ = val;
-
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size - 1, [&op, &val](FwdIter2 it) -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                auto f4 = [last_iter, final_dest](std::vector<T>&&,
+                              std::vector<hpx::future<void>>&& data)
+                    -> result_type {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    data.clear();
+                    return result_type{last_iter, final_dest};
                 };
 
-                return util::scan_partitioner<ExPolicy, result_type, T>::call(
-                    HPX_FORWARD(ExPolicy, policy),
-                    make_zip_iterator(first, dest), count, init,
-                    // step 1 performs first part of scan algorithm
-                    [op, conv](zip_iterator part_begin,
-                        std::size_t part_size) mutable -> T {
-                        T part_init = HPX_INVOKE(conv, get<0>(*part_begin++));
-
-                        auto iters = part_begin.get_iterator_tuple();
-                        return sequential_transform_exclusive_scan_n(
-                            get<0>(iters), part_size - 1, get<1>(iters), conv,
-                            part_init, op);
-                    },
-                    // step 2 propagates the partition results from left
-                    // to right
-                    op,
-                    // step 3 runs final accumulation on each partition
-                    HPX_MOVE(f3),
-                    // use this return value
-                    [last_iter, final_dest](std::vector<T>&&,
-                        std::vector<hpx::future<void>>&& data) -> result_type {
-                        // make sure iterators embedded in function object that is
-                        // attached to futures are invalidated
-                        data.clear();
-
-                        return result_type{last_iter, final_dest};
-                    });
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    // Vector-pack policies perform the scan in 3 steps, as the
+                    // third step can combine whole packs of elements with the
+                    // result of the preceding partitions (see
+                    // inclusive_scan).
+                    auto f3 = [op](zip_iterator part_begin,
+                                  std::size_t part_size,
+                                  T val) mutable -> void {
+                        FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
+                        *dst++ = val;
+
+                        sequential_scan_combine<std::decay_t<ExPolicy>>(
+                            dst, part_size - 1, val, op);
+                    };
+
+                    return util::scan_partitioner<ExPolicy, result_type, T>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            make_zip_iterator(first, dest), count, init,
+                            // step 1 performs first part of scan algorithm
+                            [op, conv](zip_iterator part_begin,
+                                std::size_t part_size) mutable -> T {
+                                T part_init =
+                                    HPX_INVOKE(conv, get<0>(*part_begin++));
+
+                                auto iters = part_begin.get_iterator_tuple();
+                                return sequential_transform_exclusive_scan_n(
+                                    get<0>(iters), part_size - 1,
+                                    get<1>(iters), conv, part_init, op);
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            op,
+                            // step 3 runs final accumulation on each partition
+                            HPX_MOVE(f3),
+                            // step 4 use this return value
+                            HPX_MOVE(f4));
+                }
+                else
+                {
+                    // The scan is performed in a single pass over the data.
+                    // Each partition is scanned once the combined result of
+                    // all preceding partitions is known. Partitions for which
+                    // this result is not available yet are reduced first to
+                    // allow later partitions to proceed.
+                    return util::scan_partitioner<ExPolicy, result_type, T,
+                        void, util::scan_partitioner_single_pass_tag>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            make_zip_iterator(first, dest), count, init,
+                            // step 1 reduces a partition, the order of the
+                            // elements has to be preserved
+                            [op, conv](zip_iterator part_begin,
+                                std::size_t part_size) mutable -> T {
+                                FwdIter1 it =
+                                    get<0>(part_begin.get_iterator_tuple());
+                                T part_init = HPX_INVOKE(conv, *it);
+                                return sequential_transform_reduce<
+                                    hpx::execution::sequenced_policy>(++it,
+                                    part_size - 1, HPX_MOVE(part_init), op,
+                                    conv);
+                            },
+                            // step 2 combines the results of adjacent
+                            // partitions
+                            op,
+                            // step 3 scans a partition given the combined
+                            // result of all preceding partitions
+                            [op, conv](zip_iterator part_begin,
+                                std::size_t part_size, T val,
+                                bool) mutable -> T {
+                                auto iters = part_begin.get_iterator_tuple();
+                                return sequential_transform_exclusive_scan_n(
+                                    get<0>(iters), part_size, get<1>(iters),
+                                    conv, HPX_MOVE(val), op);
+                            },
+                            // step 4 use this return value
+                            HPX_MOVE(f4));
+                }
             }
         };
         /// \endcond
@@ -0,0 +1,352 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements are compared in vector packs if they are not projected
+    // and if the comparison yields a mask when invoked with vector packs.
+    template <typename Iter, typename F, typename Proj, typename Enable = void>
+    struct is_datapar_comparable : std::false_type
+    {
+    };
+
+    template <typename Iter, typename F, typename Proj>
+    struct is_datapar_comparable<Iter, F, Proj,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value &&
+            std::is_same_v<std::decay_t<Proj>, util::projection_identity>>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename hpx::parallel::traits::vector_pack_type<
+            value_type>::type;
+
+        template <typename F_, typename Enable = void>
+        struct check : std::false_type
+        {
+        };
+
+        template <typename F_>
+        struct check<F_,
+            std::enable_if_t<
+                std::is_same_v<std::decay_t<typename hpx::util::invoke_result<
+                                   F_ const&, V const&, V const&>::type>,
+                    typename V::mask_type>>> : std::true_type
+        {
+        };
+
+        static constexpr bool value = check<std::decay_t<F>>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Whole vector packs are compared against the current candidate(s) and
+    // only packs holding a better candidate are inspected element by element.
+    // This keeps the result identical to the one of the sequential
+    // algorithms: the first smallest and the last largest element.
+    template <typename ExPolicy>
+    struct datapar_minmax_element
+    {
+        template <typename FwdIter, typename F>
+        static FwdIter min_element(FwdIter it, std::size_t count, F const& f)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+            using V = typename hpx::parallel::traits::vector_pack_type<
+                value_type>::type;
+            using load =
+                hpx::parallel::traits::vector_pack_load<V, value_type>;
+
+            constexpr std::size_t size =
+                hpx::parallel::traits::vector_pack_size<V>::value;
+
+            if (count == 0)
+                return it;
+
+            FwdIter smallest = it;
+            value_type value = *it;
+
+            for ((void) ++it, --count; count >= size; count -= size)
+            {
+                V curr = load::unaligned(it);
+                if (hpx::parallel::traits::any_of(
+                        HPX_INVOKE(f, curr, V(value))))
+                {
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        value_type curr_value = curr[i];
+                        if (HPX_INVOKE(f, curr_value, value))
+                        {
+                            smallest = std::next(it, i);
+                            value = curr_value;
+                        }
+                    }
+                }
+                std::advance(it, size);
+            }
+
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                value_type curr_value = *it;
+                if (HPX_INVOKE(f, curr_value, value))
+                {
+                    smallest = it;
+                    value = curr_value;
+                }
+            }
+            return smallest;
+        }
+
+        template <typename FwdIter, typename F>
+        static FwdIter max_element(FwdIter it, std::size_t count, F const& f)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+            using V = typename hpx::parallel::traits::vector_pack_type<
+                value_type>::type;
+            using load =
+                hpx::parallel::traits::vector_pack_load<V, value_type>;
+
+            constexpr std::size_t size =
+                hpx::parallel::traits::vector_pack_size<V>::value;
+
+            if (count == 0)
+                return it;
+
+            FwdIter largest = it;
+            value_type value = *it;
+
+            for ((void) ++it, --count; count >= size; count -= size)
+            {
+                V curr = load::unaligned(it);
+                if (!hpx::parallel::traits::all_of(
+                        HPX_INVOKE(f, curr, V(value))))
+                {
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        value_type curr_value = curr[i];
+                        if (!HPX_INVOKE(f, curr_value, value))
+                        {
+                            largest = std::next(it, i);
+                            value = curr_value;
+                        }
+                    }
+                }
+                std::advance(it, size);
+            }
+
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                value_type curr_value = *it;
+                if (!HPX_INVOKE(f, curr_value, value))
+                {
+                    largest = it;
+                    value = curr_value;
+                }
+            }
+            return largest;
+        }
+
+        template <typename FwdIter, typename F>
+        static util::min_max_result<FwdIter> minmax_element(
+            FwdIter it, std::size_t count, F const& f)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+            using V = typename hpx::parallel::traits::vector_pack_type<
+                value_type>::type;
+            using load =
+                hpx::parallel::traits::vector_pack_load<V, value_type>;
+
+            constexpr std::size_t size =
+                hpx::parallel::traits::vector_pack_size<V>::value;
+
+            util::min_max_result<FwdIter> result = {it, it};
+            if (count == 0)
+                return result;
+
+            value_type min_value = *it;
+            value_type max_value = min_value;
+
+            auto update = [&](FwdIter curr_it, value_type curr_value) {
+                if (HPX_INVOKE(f, curr_value, min_value))
+                {
+                    result.min = curr_it;
+                    min_value = curr_value;
+                }
+                if (!HPX_INVOKE(f, curr_value, max_value))
+                {
+                    result.max = curr_it;
+                    max_value = curr_value;
+                }
+            };
+
+            for ((void) ++it, --count; count >= size; count -= size)
+            {
+                V curr = load::unaligned(it);
+                if (hpx::parallel::traits::any_of(
+                        HPX_INVOKE(f, curr, V(min_value))) ||
+                    !hpx::parallel::traits::all_of(
+                        HPX_INVOKE(f, curr, V(max_value))))
+                {
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        update(std::next(it, i), value_type(curr[i]));
+                    }
+                }
+                std::advance(it, size);
+            }
+
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                update(it, *it);
+            }
+            return result;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, FwdIter>
+    tag_invoke(sequential_min_element_t<ExPolicy>, FwdIter it,
+        std::size_t count, F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_comparable<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax_element<ExPolicy>::min_element(it, count, f);
+        }
+        else
+        {
+            return sequential_min_element<hpx::execution::sequenced_policy>(
+                it, count, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, FwdIter>::value,
+        FwdIter>
+    tag_invoke(sequential_min_element_t<ExPolicy>, FwdIter first, Sent last,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_comparable<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax_element<ExPolicy>::min_element(
+                first, detail::distance(first, last), f);
+        }
+        else
+        {
+            return sequential_min_element<hpx::execution::sequenced_policy>(
+                first, last, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, FwdIter>
+    tag_invoke(sequential_max_element_t<ExPolicy>, FwdIter it,
+        std::size_t count, F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_comparable<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax_element<ExPolicy>::max_element(it, count, f);
+        }
+        else
+        {
+            return sequential_max_element<hpx::execution::sequenced_policy>(
+                it, count, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, FwdIter>::value,
+        FwdIter>
+    tag_invoke(sequential_max_element_t<ExPolicy>, FwdIter first, Sent last,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_comparable<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax_element<ExPolicy>::max_element(
+                first, detail::distance(first, last), f);
+        }
+        else
+        {
+            return sequential_max_element<hpx::execution::sequenced_policy>(
+                first, last, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        util::min_max_result<FwdIter>>
+    tag_invoke(sequential_minmax_element_t<ExPolicy>, FwdIter it,
+        std::size_t count, F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_comparable<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax_element<ExPolicy>::minmax_element(
+                it, count, f);
+        }
+        else
+        {
+            return sequential_minmax_element<hpx::execution::sequenced_policy>(
+                it, count, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, FwdIter>::value,
+        util::min_max_result<FwdIter>>
+    tag_invoke(sequential_minmax_element_t<ExPolicy>, FwdIter first,
+        Sent last, F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_comparable<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax_element<ExPolicy>::minmax_element(
+                first, detail::distance(first, last), f);
+        }
+        else
+        {
+            return sequential_minmax_element<hpx::execution::sequenced_policy>(
+                first, last, f, proj);
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,248 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/mismatch.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Two sequences are compared in vector packs if none of them is projected
+    // and if the predicate yields a mask when invoked with vector packs of the
+    // same size.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2, typename Enable = void>
+    struct is_datapar_mismatchable : std::false_type
+    {
+    };
+
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    struct is_datapar_mismatchable<Iter1, Iter2, F, Proj1, Proj2,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter1>::value &&
+            util::detail::iterator_datapar_compatible<Iter2>::value &&
+            std::is_same_v<std::decay_t<Proj1>, util::projection_identity> &&
+            std::is_same_v<std::decay_t<Proj2>, util::projection_identity>>>
+    {
+        using V1 = typename hpx::parallel::traits::vector_pack_type<
+            typename std::iterator_traits<Iter1>::value_type>::type;
+        using V2 = typename hpx::parallel::traits::vector_pack_type<
+            typename std::iterator_traits<Iter2>::value_type>::type;
+
+        template <typename F_, typename Enable = void>
+        struct check : std::false_type
+        {
+        };
+
+        template <typename F_>
+        struct check<F_,
+            std::enable_if_t<
+                std::is_same_v<std::decay_t<typename hpx::util::invoke_result<
+                                   F_&, V1 const&, V2 const&>::type>,
+                    typename V1::mask_type>>> : std::true_type
+        {
+        };
+
+        static constexpr bool value =
+            hpx::parallel::traits::vector_pack_size<V1>::value ==
+                hpx::parallel::traits::vector_pack_size<V2>::value &&
+            check<std::decay_t<F>>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_mismatch
+    {
+        // Advances both iterators to the first mismatch within the next
+        // count elements (or by count elements if there is none), returns
+        // the number of elements which are left to be compared.
+        template <typename Iter1, typename Iter2, typename F>
+        static std::size_t call(
+            Iter1& first1, Iter2& first2, std::size_t count, F& f)
+        {
+            using value_type1 =
+                typename std::iterator_traits<Iter1>::value_type;
+            using value_type2 =
+                typename std::iterator_traits<Iter2>::value_type;
+            using V1 = typename hpx::parallel::traits::vector_pack_type<
+                value_type1>::type;
+            using V2 = typename hpx::parallel::traits::vector_pack_type<
+                value_type2>::type;
+            using load1 =
+                hpx::parallel::traits::vector_pack_load<V1, value_type1>;
+            using load2 =
+                hpx::parallel::traits::vector_pack_load<V2, value_type2>;
+
+            constexpr std::size_t size =
+                hpx::parallel::traits::vector_pack_size<V1>::value;
+
+            for (/**/; count >= size; count -= size)
+            {
+                auto msk = HPX_INVOKE(
+                    f, load1::unaligned(first1), load2::unaligned(first2));
+
+                int offset = hpx::parallel::traits::find_first_of(!msk);
+                if (offset != -1)
+                {
+                    std::advance(first1, offset);
+                    std::advance(first2, offset);
+                    return count - offset;
+                }
+
+                std::advance(first1, size);
+                std::advance(first2, size);
+            }
+            return count;
+        }
+    };
+
+    template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
+        typename F, typename Proj1, typename Proj2>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent1, Iter1>::value,
+        util::in_in_result<Iter1, Iter2>>
+    tag_invoke(sequential_mismatch_t<ExPolicy>, Iter1 first1, Sent1 last1,
+        Iter2 first2, F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        if constexpr (is_datapar_mismatchable<Iter1, Iter2, F, Proj1,
+                          Proj2>::value)
+        {
+            datapar_mismatch<ExPolicy>::call(
+                first1, first2, detail::distance(first1, last1), f);
+        }
+
+        return sequential_mismatch<hpx::execution::sequenced_policy>(first1,
+            last1, first2, HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+            HPX_FORWARD(Proj2, proj2));
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
+        typename Sent2, typename F, typename Proj1, typename Proj2>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent1, Iter1>::value &&
+            hpx::traits::is_sentinel_for<Sent2, Iter2>::value,
+        util::in_in_result<Iter1, Iter2>>
+    tag_invoke(sequential_mismatch_t<ExPolicy>, Iter1 first1, Sent1 last1,
+        Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        if constexpr (is_datapar_mismatchable<Iter1, Iter2, F, Proj1,
+                          Proj2>::value)
+        {
+            datapar_mismatch<ExPolicy>::call(first1, first2,
+                (std::min)(detail::distance(first1, last1),
+                    detail::distance(first2, last2)),
+                f);
+        }
+
+        return sequential_mismatch<hpx::execution::sequenced_policy>(first1,
+            last1, first2, last2, HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+            HPX_FORWARD(Proj2, proj2));
+    }
+
+    template <typename ExPolicy, typename ZipIter, typename Token, typename F,
+        typename Proj1, typename Proj2>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, void>
+    tag_invoke(sequential_mismatch_t<ExPolicy>, std::size_t base_idx,
+        ZipIter part_begin, std::size_t part_count, Token& tok, F&& f,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        auto iters = part_begin.get_iterator_tuple();
+        auto first1 = hpx::get<0>(iters);
+        auto first2 = hpx::get<1>(iters);
+
+        if constexpr (is_datapar_mismatchable<decltype(first1),
+                          decltype(first2), F, Proj1, Proj2>::value)
+        {
+            if (tok.was_cancelled(base_idx))
+                return;
+
+            std::size_t count =
+                datapar_mismatch<ExPolicy>::call(first1, first2, part_count, f);
+            if (count != 0)
+            {
+                std::size_t offset = part_count - count;
+                base_idx += offset;
+                std::advance(part_begin, offset);
+                part_count = count;
+            }
+            else
+            {
+                return;
+            }
+        }
+
+        sequential_mismatch<hpx::execution::sequenced_policy>(base_idx,
+            part_begin, part_count, tok, HPX_FORWARD(F, f),
+            HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2));
+    }
+
+    template <typename ExPolicy, typename ZipIter, typename Token, typename F,
+        typename Proj1, typename Proj2>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, void>
+    tag_invoke(sequential_equal_t<ExPolicy>, ZipIter part_begin,
+        std::size_t part_count, Token& tok, F&& f, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        auto iters = part_begin.get_iterator_tuple();
+        auto first1 = hpx::get<0>(iters);
+        auto first2 = hpx::get<1>(iters);
+
+        if constexpr (is_datapar_mismatchable<decltype(first1),
+                          decltype(first2), F, Proj1, Proj2>::value)
+        {
+            if (tok.was_cancelled())
+                return;
+
+            std::size_t count =
+                datapar_mismatch<ExPolicy>::call(first1, first2, part_count, f);
+            if (count != 0)
+            {
+                std::size_t offset = part_count - count;
+                std::advance(part_begin, offset);
+                part_count = count;
+            }
+            else
+            {
+                return;
+            }
+        }
+
+        sequential_equal<hpx::execution::sequenced_policy>(part_begin,
+            part_count, tok, HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+            HPX_FORWARD(Proj2, proj2));
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,256 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The typed standard function objects can't be invoked with vector packs,
+    // their transparent versions are used instead if they operate on the
+    // type of the reduction result.
+    template <typename Reduce, typename T>
+    struct datapar_reduce_operation
+    {
+        template <typename Reduce_>
+        static constexpr Reduce_&& get(Reduce_&& r) noexcept
+        {
+            return HPX_FORWARD(Reduce_, r);
+        }
+    };
+
+    template <typename T>
+    struct datapar_reduce_operation<std::plus<T>, T>
+    {
+        static constexpr std::plus<> get(std::plus<T> const&) noexcept
+        {
+            return std::plus<>{};
+        }
+    };
+
+    template <typename T>
+    struct datapar_reduce_operation<std::multiplies<T>, T>
+    {
+        static constexpr std::multiplies<> get(
+            std::multiplies<T> const&) noexcept
+        {
+            return std::multiplies<>{};
+        }
+    };
+
+    // The reduction is vectorized if the converted elements and the
+    // intermediate results can be held in vector packs of the same size.
+    template <typename Iter, typename T, typename Reduce, typename Convert,
+        typename Enable = void>
+    struct is_datapar_reducible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Reduce, typename Convert>
+    struct is_datapar_reducible<Iter, T, Reduce, Convert,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value &&
+            std::is_arithmetic_v<T>>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename hpx::parallel::traits::vector_pack_type<
+            value_type>::type;
+        using VT = typename hpx::parallel::traits::vector_pack_type<T>::type;
+
+        template <typename R, typename C, typename Enable = void>
+        struct check : std::false_type
+        {
+        };
+
+        template <typename R, typename C>
+        struct check<R, C,
+            std::enable_if_t<
+                std::is_same_v<std::decay_t<typename hpx::util::invoke_result<
+                                   C&, V const&>::type>,
+                    VT> &&
+                std::is_same_v<std::decay_t<typename hpx::util::invoke_result<
+                                   R&, VT const&, VT const&>::type>,
+                    VT>>> : std::true_type
+        {
+        };
+
+        static constexpr bool value =
+            hpx::parallel::traits::vector_pack_size<V>::value ==
+                hpx::parallel::traits::vector_pack_size<VT>::value &&
+            check<Reduce, Convert>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_transform_reduce
+    {
+        // Several independent accumulators are used to hide the latency of
+        // the reduction operation.
+        static constexpr std::size_t num_accumulators = 4;
+
+        template <typename Iter, typename T, typename Reduce, typename Convert>
+        static T call(Iter first, std::size_t count, T init, Reduce&& r,
+            Convert&& conv)
+        {
+            using reduce_operation =
+                datapar_reduce_operation<std::decay_t<Reduce>, T>;
+            using op_type = std::decay_t<decltype(reduce_operation::get(r))>;
+
+            if constexpr (is_datapar_reducible<Iter, T, op_type,
+                              std::decay_t<Convert>>::value)
+            {
+                using value_type =
+                    typename std::iterator_traits<Iter>::value_type;
+                using V = typename hpx::parallel::traits::vector_pack_type<
+                    value_type>::type;
+                using VT =
+                    typename hpx::parallel::traits::vector_pack_type<T>::type;
+                using load =
+                    hpx::parallel::traits::vector_pack_load<V, value_type>;
+
+                constexpr std::size_t size =
+                    hpx::parallel::traits::vector_pack_size<V>::value;
+                constexpr std::size_t step = num_accumulators * size;
+
+                if (count >= step)
+                {
+                    auto&& op = reduce_operation::get(r);
+
+                    VT acc[num_accumulators];
+                    for (std::size_t i = 0; i != num_accumulators; ++i)
+                    {
+                        acc[i] = HPX_INVOKE(conv, load::unaligned(first));
+                        std::advance(first, size);
+                    }
+
+                    for (count -= step; count >= step; count -= step)
+                    {
+                        for (std::size_t i = 0; i != num_accumulators; ++i)
+                        {
+                            acc[i] = HPX_INVOKE(op, acc[i],
+                                HPX_INVOKE(conv, load::unaligned(first)));
+                            std::advance(first, size);
+                        }
+                    }
+
+                    for (/**/; count >= size; count -= size)
+                    {
+                        acc[0] = HPX_INVOKE(op, acc[0],
+                            HPX_INVOKE(conv, load::unaligned(first)));
+                        std::advance(first, size);
+                    }
+
+                    for (std::size_t i = 1; i != num_accumulators; ++i)
+                    {
+                        acc[0] = HPX_INVOKE(op, acc[0], acc[i]);
+                    }
+
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        init = HPX_INVOKE(r, HPX_MOVE(init), T(acc[0][i]));
+                    }
+                }
+            }
+
+            // reduce the remaining elements one by one
+            return sequential_transform_reduce<
+                hpx::execution::sequenced_policy>(first, count, HPX_MOVE(init),
+                HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+        }
+    };
+
+    template <typename ExPolicy, typename InIterB, typename InIterE,
+        typename T, typename Reduce>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<InIterE, InIterB>::value,
+        T>
+    tag_invoke(sequential_reduce_t<ExPolicy>, InIterB first, InIterE last,
+        T init, Reduce&& r)
+    {
+        if constexpr (util::detail::iterator_datapar_compatible<
+                          InIterB>::value)
+        {
+            return datapar_transform_reduce<ExPolicy>::call(first,
+                detail::distance(first, last), HPX_MOVE(init),
+                HPX_FORWARD(Reduce, r), util::projection_identity{});
+        }
+        else
+        {
+            return sequential_reduce<hpx::execution::sequenced_policy>(
+                first, last, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+        }
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, T>
+    tag_invoke(sequential_reduce_t<ExPolicy>, Iter part_begin,
+        std::size_t part_size, T init, Reduce&& r)
+    {
+        return datapar_transform_reduce<ExPolicy>::call(part_begin, part_size,
+            HPX_MOVE(init), HPX_FORWARD(Reduce, r),
+            util::projection_identity{});
+    }
+
+    template <typename ExPolicy, typename InIterB, typename InIterE,
+        typename T, typename Reduce, typename Convert>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<InIterE, InIterB>::value,
+        T>
+    tag_invoke(sequential_transform_reduce_t<ExPolicy>, InIterB first,
+        InIterE last, T init, Reduce&& r, Convert&& conv)
+    {
+        if constexpr (util::detail::iterator_datapar_compatible<
+                          InIterB>::value)
+        {
+            return datapar_transform_reduce<ExPolicy>::call(first,
+                detail::distance(first, last), HPX_MOVE(init),
+                HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+        }
+        else
+        {
+            return sequential_transform_reduce<
+                hpx::execution::sequenced_policy>(first, last, HPX_MOVE(init),
+                HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+        }
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Convert>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, T>
+    tag_invoke(sequential_transform_reduce_t<ExPolicy>, Iter part_begin,
+        std::size_t part_size, T init, Reduce&& r, Convert&& conv)
+    {
+        return datapar_transform_reduce<ExPolicy>::call(part_begin, part_size,
+            HPX_MOVE(init), HPX_FORWARD(Reduce, r), HPX_FORWARD(Convert, conv));
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,99 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/reduce.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The combine step of the scans is vectorized if the partition holds
+    // elements of the type of the scan and if the operation can be invoked
+    // with vector packs of that type.
+    template <typename Iter, typename T, typename Op, typename Enable = void>
+    struct is_datapar_scan_combinable : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Op>
+    struct is_datapar_scan_combinable<Iter, T, Op,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value &&
+            std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+                T>>>
+    {
+        using V = typename hpx::parallel::traits::vector_pack_type<T>::type;
+
+        template <typename Op_, typename Enable = void>
+        struct check : std::false_type
+        {
+        };
+
+        template <typename Op_>
+        struct check<Op_,
+            std::enable_if_t<
+                std::is_same_v<std::decay_t<typename hpx::util::invoke_result<
+                                   Op_&, V const&, V const&>::type>,
+                    V>>> : std::true_type
+        {
+        };
+
+        static constexpr bool value = check<Op>::value;
+    };
+
+    template <typename ExPolicy, typename Iter, typename T, typename Op>
+    inline std::enable_if_t<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, void>
+    tag_invoke(sequential_scan_combine_t<ExPolicy>, Iter it,
+        std::size_t count, T const& val, Op&& op)
+    {
+        using reduce_operation = datapar_reduce_operation<std::decay_t<Op>, T>;
+        using op_type = std::decay_t<decltype(reduce_operation::get(op))>;
+
+        if constexpr (is_datapar_scan_combinable<Iter, T, op_type>::value)
+        {
+            using V =
+                typename hpx::parallel::traits::vector_pack_type<T>::type;
+            using load = hpx::parallel::traits::vector_pack_load<V, T>;
+            using store = hpx::parallel::traits::vector_pack_store<V, T>;
+
+            constexpr std::size_t size =
+                hpx::parallel::traits::vector_pack_size<V>::value;
+
+            auto&& vop = reduce_operation::get(op);
+
+            V const vval(val);
+            for (/**/; count >= size; count -= size)
+            {
+                V result = HPX_INVOKE(vop, vval, load::unaligned(it));
+                store::unaligned(result, it);
+                std::advance(it, size);
+            }
+        }
+
+        sequential_scan_combine<hpx::execution::sequenced_policy>(
+            it, count, val, HPX_FORWARD(Op, op));
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
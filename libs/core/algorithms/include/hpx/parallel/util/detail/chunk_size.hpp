@@ -57,6 +57,18 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
         std::size_t count, std::size_t& max_chunks, std::size_t& chunk_size,
         bool has_variable_chunk_size = false) noexcept
     {
+        // an empty sequence is a single empty chunk, this avoids dividing by
+        // zero below and in the chunk iterators
+        if (count == 0)
+        {
+            max_chunks = 1;
+            if (chunk_size == 0)
+            {
+                chunk_size = 1;
+            }
+            return;
+        }
+
         if (max_chunks == 0)
         {
             if (chunk_size == 0)
@@ -12,12 +12,17 @@
 #include <hpx/local/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/async_local/dataflow.hpp>
 #endif
 
 #include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -27,8 +32,10 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <type_traits>
@@ -44,8 +51,101 @@ namespace hpx { namespace parallel { namespace util {
     {
     };
 
+    // The single-pass scan reads and writes each element only once. It uses
+    // a different protocol for the functions passed to the partitioner:
+    //
+    //   f1(it, size) -> Result1:         reduce the partition, must not
+    //                                    write any output
+    //   f2(Result1, Result1) -> Result1: combine the results of two
+    //                                    adjacent partitions
+    //   f3(it, size, Result1, bool) -> Result1:
+    //                                    produce the output of a partition
+    //                                    given the combined result of all
+    //                                    preceding partitions, return the
+    //                                    combined result including the
+    //                                    partition; the flag is true if f1
+    //                                    was run on the same partition by the
+    //                                    same task right before, which allows
+    //                                    f3 to reuse what f1 stored
+    //   f4(std::vector<Result1>&&, std::vector<hpx::future<void>>&&) -> R:
+    //                                    produce the overall result from the
+    //                                    init value followed by the inclusive
+    //                                    results of all partitions
+    //
+    // Partitions are processed in order by a fixed number of tasks. The
+    // result of a partition is published as soon as it is known, a partition
+    // whose predecessor has not finished yet publishes its own reduction
+    // (f1) and looks back across the preceding partitions to combine their
+    // published results (decoupled look-back). The partitions are kept small
+    // enough for f1 and f3 to operate on cached data.
+    struct scan_partitioner_single_pass_tag
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        enum class scan_partition_status
+        {
+            invalid = 0,
+            aggregate = 1,
+            prefix = 2,
+            failed = 3
+        };
+
+        template <typename Result>
+        struct scan_partition_descriptor
+        {
+            // the results are not required to be default constructible
+            std::atomic<scan_partition_status> status{
+                scan_partition_status::invalid};
+            hpx::optional<Result> aggregate;    // published with 'aggregate'
+            hpx::optional<Result> prefix;       // published with 'prefix'
+        };
+
+        // Partitions of the single-pass scan are limited in size to keep the
+        // data touched by f1 in cache for the subsequent f3.
+        inline constexpr std::size_t scan_single_pass_max_partition_size =
+            16384;
+
+        template <typename ExPolicy, typename FwdIter>
+        std::vector<hpx::tuple<FwdIter, std::size_t>>
+        get_scan_single_pass_shape(ExPolicy& policy, FwdIter first,
+            std::size_t count, std::size_t cores)
+        {
+            std::size_t max_chunks = execution::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), cores, count);
+
+            // the single-pass scan does not support measuring the chunk size
+            std::size_t chunk_size = execution::get_chunk_size(
+                policy.parameters(), policy.executor(),
+                [](std::size_t) -> std::size_t { return 0; }, cores, count);
+
+            bool const use_default = max_chunks == 0 && chunk_size == 0;
+
+            adjust_chunk_size_and_max_chunks(
+                cores, count, max_chunks, chunk_size);
+
+            if (use_default)
+            {
+                chunk_size = (std::min)(
+                    chunk_size, scan_single_pass_max_partition_size);
+            }
+            chunk_size = (std::max)(chunk_size, std::size_t(1));
+
+            std::vector<hpx::tuple<FwdIter, std::size_t>> shape;
+            shape.reserve((count + chunk_size - 1) / chunk_size);
+
+            while (count != 0)
+            {
+                std::size_t size = (std::min)(chunk_size, count);
+                shape.emplace_back(first, size);
+                std::advance(first, size);
+                count -= size;
+            }
+            return shape;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -316,6 +416,211 @@ namespace hpx { namespace parallel { namespace util {
 #endif
             }
 
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call(scan_partitioner_single_pass_tag, ExPolicy_ policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_UNUSED(policy);
+                HPX_UNUSED(first);
+                HPX_UNUSED(count);
+                HPX_UNUSED(init);
+                HPX_UNUSED(f1);
+                HPX_UNUSED(f2);
+                HPX_UNUSED(f3);
+                HPX_UNUSED(f4);
+                HPX_ASSERT(false);
+                return R();
+#else
+                static_assert(std::is_void_v<Result2>,
+                    "the single-pass scan does not support intermediate "
+                    "results of the third step");
+
+                using descriptor_type = hpx::util::cache_aligned_data<
+                    scan_partition_descriptor<Result1>>;
+
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                HPX_ASSERT(count > 0);
+
+                std::size_t const cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+
+                auto const shape =
+                    get_scan_single_pass_shape(policy, first, count, cores);
+                std::size_t const size = shape.size();
+
+                std::vector<descriptor_type> descriptors(size);
+                std::atomic<std::size_t> next_partition(0);
+                std::atomic<bool> failed(false);
+
+                Result1 const init_value = HPX_FORWARD(T, init);
+
+                // Each task processes the next unclaimed partition until all
+                // partitions are done. Partitions are claimed in order, which
+                // guarantees that the look-back waits only for partitions
+                // currently being processed by other tasks.
+                auto worker = [&, f1, f2, f3]() mutable -> void {
+                    // Combine the published results of the partitions preceding
+                    // 'part' (from right to left), returns false if any of them
+                    // failed.
+                    auto look_back = [&](std::size_t part,
+                                         hpx::optional<Result1>& prefix) {
+                        for (std::size_t i = part; i != 0; --i)
+                        {
+                            auto& prev = descriptors[i - 1].data_;
+
+                            auto status = scan_partition_status::invalid;
+                            hpx::util::yield_while([&]() {
+                                status =
+                                    prev.status.load(std::memory_order_acquire);
+                                return status == scan_partition_status::invalid;
+                            });
+
+                            if (status == scan_partition_status::failed)
+                            {
+                                return false;
+                            }
+
+                            if (status == scan_partition_status::prefix)
+                            {
+                                prefix.emplace(prefix.has_value() ?
+                                        HPX_INVOKE(f2, *prev.prefix, *prefix) :
+                                        *prev.prefix);
+                                return true;
+                            }
+
+                            prefix.emplace(prefix.has_value() ?
+                                    HPX_INVOKE(f2, *prev.aggregate, *prefix) :
+                                    *prev.aggregate);
+                        }
+
+                        // the first partition always publishes its prefix
+                        HPX_ASSERT(false);
+                        return false;
+                    };
+
+                    auto process = [&](std::size_t part) {
+                        auto& curr = descriptors[part].data_;
+                        FwdIter it = hpx::get<0>(shape[part]);
+                        std::size_t part_size = hpx::get<1>(shape[part]);
+
+                        if (part == 0)
+                        {
+                            curr.prefix.emplace(HPX_INVOKE(
+                                f3, it, part_size, init_value, false));
+                            curr.status.store(scan_partition_status::prefix,
+                                std::memory_order_release);
+                            return true;
+                        }
+
+                        auto& prev = descriptors[part - 1].data_;
+                        if (prev.status.load(std::memory_order_acquire) ==
+                            scan_partition_status::prefix)
+                        {
+                            // all preceding partitions are done, no need to
+                            // reduce this partition separately
+                            curr.prefix.emplace(HPX_INVOKE(
+                                f3, it, part_size, *prev.prefix, false));
+                            curr.status.store(scan_partition_status::prefix,
+                                std::memory_order_release);
+                            return true;
+                        }
+
+                        curr.aggregate.emplace(HPX_INVOKE(f1, it, part_size));
+                        curr.status.store(scan_partition_status::aggregate,
+                            std::memory_order_release);
+
+                        hpx::optional<Result1> prefix;
+                        if (!look_back(part, prefix))
+                        {
+                            curr.status.store(scan_partition_status::failed,
+                                std::memory_order_release);
+                            return false;
+                        }
+
+                        curr.prefix.emplace(
+                            HPX_INVOKE(f2, *prefix, *curr.aggregate));
+                        curr.status.store(scan_partition_status::prefix,
+                            std::memory_order_release);
+
+                        HPX_INVOKE(
+                            f3, it, part_size, HPX_MOVE(*prefix), true);
+                        return true;
+                    };
+
+                    while (!failed.load(std::memory_order_relaxed))
+                    {
+                        std::size_t part = next_partition.fetch_add(
+                            1, std::memory_order_relaxed);
+                        if (part >= size)
+                        {
+                            break;
+                        }
+
+                        try
+                        {
+                            if (!process(part))
+                            {
+                                failed.store(true, std::memory_order_relaxed);
+                            }
+                        }
+                        catch (...)
+                        {
+                            descriptors[part].data_.status.store(
+                                scan_partition_status::failed,
+                                std::memory_order_release);
+                            failed.store(true, std::memory_order_relaxed);
+                            throw;
+                        }
+                    }
+                };
+
+                std::vector<hpx::future<void>> workitems;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    std::size_t const num_tasks = (std::min)(cores, size);
+                    workitems.reserve(num_tasks);
+
+                    for (std::size_t i = 0; i != num_tasks; ++i)
+                    {
+                        workitems.push_back(execution::async_execute(
+                            policy.executor(), worker));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+
+                // wait for all tasks to finish before the descriptors go out
+                // of scope
+                hpx::wait_all_nothrow(workitems);
+
+                std::vector<Result1> results;
+                if (errors.empty() && !failed.load(std::memory_order_relaxed))
+                {
+                    results.reserve(size + 1);
+                    results.push_back(init_value);
+                    for (auto& descriptor : descriptors)
+                    {
+                        results.push_back(HPX_MOVE(*descriptor.data_.prefix));
+                    }
+                }
+
+                return reduce(HPX_MOVE(results), HPX_MOVE(workitems),
+                    HPX_MOVE(errors), HPX_FORWARD(F4, f4));
+#endif
+            }
+
             template <typename ExPolicy_, typename FwdIter, typename T,
                 typename F1, typename F2, typename F3, typename F4>
             static R call(ExPolicy_&& policy, FwdIter first, std::size_t count,
@@ -426,7 +731,9 @@ namespace hpx { namespace parallel { namespace util {
     // R:           overall result type
     // Result1:     intermediate result type of first and second step
     // Result2:     intermediate result of the third step
-    // ScanPartTag: select appropriate policy of scan partitioner
+    // ScanPartTag: select appropriate policy of scan partitioner, see
+    //              scan_partitioner_single_pass_tag for the protocol of the
+    //              single-pass scan
     template <typename ExPolicy, typename R = void, typename Result1 = R,
         typename Result2 = void,
         typename ScanPartTag = scan_partitioner_normal_tag>
@@ -0,0 +1,239 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// merge, inplace_merge and the set operations are partitioned along the
+// merge path. Verify the corner cases of the merge path search: an empty
+// first or second sequence, sequences of equal keys only, and sequences of
+// very different lengths. The elements carry the index of the sequence they
+// come from, which verifies that equivalent elements are taken from the same
+// sequence as for the sequential algorithms.
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the key and the index of the sequence the element was taken from
+using element = std::pair<int, int>;
+
+struct compare_keys
+{
+    bool operator()(element const& lhs, element const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+std::vector<element> make_sequence(std::size_t size, int max_key, int tag)
+{
+    std::uniform_int_distribution<int> dist(0, max_key);
+
+    std::vector<element> result(size);
+    for (auto& e : result)
+    {
+        e = element(dist(gen), tag);
+    }
+    std::sort(result.begin(), result.end(), compare_keys());
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The crossing point of each diagonal splits the merged sequence into a
+// prefix made up of the first elements of both sequences.
+void test_merge_path_search(
+    std::vector<element> const& a, std::vector<element> const& b)
+{
+    using hpx::parallel::v1::detail::merge_path_search;
+
+    std::vector<element> merged;
+    std::merge(a.begin(), a.end(), b.begin(), b.end(),
+        std::back_inserter(merged), compare_keys());
+
+    std::size_t const size = a.size() + b.size();
+    std::size_t const step = (std::max)(size / 1000, std::size_t(1));
+    for (std::size_t diag = 0; diag <= size; diag += step)
+    {
+        std::size_t const pos = merge_path_search(a.begin(), a.size(),
+            b.begin(), b.size(), diag, compare_keys(),
+            hpx::parallel::util::projection_identity(),
+            hpx::parallel::util::projection_identity());
+
+        HPX_TEST_LTE(pos, (std::min)(diag, a.size()));
+        HPX_TEST_LTE(diag - pos, b.size());
+        HPX_TEST_EQ(std::size_t(std::count_if(merged.begin(),
+                        std::next(merged.begin(), diag),
+                        [](element const& e) { return e.second == 0; })),
+            pos);
+    }
+}
+
+template <typename ExPolicy>
+void test_merge(ExPolicy const& policy, std::vector<element> const& a,
+    std::vector<element> const& b)
+{
+    std::vector<element> expected;
+    std::merge(a.begin(), a.end(), b.begin(), b.end(),
+        std::back_inserter(expected), compare_keys());
+
+    {
+        std::vector<element> result(a.size() + b.size());
+        auto end = hpx::merge(policy, a.begin(), a.end(), b.begin(), b.end(),
+            result.begin(), compare_keys());
+        HPX_TEST(end == result.end());
+        HPX_TEST(result == expected);
+    }
+
+    {
+        std::vector<element> result(a);
+        result.insert(result.end(), b.begin(), b.end());
+        hpx::inplace_merge(policy, result.begin(),
+            std::next(result.begin(), a.size()), result.end(), compare_keys());
+        HPX_TEST(result == expected);
+    }
+}
+
+// The set operations fill the output from the front, the elements behind the
+// returned iterator are not specified.
+template <typename ExPolicy, typename F, typename G>
+void test_set_operation(ExPolicy const& policy, std::vector<element> const& a,
+    std::vector<element> const& b, F&& seq_op, G&& par_op)
+{
+    std::vector<element> expected;
+    seq_op(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected),
+        compare_keys());
+
+    std::vector<element> result(a.size() + b.size());
+    auto end = par_op(policy, a.begin(), a.end(), b.begin(), b.end(),
+        result.begin(), compare_keys());
+
+    HPX_TEST(end == std::next(result.begin(), expected.size()));
+    result.erase(end, result.end());
+    HPX_TEST(result == expected);
+}
+
+template <typename ExPolicy>
+void test_set_operations(ExPolicy const& policy, std::vector<element> const& a,
+    std::vector<element> const& b)
+{
+    test_set_operation(
+        policy, a, b,
+        [](auto... args) { return std::set_union(args...); },
+        [](auto const& p, auto... args) {
+            return hpx::set_union(p, args...);
+        });
+    test_set_operation(
+        policy, a, b,
+        [](auto... args) { return std::set_intersection(args...); },
+        [](auto const& p, auto... args) {
+            return hpx::set_intersection(p, args...);
+        });
+    test_set_operation(
+        policy, a, b,
+        [](auto... args) { return std::set_difference(args...); },
+        [](auto const& p, auto... args) {
+            return hpx::set_difference(p, args...);
+        });
+    test_set_operation(
+        policy, a, b,
+        [](auto... args) { return std::set_symmetric_difference(args...); },
+        [](auto const& p, auto... args) {
+            return hpx::set_symmetric_difference(p, args...);
+        });
+}
+
+void test_sequences(
+    std::vector<element> const& a, std::vector<element> const& b)
+{
+    using namespace hpx::execution;
+
+    test_merge_path_search(a, b);
+
+    test_merge(seq, a, b);
+    test_merge(par, a, b);
+    test_merge(par.with(static_chunk_size(7)), a, b);
+
+    test_set_operations(seq, a, b);
+    test_set_operations(par, a, b);
+    test_set_operations(par.with(static_chunk_size(7)), a, b);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_merge_path()
+{
+    std::size_t const size = 100007;
+
+    std::vector<element> const empty;
+
+    // one of the sequences is empty
+    test_sequences(make_sequence(size, 1000, 0), empty);
+    test_sequences(empty, make_sequence(size, 1000, 1));
+    test_sequences(empty, empty);
+
+    // all keys are equal
+    test_sequences(make_sequence(size, 0, 0), make_sequence(size, 0, 1));
+    test_sequences(make_sequence(size, 0, 0), make_sequence(size / 3, 0, 1));
+
+    // the sequences have very different lengths
+    test_sequences(make_sequence(size, 1000, 0), make_sequence(1, 1000, 1));
+    test_sequences(make_sequence(1, 1000, 0), make_sequence(size, 1000, 1));
+    test_sequences(make_sequence(size, 1000, 0), make_sequence(17, 10, 1));
+    test_sequences(make_sequence(17, 10, 0), make_sequence(size, 1000, 1));
+
+    // few distinct keys, long runs of equivalent elements in both sequences
+    test_sequences(make_sequence(size, 3, 0), make_sequence(size / 2, 3, 1));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_merge_path();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,338 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/for_loop_nd.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+using hpx::experimental::tile_order;
+
+// every index of the index space is covered by exactly one tile
+template <std::size_t N>
+void test_tiled_shape(std::array<int, N> const& first,
+    std::array<int, N> const& last, std::array<std::size_t, N> const& extents,
+    tile_order order)
+{
+    std::size_t count = 1;
+    for (std::size_t d = 0; d != N; ++d)
+    {
+        count *= std::size_t(last[d] - first[d]);
+    }
+
+    auto shape =
+        hpx::experimental::make_tiled_shape(first, last, extents, order);
+
+    std::vector<int> covered(count, 0);
+    for (auto const& tile : shape)
+    {
+        std::size_t tile_count = 1;
+        for (std::size_t d = 0; d != N; ++d)
+        {
+            HPX_TEST(tile.first[d] < tile.last[d]);
+            HPX_TEST(std::size_t(tile.last[d] - tile.first[d]) <= extents[d]);
+            tile_count *= std::size_t(tile.last[d] - tile.first[d]);
+        }
+
+        std::array<int, N> index = tile.first;
+        for (std::size_t i = 0; i != tile_count; ++i)
+        {
+            std::size_t linear = 0;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                linear = linear * std::size_t(last[d] - first[d]) +
+                    std::size_t(index[d] - first[d]);
+            }
+            ++covered[linear];
+
+            for (std::size_t d = N; d-- != 0; /**/)
+            {
+                if (++index[d] != tile.last[d])
+                {
+                    break;
+                }
+                index[d] = tile.first[d];
+            }
+        }
+    }
+
+    for (int c : covered)
+    {
+        HPX_TEST_EQ(c, 1);
+    }
+}
+
+// consecutive tiles along the Hilbert curve are neighbors
+void test_hilbert_order()
+{
+    auto shape = hpx::experimental::make_tiled_shape(std::array<int, 2>{{0, 0}},
+        std::array<int, 2>{{64, 64}}, std::array<std::size_t, 2>{{8, 8}},
+        tile_order::hilbert);
+
+    HPX_TEST_EQ(shape.size(), std::size_t(64));
+    for (std::size_t i = 1; i < shape.size(); ++i)
+    {
+        int distance = std::abs(shape[i].first[0] - shape[i - 1].first[0]) +
+            std::abs(shape[i].first[1] - shape[i - 1].first[1]);
+        HPX_TEST_EQ(distance, 8);
+    }
+}
+
+// the tiles of huge index spaces can't be ordered along a curve
+void test_too_many_tiles()
+{
+    std::array<int, 3> const first{{0, 0, 0}};
+    std::array<int, 3> const last{{1 << 22, 1, 1}};
+    std::array<std::size_t, 3> const extents{{1, 1, 1}};
+
+    for (tile_order order : {tile_order::morton, tile_order::hilbert})
+    {
+        bool caught_exception = false;
+        try
+        {
+            hpx::experimental::make_tiled_shape(first, last, extents, order);
+            HPX_TEST(false);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+void test_tiled_shapes()
+{
+    for (tile_order order :
+        {tile_order::row_major, tile_order::morton, tile_order::hilbert})
+    {
+        test_tiled_shape<1>({{-5}}, {{1000}}, {{64}}, order);
+        test_tiled_shape<2>({{0, 0}}, {{100, 37}}, {{16, 8}}, order);
+        test_tiled_shape<2>({{-3, 7}}, {{250, 9}}, {{7, 64}}, order);
+        test_tiled_shape<3>({{0, 0, 0}}, {{33, 17, 40}}, {{8, 4, 16}}, order);
+        test_tiled_shape<3>({{1, 2, 3}}, {{2, 3, 4}}, {{8, 8, 8}}, order);
+    }
+
+    HPX_TEST(hpx::experimental::make_tiled_shape(std::array<int, 2>{{0, 0}},
+        std::array<int, 2>{{0, 10}})
+                 .empty());
+
+    test_hilbert_order();
+    test_too_many_tiles();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_loop_nd_2d(ExPolicy&& policy)
+{
+    int const nx = 300 + gen() % 100;
+    int const ny = 200 + gen() % 100;
+
+    std::vector<std::atomic<int>> c(std::size_t(nx) * ny);
+    hpx::experimental::for_loop_nd(policy, std::array<int, 2>{{0, 0}},
+        std::array<int, 2>{{nx, ny}},
+        [&](int i, int j) { ++c[std::size_t(i) * ny + j]; });
+
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_nd_3d(ExPolicy&& policy)
+{
+    int const nx = 30 + gen() % 20;
+    int const ny = 40 + gen() % 20;
+    int const nz = 50 + gen() % 20;
+
+    std::vector<std::atomic<int>> c(std::size_t(nx) * ny * nz);
+    hpx::experimental::for_loop_nd(policy, std::array<int, 3>{{0, 0, 0}},
+        std::array<int, 3>{{nx, ny, nz}}, [&](int i, int j, int k) {
+            ++c[(std::size_t(i) * ny + j) * nz + k];
+        });
+
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_nd_async(ExPolicy&& policy)
+{
+    int const nx = 300 + gen() % 100;
+    int const ny = 200 + gen() % 100;
+
+    std::vector<std::atomic<int>> c(std::size_t(nx) * ny);
+    auto f = hpx::experimental::for_loop_nd(policy, std::array<int, 2>{{0, 0}},
+        std::array<int, 2>{{nx, ny}},
+        [&](int i, int j) { ++c[std::size_t(i) * ny + j]; });
+    f.wait();
+
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_nd_reduction(ExPolicy&& policy)
+{
+    int const nx = 100 + gen() % 100;
+    int const ny = 20 + gen() % 20;
+    int const nz = 30 + gen() % 20;
+
+    std::size_t sum = 0;
+    hpx::experimental::for_loop_nd(policy, std::array<int, 3>{{0, 0, 0}},
+        std::array<int, 3>{{nx, ny, nz}}, hpx::parallel::reduction_plus(sum),
+        [](int i, int j, int k, std::size_t& sum) {
+            sum += std::size_t(i) + j + k;
+        });
+
+    std::size_t expected = 0;
+    for (int i = 0; i != nx; ++i)
+    {
+        for (int j = 0; j != ny; ++j)
+        {
+            for (int k = 0; k != nz; ++k)
+            {
+                expected += std::size_t(i) + j + k;
+            }
+        }
+    }
+    HPX_TEST_EQ(sum, expected);
+}
+
+template <typename ExPolicy>
+void test_for_loop_nd_shape(ExPolicy&& policy)
+{
+    auto shape = hpx::experimental::make_tiled_shape(
+        std::array<int, 2>{{-10, 5}}, std::array<int, 2>{{290, 405}},
+        std::array<std::size_t, 2>{{32, 16}}, tile_order::morton);
+
+    std::vector<std::atomic<int>> c(300 * 400);
+    hpx::experimental::for_loop_nd(policy, shape,
+        [&](int i, int j) { ++c[std::size_t(i + 10) * 400 + (j - 5)]; });
+
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+// the tiles can be used as the shape of a bulk execution
+void test_bulk_shape()
+{
+    auto shape = hpx::experimental::make_tiled_shape(
+        std::array<int, 2>{{0, 0}}, std::array<int, 2>{{500, 300}});
+
+    std::vector<std::atomic<int>> c(500 * 300);
+    hpx::execution::parallel_executor exec;
+    auto workitems = hpx::parallel::execution::bulk_async_execute(exec,
+        [&](hpx::experimental::index_tile<int, 2> const& tile) {
+            for (int i = tile.first[0]; i != tile.last[0]; ++i)
+            {
+                for (int j = tile.first[1]; j != tile.last[1]; ++j)
+                {
+                    ++c[std::size_t(i) * 300 + j];
+                }
+            }
+        },
+        shape);
+    hpx::wait_all(workitems);
+
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+void for_loop_nd_test()
+{
+    using namespace hpx::execution;
+
+    test_tiled_shapes();
+
+    test_for_loop_nd_2d(seq);
+    test_for_loop_nd_2d(par);
+    test_for_loop_nd_2d(par_unseq);
+
+    test_for_loop_nd_3d(seq);
+    test_for_loop_nd_3d(par);
+    test_for_loop_nd_3d(par_unseq);
+
+    test_for_loop_nd_async(seq(task));
+    test_for_loop_nd_async(par(task));
+
+    test_for_loop_nd_reduction(seq);
+    test_for_loop_nd_reduction(par);
+
+    test_for_loop_nd_shape(seq);
+    test_for_loop_nd_shape(par);
+
+    test_bulk_shape();
+
+    // without an execution policy
+    std::size_t count = 0;
+    hpx::experimental::for_loop_nd(std::array<int, 2>{{0, 0}},
+        std::array<int, 2>{{70, 90}}, [&](int, int) { ++count; });
+    HPX_TEST_EQ(count, std::size_t(70 * 90));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    for_loop_nd_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,227 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/merge_k.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(0);
+
+// the run and the position of each element are kept to verify stability
+struct element
+{
+    int key;
+    std::size_t run;
+    std::size_t pos;
+};
+
+struct compare_keys
+{
+    bool operator()(element const& lhs, element const& rhs) const
+    {
+        return lhs.key < rhs.key;
+    }
+};
+
+struct throw_always
+{
+    template <typename T>
+    bool operator()(T const&, T const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+std::vector<std::vector<element>> make_runs(
+    std::size_t num_runs, std::size_t max_size, int range)
+{
+    std::uniform_int_distribution<std::size_t> size_dist(0, max_size);
+    std::uniform_int_distribution<int> key_dist(0, range);
+
+    std::vector<std::vector<element>> runs(num_runs);
+    for (std::size_t i = 0; i != num_runs; ++i)
+    {
+        runs[i].resize(size_dist(gen));
+        for (element& e : runs[i])
+        {
+            e.key = key_dist(gen);
+            e.run = i;
+        }
+        std::stable_sort(runs[i].begin(), runs[i].end(), compare_keys());
+
+        for (std::size_t j = 0; j != runs[i].size(); ++j)
+        {
+            runs[i][j].pos = j;
+        }
+    }
+    return runs;
+}
+
+std::vector<element> make_solution(
+    std::vector<std::vector<element>> const& runs)
+{
+    std::vector<element> solution;
+    for (auto const& run : runs)
+    {
+        solution.insert(solution.end(), run.begin(), run.end());
+    }
+    std::stable_sort(solution.begin(), solution.end(), compare_keys());
+    return solution;
+}
+
+bool equal(std::vector<element> const& lhs, std::vector<element> const& rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+        [](element const& x, element const& y) {
+            return x.key == y.key && x.run == y.run && x.pos == y.pos;
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_merge_k(std::size_t num_runs, std::size_t max_size, int range)
+{
+    auto runs = make_runs(num_runs, max_size, range);
+    auto solution = make_solution(runs);
+
+    std::vector<element> dest(solution.size());
+    auto result =
+        hpx::experimental::merge_k(runs, dest.begin(), compare_keys());
+
+    HPX_TEST(result == dest.end());
+    HPX_TEST(equal(dest, solution));
+}
+
+template <typename ExPolicy>
+void test_merge_k(
+    ExPolicy&& policy, std::size_t num_runs, std::size_t max_size, int range)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    auto runs = make_runs(num_runs, max_size, range);
+    auto solution = make_solution(runs);
+
+    std::vector<element> dest(solution.size());
+    auto result = hpx::experimental::merge_k(
+        policy, runs, dest.begin(), compare_keys());
+
+    HPX_TEST(result == dest.end());
+    HPX_TEST(equal(dest, solution));
+}
+
+template <typename ExPolicy>
+void test_merge_k_async(
+    ExPolicy&& policy, std::size_t num_runs, std::size_t max_size, int range)
+{
+    auto runs = make_runs(num_runs, max_size, range);
+    auto solution = make_solution(runs);
+
+    std::vector<element> dest(solution.size());
+    auto f = hpx::experimental::merge_k(
+        policy, runs, dest.begin(), compare_keys());
+
+    HPX_TEST(f.get() == dest.end());
+    HPX_TEST(equal(dest, solution));
+}
+
+template <typename ExPolicy>
+void test_merge_k_exception(ExPolicy&& policy)
+{
+    std::vector<std::vector<int>> runs(64, std::vector<int>(10007));
+    std::vector<int> dest(64 * 10007);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::merge_k(policy, runs, dest.begin(), throw_always());
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void merge_k_test()
+{
+    using namespace hpx::execution;
+
+    // few long runs with many equivalent elements, and many short ones
+    for (auto [num_runs, max_size, range] :
+        {std::tuple<std::size_t, std::size_t, int>{3, 200000, 10},
+            {64, 20000, 1000}, {256, 4000, 100000}, {1, 100000, 10}})
+    {
+        test_merge_k(num_runs, max_size, range);
+        test_merge_k(seq, num_runs, max_size, range);
+        test_merge_k(par, num_runs, max_size, range);
+        test_merge_k(par_unseq, num_runs, max_size, range);
+
+        test_merge_k_async(seq(task), num_runs, max_size, range);
+        test_merge_k_async(par(task), num_runs, max_size, range);
+    }
+
+    // no runs at all and only empty runs
+    test_merge_k(par, 0, 0, 10);
+    test_merge_k(par, 17, 0, 10);
+
+    test_merge_k_exception(seq);
+    test_merge_k_exception(par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    merge_k_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -123,6 +123,39 @@ void test_nth_element_async(ExPolicy p, IteratorTag)
     }
 }
 
+// ranges large enough for the splitters to be selected from a sample,
+// both with distinct and with many equal elements
+template <typename ExPolicy>
+void test_nth_element_large(ExPolicy policy, std::size_t distinct)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::size_t const size = (1 << 20) + gen() % 1000;
+
+    std::vector<std::size_t> c(size);
+    std::generate(
+        std::begin(c), std::end(c), [&]() { return gen() % distinct; });
+
+    // minimum, median, 99th percentile, maximum and a random rank
+    for (std::size_t rank :
+        {std::size_t(0), size / 2, size * 99 / 100, size - 1, gen() % size})
+    {
+        std::vector<std::size_t> d = c;
+        hpx::nth_element(
+            policy, std::begin(d), std::begin(d) + rank, std::end(d));
+
+        std::vector<std::size_t> e = c;
+        std::nth_element(std::begin(e), std::begin(e) + rank, std::end(e));
+
+        HPX_TEST_EQ(d[rank], e[rank]);
+        HPX_TEST(std::all_of(std::begin(d), std::begin(d) + rank,
+            [&](std::size_t x) { return x <= d[rank]; }));
+        HPX_TEST(std::all_of(std::begin(d) + rank, std::end(d),
+            [&](std::size_t x) { return x >= d[rank]; }));
+    }
+}
+
 template <typename IteratorTag>
 void test_nth_element()
 {
@@ -139,6 +172,12 @@ void test_nth_element()
 void nth_element_test()
 {
     test_nth_element<std::random_access_iterator_tag>();
+
+    for (std::size_t distinct : {std::size_t(1) << 30, std::size_t(3)})
+    {
+        test_nth_element_large(hpx::execution::par, distinct);
+        test_nth_element_large(hpx::execution::par_unseq, distinct);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
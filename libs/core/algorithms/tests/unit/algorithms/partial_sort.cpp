@@ -11,8 +11,10 @@
 #include <hpx/parallel/algorithms/partial_sort.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <string>
 #include <vector>
@@ -109,6 +111,29 @@ void test_partial_sort_async(ExPolicy p, IteratorTag)
     }
 }
 
+// ranges large enough for the smallest elements to be selected in parallel
+template <typename ExPolicy>
+void test_partial_sort_large(ExPolicy policy)
+{
+    std::size_t const size = (1 << 20) + gen() % 1000;
+
+    std::vector<std::uint64_t> A(size);
+    std::iota(A.begin(), A.end(), std::uint64_t(0));
+    std::shuffle(A.begin(), A.end(), gen);
+
+    for (std::size_t middle :
+        {std::size_t(1), std::size_t(100), std::size_t(5000), size / 3, size})
+    {
+        std::vector<std::uint64_t> B = A;
+        hpx::partial_sort(policy, B.begin(), B.begin() + middle, B.end());
+
+        for (std::size_t j = 0; j < middle; ++j)
+        {
+            HPX_TEST_EQ(B[j], std::uint64_t(j));
+        }
+    }
+}
+
 template <typename IteratorTag>
 void test_partial_sort()
 {
@@ -120,6 +145,9 @@ void test_partial_sort()
 
     test_partial_sort_async(seq(task), IteratorTag());
     test_partial_sort_async(par(task), IteratorTag());
+
+    test_partial_sort_large(par);
+    test_partial_sort_large(par_unseq);
 }
 
 void partial_sort_test()
@@ -0,0 +1,211 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Integral and floating point keys sorted using std::less are radix sorted,
+// this verifies the results against the comparison based sorts.
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/parallel/algorithms/stable_sort.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_RADIX_SORT_TEST_SIZE 20007
+#else
+#define HPX_RADIX_SORT_TEST_SIZE 300007
+#endif
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T>
+std::vector<T> make_keys(std::size_t size)
+{
+    std::vector<T> c(size);
+    if constexpr (std::is_integral_v<T>)
+    {
+        // the distributions do not support character types
+        using dist_type =
+            std::conditional_t<(sizeof(T) < sizeof(int)), int, T>;
+        std::uniform_int_distribution<dist_type> dist(
+            std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max());
+        std::generate(
+            c.begin(), c.end(), [&]() { return static_cast<T>(dist(gen)); });
+    }
+    else
+    {
+        std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+        std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+
+        // special values
+        c[0] = std::numeric_limits<T>::infinity();
+        c[1] = -std::numeric_limits<T>::infinity();
+        c[2] = std::numeric_limits<T>::denorm_min();
+        c[3] = -std::numeric_limits<T>::denorm_min();
+        c[4] = std::numeric_limits<T>::lowest();
+        c[5] = std::numeric_limits<T>::max();
+        c[6] = T(0);
+        c[7] = -T(0);
+    }
+    return c;
+}
+
+template <typename T, typename ExPolicy>
+void test_radix_sort(ExPolicy&& policy)
+{
+    std::vector<T> c = make_keys<T>(HPX_RADIX_SORT_TEST_SIZE);
+    std::vector<T> d = c;
+
+    hpx::sort(policy, c.begin(), c.end());
+    std::sort(d.begin(), d.end());
+
+    HPX_TEST(c == d);
+
+    c = make_keys<T>(HPX_RADIX_SORT_TEST_SIZE);
+    d = c;
+
+    hpx::sort(policy, c.begin(), c.end(), std::less<T>());
+    std::sort(d.begin(), d.end());
+
+    HPX_TEST(c == d);
+}
+
+template <typename T, typename ExPolicy>
+void test_radix_sort_async(ExPolicy&& policy)
+{
+    std::vector<T> c = make_keys<T>(HPX_RADIX_SORT_TEST_SIZE);
+    std::vector<T> d = c;
+
+    hpx::future<void> f = hpx::sort(policy, c.begin(), c.end());
+    std::sort(d.begin(), d.end());
+    f.get();
+
+    HPX_TEST(c == d);
+}
+
+// -0.0 and 0.0 compare equal, their relative order has to be preserved
+template <typename T, typename ExPolicy>
+void test_radix_stable_sort(ExPolicy&& policy)
+{
+    std::vector<T> c(HPX_RADIX_SORT_TEST_SIZE);
+    std::uniform_int_distribution<int> dist(-2, 2);
+    std::generate(c.begin(), c.end(), [&]() {
+        int const value = dist(gen);
+        return value == 2 ? -T(0) : T(value);
+    });
+    std::vector<T> d = c;
+
+    hpx::stable_sort(policy, c.begin(), c.end());
+    std::stable_sort(d.begin(), d.end());
+
+    HPX_TEST(std::equal(c.begin(), c.end(), d.begin(), [](T lhs, T rhs) {
+        return lhs == rhs && std::signbit(lhs) == std::signbit(rhs);
+    }));
+}
+
+template <typename ExPolicy>
+void test_radix_sort_by_key(ExPolicy&& policy)
+{
+    std::vector<std::int64_t> keys(HPX_RADIX_SORT_TEST_SIZE);
+    std::uniform_int_distribution<std::int64_t> dist(-1000, 1000);
+    std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+
+    std::vector<std::size_t> values(keys.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = i;
+    }
+    std::vector<std::int64_t> o_keys = keys;
+
+    hpx::parallel::sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin());
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+
+    bool matches = true;
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        matches = matches && keys[i] == o_keys[values[i]];
+    }
+    HPX_TEST(matches);
+}
+
+void radix_sort_test()
+{
+    using namespace hpx::execution;
+
+    test_radix_sort<std::int8_t>(seq);
+    test_radix_sort<std::int8_t>(par);
+    test_radix_sort<std::uint16_t>(par);
+    test_radix_sort<int>(seq);
+    test_radix_sort<int>(par);
+    test_radix_sort<std::uint32_t>(par_unseq);
+    test_radix_sort<std::int64_t>(seq);
+    test_radix_sort<std::int64_t>(par);
+    test_radix_sort<std::uint64_t>(par);
+    test_radix_sort<float>(seq);
+    test_radix_sort<float>(par);
+    test_radix_sort<double>(seq);
+    test_radix_sort<double>(par);
+
+    test_radix_sort_async<std::int64_t>(seq(task));
+    test_radix_sort_async<std::int64_t>(par(task));
+    test_radix_sort_async<double>(par(task));
+
+    test_radix_stable_sort<float>(seq);
+    test_radix_stable_sort<double>(par);
+
+    test_radix_sort_by_key(seq);
+    test_radix_sort_by_key(par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    radix_sort_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -400,6 +400,75 @@ void test_reduce_by_key_async(
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// The parallel implementation splits the keys into chunks, one per core, of
+// at least 16384 keys each. Use segments crossing the chunk boundaries
+// wherever these are: short segments of varying length, and one segment
+// longer than half of the input which spans at least one boundary if there
+// are two or more chunks. The output aliases the input.
+template <typename ExPolicy>
+void test_reduce_by_key_chunks(ExPolicy&& policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::size_t const count = 8 * 16384 + 13;
+    std::size_t const long_segment = count / 2 + 1;
+
+    std::vector<int> keys, values;
+    std::vector<int> check_keys, check_values;
+    keys.reserve(count);
+    values.reserve(count);
+
+    auto add_segment = [&](std::size_t length) {
+        int const key = static_cast<int>(check_keys.size());
+        int sum = 0;
+        for (std::size_t i = 0; i != length; ++i)
+        {
+            int const value = static_cast<int>(keys.size() % 7);
+            keys.push_back(key);
+            values.push_back(value);
+            sum += value;
+        }
+        check_keys.push_back(key);
+        check_values.push_back(sum);
+    };
+
+    std::size_t length = 1;
+    bool added_long_segment = false;
+    while (keys.size() != count)
+    {
+        if (!added_long_segment && keys.size() >= count / 8)
+        {
+            add_segment(long_segment);
+            added_long_segment = true;
+        }
+        else
+        {
+            add_segment((std::min)(length, count - keys.size()));
+            length = length % 97 + 1;
+        }
+    }
+
+    auto result = hpx::parallel::reduce_by_key(std::forward<ExPolicy>(policy),
+        keys.begin(), keys.end(), values.begin(), keys.begin(), values.begin());
+
+    HPX_TEST(result.in == std::next(keys.begin(), check_keys.size()));
+    HPX_TEST(result.out == std::next(values.begin(), check_values.size()));
+    HPX_TEST(std::equal(check_keys.begin(), check_keys.end(), keys.begin()));
+    HPX_TEST(
+        std::equal(check_values.begin(), check_values.end(), values.begin()));
+}
+
+void test_reduce_by_key_chunks()
+{
+    using namespace hpx::execution;
+
+    test_reduce_by_key_chunks(seq);
+    test_reduce_by_key_chunks(par);
+    test_reduce_by_key_chunks(par_unseq);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void test_reduce_by_key1()
 {
@@ -496,6 +565,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     gen.seed(seed);
 
     test_reduce_by_key1();
+    test_reduce_by_key_chunks();
     //    test_reduce_by_key2();
     return hpx::local::finalize();
 }
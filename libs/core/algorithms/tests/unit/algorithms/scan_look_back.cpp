@@ -0,0 +1,326 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The single-pass scans combine the results of the preceding partitions by
+// looking back across their descriptors. Exercise the look-back with many
+// small partitions, with a result type which is not default constructible,
+// with a predicate counting its invocations and with a partition failing
+// while the others are looking back.
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/numeric.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The affine maps x -> a * x + b compose associatively, but not
+// commutatively, exposing partition results combined in the wrong order.
+struct affine_map
+{
+    affine_map(std::uint32_t a, std::uint32_t b)
+      : a_(a)
+      , b_(b)
+    {
+    }
+
+    // apply lhs first, then rhs
+    friend affine_map compose(affine_map const& lhs, affine_map const& rhs)
+    {
+        return affine_map(rhs.a_ * lhs.a_, rhs.a_ * lhs.b_ + rhs.b_);
+    }
+
+    friend bool operator==(affine_map const& lhs, affine_map const& rhs)
+    {
+        return lhs.a_ == rhs.a_ && lhs.b_ == rhs.b_;
+    }
+
+    std::uint32_t a_;
+    std::uint32_t b_;
+};
+
+struct compose_maps
+{
+    affine_map operator()(affine_map const& lhs, affine_map const& rhs) const
+    {
+        return compose(lhs, rhs);
+    }
+};
+
+std::vector<affine_map> make_maps(std::size_t count)
+{
+    std::vector<affine_map> maps;
+    maps.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        maps.emplace_back(std::uint32_t(2 * i + 3), std::uint32_t(i));
+    }
+    return maps;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Many more partitions than cores, every partition has to look back.
+void test_many_partitions()
+{
+    auto policy =
+        hpx::execution::par.with(hpx::execution::static_chunk_size(7));
+
+    std::vector<std::size_t> c(100007);
+    std::iota(std::begin(c), std::end(c), std::size_t(1));
+
+    {
+        std::vector<std::size_t> d(c.size());
+        std::vector<std::size_t> expected(c.size());
+        std::partial_sum(std::begin(c), std::end(c), std::begin(expected));
+
+        hpx::inclusive_scan(policy, std::begin(c), std::end(c), std::begin(d));
+        HPX_TEST(d == expected);
+    }
+
+    {
+        std::vector<std::size_t> d(c.size());
+        std::vector<std::size_t> expected(c.size());
+        std::exclusive_scan(
+            std::begin(c), std::end(c), std::begin(expected), std::size_t(5));
+
+        hpx::exclusive_scan(
+            policy, std::begin(c), std::end(c), std::begin(d), std::size_t(5));
+        HPX_TEST(d == expected);
+    }
+
+    {
+        std::vector<std::size_t> d(c.size());
+        std::vector<std::size_t> expected;
+        std::copy_if(std::begin(c), std::end(c), std::back_inserter(expected),
+            [](std::size_t v) { return v % 3 == 0; });
+
+        auto result = hpx::copy_if(policy, std::begin(c), std::end(c),
+            std::begin(d), [](std::size_t v) { return v % 3 == 0; });
+        HPX_TEST(result == std::next(std::begin(d), expected.size()));
+
+        d.resize(expected.size());
+        HPX_TEST(d == expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The partition results are kept without default constructing them, a
+// non-commutative operation verifies their order.
+void test_not_default_constructible()
+{
+    auto policy =
+        hpx::execution::par.with(hpx::execution::static_chunk_size(13));
+
+    std::vector<affine_map> const c = make_maps(10007);
+    affine_map const init(1, 1);
+
+    {
+        std::vector<affine_map> d(c.size(), init);
+        std::vector<affine_map> expected(c.size(), init);
+        std::inclusive_scan(std::begin(c), std::end(c), std::begin(expected),
+            compose_maps(), init);
+
+        hpx::inclusive_scan(policy, std::begin(c), std::end(c), std::begin(d),
+            compose_maps(), init);
+        HPX_TEST(d == expected);
+    }
+
+    {
+        std::vector<affine_map> d(c.size(), init);
+        std::vector<affine_map> expected(c.size(), init);
+        std::exclusive_scan(std::begin(c), std::end(c), std::begin(expected),
+            init, compose_maps());
+
+        hpx::exclusive_scan(policy, std::begin(c), std::end(c), std::begin(d),
+            init, compose_maps());
+        HPX_TEST(d == expected);
+    }
+
+    {
+        auto conv = [](affine_map const& m) {
+            return affine_map(m.a_, m.b_ + 1);
+        };
+
+        std::vector<affine_map> d(c.size(), init);
+        std::vector<affine_map> expected(c.size(), init);
+        std::transform_inclusive_scan(std::begin(c), std::end(c),
+            std::begin(expected), compose_maps(), conv, init);
+
+        hpx::transform_inclusive_scan(policy, std::begin(c), std::end(c),
+            std::begin(d), compose_maps(), conv, init);
+        HPX_TEST(d == expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Partitions which are counted before their output position is known are
+// copied using the stored results of the predicate, the predicate is invoked
+// exactly once for each element.
+void test_predicate_invocations()
+{
+    auto policy =
+        hpx::execution::par.with(hpx::execution::static_chunk_size(7));
+
+    std::vector<std::size_t> c(100007);
+    std::iota(std::begin(c), std::end(c), std::size_t(0));
+
+    std::size_t const num_true = (c.size() + 2) / 3;
+
+    // suspending the predicate once in a while makes the following
+    // partitions count their elements before they are copied
+    std::atomic<std::size_t> invocations(0);
+    auto pred = [&invocations](std::size_t v) {
+        ++invocations;
+        if (v % 10007 == 0)
+        {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return v % 3 == 0;
+    };
+
+    {
+        std::vector<std::size_t> d(c.size());
+        std::vector<std::size_t> expected;
+        std::copy_if(std::begin(c), std::end(c), std::back_inserter(expected),
+            [](std::size_t v) { return v % 3 == 0; });
+
+        auto result = hpx::copy_if(
+            policy, std::begin(c), std::end(c), std::begin(d), pred);
+        HPX_TEST(result == std::next(std::begin(d), expected.size()));
+        HPX_TEST_EQ(invocations.load(), c.size());
+
+        d.resize(expected.size());
+        HPX_TEST(d == expected);
+    }
+
+    invocations = 0;
+    {
+        std::vector<std::size_t> d(c.size());
+        auto result = hpx::remove_copy_if(
+            policy, std::begin(c), std::end(c), std::begin(d), pred);
+        HPX_TEST(result == std::next(std::begin(d), c.size() - num_true));
+        HPX_TEST_EQ(invocations.load(), c.size());
+    }
+
+    invocations = 0;
+    {
+        std::vector<std::size_t> d_true(c.size());
+        std::vector<std::size_t> d_false(c.size());
+        auto result = hpx::partition_copy(policy, std::begin(c), std::end(c),
+            std::begin(d_true), std::begin(d_false), pred);
+        HPX_TEST(result.first == std::next(std::begin(d_true), num_true));
+        HPX_TEST(result.second ==
+            std::next(std::begin(d_false), c.size() - num_true));
+        HPX_TEST_EQ(invocations.load(), c.size());
+
+        for (std::size_t i = 0; i != num_true; ++i)
+        {
+            HPX_TEST_EQ(d_true[i], 3 * i);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// A failing partition must not keep the partitions following it waiting
+// for its result.
+void test_exception()
+{
+    auto policy =
+        hpx::execution::par.with(hpx::execution::static_chunk_size(7));
+
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::size_t(0));
+    std::vector<std::size_t> d(c.size());
+
+    std::size_t const fail_at = c.size() / 2;
+
+    {
+        bool caught_exception = false;
+        try
+        {
+            hpx::transform_inclusive_scan(policy, std::begin(c), std::end(c),
+                std::begin(d), std::plus<std::size_t>(),
+                [fail_at](std::size_t v) {
+                    if (v == fail_at)
+                        throw std::runtime_error("test");
+                    return v;
+                });
+
+            HPX_TEST(false);
+        }
+        catch (hpx::exception_list const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_LTE(std::size_t(1), e.size());
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    {
+        bool caught_exception = false;
+        try
+        {
+            hpx::copy_if(policy, std::begin(c), std::end(c), std::begin(d),
+                [fail_at](std::size_t v) {
+                    if (v == fail_at)
+                        throw std::runtime_error("test");
+                    return v % 2 == 0;
+                });
+
+            HPX_TEST(false);
+        }
+        catch (hpx::exception_list const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_LTE(std::size_t(1), e.size());
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // the algorithms are usable after a failure
+    std::vector<std::size_t> expected(c.size());
+    std::partial_sum(std::begin(c), std::end(c), std::begin(expected));
+
+    hpx::inclusive_scan(policy, std::begin(c), std::end(c), std::begin(d));
+    HPX_TEST(d == expected);
+}
+
+int hpx_main()
+{
+    test_many_partitions();
+    test_not_default_constructible();
+    test_predicate_invocations();
+    test_exception();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,142 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/exclusive_scan.hpp>
+#include <hpx/parallel/algorithms/inclusive_scan.hpp>
+#include <hpx/parallel/algorithms/transform_exclusive_scan.hpp>
+#include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const sizes[] = {0, 1, 3, 7, 8, 17, 33, 64, 1007, 10007};
+
+template <typename T, typename ExPolicy>
+void test_inclusive_scan(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+            v = T(std::rand() % 100);
+
+        std::vector<T> expected(size);
+        std::inclusive_scan(
+            c.begin(), c.end(), expected.begin(), std::plus<T>(), T(42));
+
+        std::vector<T> d(size);
+        hpx::inclusive_scan(
+            policy, c.begin(), c.end(), d.begin(), std::plus<T>(), T(42));
+        HPX_TEST(d == expected);
+
+        // an operation which can't be invoked with vector packs
+        std::fill(d.begin(), d.end(), T(0));
+        hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+            [](T lhs, T rhs) { return lhs + rhs; }, T(42));
+        HPX_TEST(d == expected);
+
+        std::exclusive_scan(c.begin(), c.end(), expected.begin(), T(42));
+
+        std::fill(d.begin(), d.end(), T(0));
+        hpx::exclusive_scan(policy, c.begin(), c.end(), d.begin(), T(42));
+        HPX_TEST(d == expected);
+
+        auto conv = [](T v) { return T(2 * v); };
+
+        std::transform_inclusive_scan(c.begin(), c.end(), expected.begin(),
+            std::plus<T>(), conv, T(42));
+
+        std::fill(d.begin(), d.end(), T(0));
+        hpx::transform_inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+            std::plus<T>(), conv, T(42));
+        HPX_TEST(d == expected);
+
+        std::transform_exclusive_scan(c.begin(), c.end(), expected.begin(),
+            T(42), std::plus<T>(), conv);
+
+        std::fill(d.begin(), d.end(), T(0));
+        hpx::transform_exclusive_scan(policy, c.begin(), c.end(), d.begin(),
+            T(42), std::plus<T>(), conv);
+        HPX_TEST(d == expected);
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_inclusive_scan_async(ExPolicy&& policy)
+{
+    std::vector<T> c(10007);
+    for (auto& v : c)
+        v = T(std::rand() % 100);
+
+    std::vector<T> expected(c.size());
+    std::inclusive_scan(c.begin(), c.end(), expected.begin());
+
+    std::vector<T> d(c.size());
+    auto f = hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin());
+    f.wait();
+    HPX_TEST(d == expected);
+}
+
+template <typename T>
+void test_inclusive_scan()
+{
+    using namespace hpx::execution;
+
+    test_inclusive_scan<T>(simd);
+    test_inclusive_scan<T>(par_simd);
+
+    test_inclusive_scan_async<T>(simd(task));
+    test_inclusive_scan_async<T>(par_simd(task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_inclusive_scan<int>();
+    test_inclusive_scan<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/minmax.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The small value range makes sure there are many equivalent elements, the
+// algorithms have to return the first smallest and the last largest of them.
+std::size_t const sizes[] = {0, 1, 3, 7, 8, 17, 33, 64, 1007, 10007};
+
+template <typename T, typename ExPolicy>
+void test_minmax_element(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+            v = T(std::rand() % 10);
+
+        auto expected = std::minmax_element(c.begin(), c.end());
+
+        HPX_TEST(hpx::min_element(policy, c.begin(), c.end()) ==
+            std::min_element(c.begin(), c.end()));
+        HPX_TEST(hpx::max_element(policy, c.begin(), c.end()) ==
+            std::max_element(c.begin(), c.end()));
+
+        auto result = hpx::minmax_element(policy, c.begin(), c.end());
+        HPX_TEST(result.min == expected.first);
+        HPX_TEST(result.max == expected.second);
+
+        auto greater = [](auto const& lhs, auto const& rhs) {
+            return lhs > rhs;
+        };
+        HPX_TEST(hpx::min_element(policy, c.begin(), c.end(), greater) ==
+            std::min_element(c.begin(), c.end(), greater));
+        HPX_TEST(hpx::max_element(policy, c.begin(), c.end(), greater) ==
+            std::max_element(c.begin(), c.end(), greater));
+
+        // a predicate which can't be invoked with vector packs
+        auto less = [](T lhs, T rhs) { return lhs < rhs; };
+        result = hpx::minmax_element(policy, c.begin(), c.end(), less);
+        HPX_TEST(result.min == expected.first);
+        HPX_TEST(result.max == expected.second);
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_minmax_element_async(ExPolicy&& policy)
+{
+    std::vector<T> c(10007);
+    for (auto& v : c)
+        v = T(std::rand() % 10);
+
+    auto expected = std::minmax_element(c.begin(), c.end());
+
+    auto f = hpx::minmax_element(policy, c.begin(), c.end());
+    auto result = f.get();
+    HPX_TEST(result.min == expected.first);
+    HPX_TEST(result.max == expected.second);
+}
+
+template <typename T>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element<T>(simd);
+    test_minmax_element<T>(par_simd);
+
+    test_minmax_element_async<T>(simd(task));
+    test_minmax_element_async<T>(par_simd(task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_minmax_element<int>();
+    test_minmax_element<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
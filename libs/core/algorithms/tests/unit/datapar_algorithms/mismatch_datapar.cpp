@@ -0,0 +1,126 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/mismatch.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const sizes[] = {1, 3, 7, 8, 17, 33, 64, 1007, 10007};
+
+template <typename T, typename ExPolicy>
+void test_mismatch(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c1(size);
+        for (auto& v : c1)
+            v = T(std::rand() % 100);
+
+        std::vector<T> c2 = c1;
+        std::size_t const pos = std::rand() % size;
+        c2[pos] += T(1);
+
+        auto expected = std::mismatch(c1.begin(), c1.end(), c2.begin());
+        HPX_TEST(expected.first == std::next(c1.begin(), pos));
+
+        auto result =
+            hpx::mismatch(policy, c1.begin(), c1.end(), c2.begin());
+        HPX_TEST(result == expected);
+
+        result = hpx::mismatch(
+            policy, c1.begin(), c1.end(), c2.begin(), c2.end());
+        HPX_TEST(result == expected);
+
+        // a predicate which can't be invoked with vector packs
+        result = hpx::mismatch(policy, c1.begin(), c1.end(), c2.begin(),
+            c2.end(), [](T lhs, T rhs) { return lhs == rhs; });
+        HPX_TEST(result == expected);
+
+        // the second sequence is shorter than the first one
+        result = hpx::mismatch(policy, c1.begin(), c1.end(), c1.begin(),
+            std::next(c1.begin(), pos));
+        HPX_TEST(result.first == std::next(c1.begin(), pos));
+
+        result = hpx::mismatch(policy, c1.begin(), c1.end(), c1.begin());
+        HPX_TEST(result.first == c1.end());
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_mismatch_async(ExPolicy&& policy)
+{
+    std::vector<T> c1(10007);
+    for (auto& v : c1)
+        v = T(std::rand() % 100);
+
+    std::vector<T> c2 = c1;
+    std::size_t const pos = std::rand() % c1.size();
+    c2[pos] += T(1);
+
+    auto f = hpx::mismatch(policy, c1.begin(), c1.end(), c2.begin());
+    HPX_TEST(f.get().first == std::next(c1.begin(), pos));
+}
+
+template <typename T>
+void test_mismatch()
+{
+    using namespace hpx::execution;
+
+    test_mismatch<T>(simd);
+    test_mismatch<T>(par_simd);
+
+    test_mismatch_async<T>(simd(task));
+    test_mismatch_async<T>(par_simd(task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_mismatch<int>();
+    test_mismatch<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,146 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce.hpp>
+#include <hpx/parallel/algorithms/transform_reduce.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The sizes cover empty sequences, partial vector packs and sequences which
+// are processed using all of the accumulators of the vectorized reduction.
+std::size_t const sizes[] = {0, 1, 3, 7, 8, 17, 33, 64, 1007, 10007};
+
+template <typename T, typename ExPolicy>
+void test_reduce(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+            v = T(std::rand() % 100);
+
+        T const expected = std::accumulate(c.begin(), c.end(), T(42));
+
+        HPX_TEST_EQ(hpx::reduce(policy, c.begin(), c.end(), T(42)), expected);
+        HPX_TEST_EQ(
+            hpx::reduce(policy, c.begin(), c.end(), T(42), std::plus<T>()),
+            expected);
+        HPX_TEST_EQ(hpx::reduce(policy, c.begin(), c.end(), T(42),
+                        [](auto const& lhs, auto const& rhs) {
+                            return lhs + rhs;
+                        }),
+            expected);
+
+        // a reduction operation which can't be invoked with vector packs
+        HPX_TEST_EQ(hpx::reduce(policy, c.begin(), c.end(), T(42),
+                        [](T lhs, T rhs) { return lhs + rhs; }),
+            expected);
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_transform_reduce(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+            v = T(std::rand() % 100);
+
+        T expected = T(1);
+        for (T v : c)
+            expected += v * v;
+
+        HPX_TEST_EQ(hpx::transform_reduce(policy, c.begin(), c.end(), T(1),
+                        std::plus<T>(), [](auto const& v) { return v * v; }),
+            expected);
+        HPX_TEST_EQ(hpx::transform_reduce(policy, c.begin(), c.end(), T(1),
+                        std::plus<T>(), [](T v) { return v * v; }),
+            expected);
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_reduce_async(ExPolicy&& policy)
+{
+    std::vector<T> c(10007);
+    for (auto& v : c)
+        v = T(std::rand() % 100);
+
+    T const expected = std::accumulate(c.begin(), c.end(), T(0));
+
+    auto f = hpx::reduce(policy, c.begin(), c.end(), T(0));
+    HPX_TEST_EQ(f.get(), expected);
+
+    auto g = hpx::transform_reduce(policy, c.begin(), c.end(), T(0),
+        std::plus<T>(), [](auto const& v) { return v; });
+    HPX_TEST_EQ(g.get(), expected);
+}
+
+template <typename T>
+void test_reduce()
+{
+    using namespace hpx::execution;
+
+    test_reduce<T>(simd);
+    test_reduce<T>(par_simd);
+
+    test_transform_reduce<T>(simd);
+    test_transform_reduce<T>(par_simd);
+
+    test_reduce_async<T>(simd(task));
+    test_reduce_async<T>(par_simd(task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_reduce<int>();
+    test_reduce<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -30,6 +30,7 @@ namespace hpx {
             sync = 0x08,
             fork = 0x10,    // same as async, but forces continuation stealing
             apply = 0x20,
+            inline_if_cheap = 0x40,    // run cheap continuations inline
 
             sync_policies = 0x0a,     // sync | deferred
             async_policies = 0x15,    // async | task | fork
@@ -868,6 +869,14 @@ namespace hpx {
         /// Predefined launch policy representing delayed policy selection
         HPX_LOCAL_EXPORT static const detail::select_policy_generator select;
 
+        /// Predefined launch policy representing asynchronous execution,
+        /// except for continuations which are known to be cheap. Those are
+        /// run directly on the thread which makes their predecessor ready
+        /// (as long as the nesting depth of continuations on that thread
+        /// stays bounded). Anything else launched with this policy runs
+        /// on a new thread, as with \a launch::async.
+        HPX_LOCAL_EXPORT static const detail::policy_holder<> inline_if_cheap;
+
         /// \cond NOINTERNAL
         HPX_LOCAL_EXPORT static const detail::policy_holder<> all;
         HPX_LOCAL_EXPORT static const detail::policy_holder<> sync_policies;
@@ -891,6 +900,21 @@ namespace hpx {
             return bool(static_cast<int>(p.policy()) &
                 static_cast<int>(detail::launch_policy::async_policies));
         }
+
+        HPX_FORCEINLINE constexpr bool has_inline_if_cheap_policy(
+            launch p) noexcept
+        {
+            return bool(static_cast<int>(p.get_policy()) &
+                static_cast<int>(detail::launch_policy::inline_if_cheap));
+        }
+
+        template <typename F>
+        HPX_FORCEINLINE constexpr bool has_inline_if_cheap_policy(
+            detail::policy_holder<F> const& p) noexcept
+        {
+            return bool(static_cast<int>(p.policy()) &
+                static_cast<int>(detail::launch_policy::inline_if_cheap));
+        }
     }    // namespace detail
     /// \endcond
 }    // namespace hpx
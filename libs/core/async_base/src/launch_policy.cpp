@@ -24,6 +24,9 @@ namespace hpx {
     const detail::select_policy_generator launch::select =
         detail::select_policy_generator{};
 
+    const detail::policy_holder<> launch::inline_if_cheap =
+        detail::policy_holder<>{detail::launch_policy::inline_if_cheap};
+
     const detail::policy_holder<> launch::all =
         detail::policy_holder<>{detail::launch_policy::all};
     const detail::policy_holder<> launch::sync_policies =
@@ -0,0 +1,224 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace concurrency {
+
+    /// \brief A single-owner, multi-thief work-stealing deque.
+    ///
+    /// This is the dynamic circular work-stealing deque described by Chase
+    /// and Lev (SPAA 2005), using the memory orderings from Le, Pop, Cohen
+    /// and Zappa Nardelli (PPoPP 2013). Exactly one thread (the owner) may
+    /// call \a push_bottom and \a pop_bottom; these operations do not need
+    /// any read-modify-write operation unless they race with a thief for the
+    /// last remaining element. Any thread may call \a steal, which removes
+    /// elements from the top (the opposite end) using a single CAS.
+    ///
+    /// The deque grows on demand. Buffers which have been replaced are kept
+    /// alive until the deque is destroyed as concurrent thieves may still be
+    /// reading from them.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires trivially copyable elements");
+
+        struct buffer
+        {
+            explicit buffer(std::int64_t capacity)
+              : capacity_(capacity)
+              , mask_(capacity - 1)
+              , data_(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+            {
+                HPX_ASSERT((capacity & (capacity - 1)) == 0);
+            }
+
+            T get(std::int64_t i) const noexcept
+            {
+                return data_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T x) noexcept
+            {
+                data_[i & mask_].store(x, std::memory_order_relaxed);
+            }
+
+            buffer* grow(std::int64_t bottom, std::int64_t top) const
+            {
+                buffer* b = new buffer(2 * capacity_);
+                for (std::int64_t i = top; i != bottom; ++i)
+                {
+                    b->put(i, get(i));
+                }
+                return b;
+            }
+
+            std::int64_t const capacity_;
+            std::int64_t const mask_;
+            std::unique_ptr<std::atomic<T>[]> data_;
+        };
+
+        static std::int64_t round_up_capacity(std::size_t capacity) noexcept
+        {
+            std::int64_t result = 2;
+            while (result < static_cast<std::int64_t>(capacity))
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+    public:
+        explicit chase_lev_deque(std::size_t initial_capacity = 128)
+          : top_()
+          , bottom_()
+          , buffer_(new buffer(round_up_capacity(initial_capacity)))
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+        ~chase_lev_deque()
+        {
+            delete buffer_.load(std::memory_order_relaxed);
+        }
+
+        /// Add an element at the bottom of the deque. Owner only.
+        void push_bottom(T x)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity_ - 1)
+            {
+                buffer* grown = a->grow(b, t);
+                retired_.emplace_back(a);
+                buffer_.store(grown, std::memory_order_release);
+                a = grown;
+            }
+
+            a->put(b, x);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// Add \a count elements at the bottom of the deque, publishing all
+        /// of them to thieves at once. The last element ends up at the
+        /// bottom. Owner only.
+        void push_bottom(T const* first, std::size_t count)
+        {
+            if (count == 0)
+                return;
+
+            std::int64_t const n = static_cast<std::int64_t>(count);
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+
+            while (b + n - t > a->capacity_)
+            {
+                buffer* grown = a->grow(b, t);
+                retired_.emplace_back(a);
+                buffer_.store(grown, std::memory_order_release);
+                a = grown;
+            }
+
+            for (std::int64_t i = 0; i != n; ++i)
+            {
+                a->put(b + i, first[i]);
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + n, std::memory_order_relaxed);
+        }
+
+        /// Remove the most recently pushed element from the bottom of the
+        /// deque. Owner only.
+        bool pop_bottom(T& x)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            x = a->get(b);
+            if (t != b)
+            {
+                // more than one element left, no thief can interfere
+                return true;
+            }
+
+            // this is the last element, race against thieves for it
+            bool result = top_.data_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+            return result;
+        }
+
+        /// Remove the least recently pushed element from the top of the
+        /// deque. May be called by any thread.
+        bool steal(T& x)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return false;
+            }
+
+            buffer* a = buffer_.load(std::memory_order_acquire);
+            x = a->get(t);
+            return top_.data_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        /// Return the (approximate) number of elements in the deque.
+        std::int64_t size() const noexcept
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? b - t : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        util::cache_line_data<std::atomic<std::int64_t>> top_;
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+        std::atomic<buffer*> buffer_;
+
+        // buffers replaced while growing, accessed by the owner only
+        std::vector<std::unique_ptr<buffer>> retired_;
+    };
+}}    // namespace hpx::concurrency
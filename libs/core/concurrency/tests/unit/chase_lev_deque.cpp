@@ -0,0 +1,152 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/config.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using deque_type = hpx::concurrency::chase_lev_deque<std::uint64_t>;
+
+void test_basic()
+{
+    {
+        // A default constructed deque should be empty.
+        deque_type q;
+        std::uint64_t val = 0;
+
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop_bottom(val));
+        HPX_TEST(!q.steal(val));
+    }
+
+    {
+        // The owner pops in LIFO order, the deque grows as needed.
+        deque_type q(2);
+        for (std::uint64_t i = 0; i != 100; ++i)
+        {
+            q.push_bottom(i);
+        }
+        HPX_TEST_EQ(q.size(), std::int64_t(100));
+
+        std::uint64_t val = 0;
+        for (std::uint64_t i = 100; i != 0; --i)
+        {
+            HPX_TEST(q.pop_bottom(val));
+            HPX_TEST_EQ(val, i - 1);
+        }
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop_bottom(val));
+    }
+
+    {
+        // Thieves steal in FIFO order.
+        deque_type q(2);
+        for (std::uint64_t i = 0; i != 100; ++i)
+        {
+            q.push_bottom(i);
+        }
+
+        std::uint64_t val = 0;
+        for (std::uint64_t i = 0; i != 100; ++i)
+        {
+            HPX_TEST(q.steal(val));
+            HPX_TEST_EQ(val, i);
+        }
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.steal(val));
+    }
+
+    {
+        // Bulk pushes behave like the equivalent sequence of single pushes.
+        deque_type q(2);
+        std::vector<std::uint64_t> values(100);
+        for (std::uint64_t i = 0; i != 100; ++i)
+        {
+            values[i] = i;
+        }
+        q.push_bottom(values.data(), 50);
+        q.push_bottom(values.data() + 50, 50);
+        HPX_TEST_EQ(q.size(), std::int64_t(100));
+
+        std::uint64_t val = 0;
+        HPX_TEST(q.pop_bottom(val));
+        HPX_TEST_EQ(val, std::uint64_t(99));
+        for (std::uint64_t i = 0; i != 99; ++i)
+        {
+            HPX_TEST(q.steal(val));
+            HPX_TEST_EQ(val, i);
+        }
+        HPX_TEST(q.empty());
+    }
+}
+
+void test_concurrent(std::size_t num_thieves, std::uint64_t items)
+{
+    deque_type q(16);
+    std::vector<std::atomic<int>> seen(items);
+    for (auto& s : seen)
+    {
+        s.store(0);
+    }
+
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t val = 0;
+            while (!done.load() || !q.empty())
+            {
+                if (q.steal(val))
+                {
+                    ++seen[val];
+                }
+            }
+        });
+    }
+
+    // The owner interleaves pushes and pops while thieves are stealing.
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        q.push_bottom(i);
+        if (i % 3 == 0 && q.pop_bottom(val))
+        {
+            ++seen[val];
+        }
+    }
+    while (q.pop_bottom(val))
+    {
+        ++seen[val];
+    }
+    done.store(true);
+
+    for (std::thread& t : thieves)
+    {
+        t.join();
+    }
+
+    // All items should have been taken exactly once.
+    for (auto const& s : seen)
+    {
+        HPX_TEST_EQ(s.load(), 1);
+    }
+}
+
+int main()
+{
+    test_basic();
+    test_concurrent(1, 100000);
+    test_concurrent(3, 100000);
+
+    return hpx::util::report_errors();
+}
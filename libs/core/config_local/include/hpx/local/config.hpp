@@ -393,6 +393,13 @@
 #  define HPX_THREAD_QUEUE_INIT_THREADS_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of thread objects (per stack size) which other worker
+// threads may return to the cache of recycled threads of a thread queue.
+#if !defined(HPX_THREAD_QUEUE_MAX_REMOTE_CACHED_THREADS)
+#  define HPX_THREAD_QUEUE_MAX_REMOTE_CACHED_THREADS 1024
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
@@ -430,6 +437,32 @@
 #endif
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Continuations attached using hpx::launch::inline_if_cheap are run inline if
+// their invocations took less than this many nanoseconds on average.
+#if !defined(HPX_CONTINUATION_MAX_INLINE_TIME)
+#  define HPX_CONTINUATION_MAX_INLINE_TIME 1000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Shared states of futures up to this size (in bytes) are allocated from
+// per-thread free lists. Setting this to zero disables the pooling.
+// Pooling would hide use-after-free errors from AddressSanitizer.
+#if !defined(HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE) &&                         \
+    defined(HPX_HAVE_ADDRESS_SANITIZER)
+#  define HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE 0
+#endif
+
+#if !defined(HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE)
+#  define HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE 512
+#endif
+
+// Maximum number of shared states kept on each per-thread free list, and
+// on each list of shared states returned to a thread by other threads.
+#if !defined(HPX_SHARED_STATE_POOL_MAX_CACHED)
+#  define HPX_SHARED_STATE_POOL_MAX_CACHED 1024
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Make sure we have support for more than 64 threads for Xeon Phi
 #if defined(__MIC__) && !defined(HPX_HAVE_MORE_THAN_64_THREADS)
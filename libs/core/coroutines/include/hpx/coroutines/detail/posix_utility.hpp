@@ -74,11 +74,34 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         HPX_LOCAL_EXPORT extern bool use_guard_pages;
 
+        // these global variables control whether stacks are carved out of
+        // larger pre-reserved regions (arenas), how many stacks each of these
+        // regions holds, and whether the regions should be backed by
+        // (transparent) huge pages (which is done only if guard pages are
+        // disabled, as a guard page per stack keeps the kernel from using
+        // huge pages)
+        HPX_LOCAL_EXPORT extern bool use_stack_arenas;
+        HPX_LOCAL_EXPORT extern std::size_t stack_arena_size;
+        HPX_LOCAL_EXPORT extern bool use_stack_huge_pages;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
+        // Allocate a stack of the given size from the arena for stacks of
+        // that size. Stacks returned to an arena are kept for later reuse.
+        HPX_LOCAL_EXPORT void* alloc_arena_stack(std::size_t size);
+
+        // Return a stack to the arena it was allocated from. Returns false if
+        // the stack was not allocated from an arena.
+        HPX_LOCAL_EXPORT bool free_arena_stack(void* stack, std::size_t size);
+
         inline void* alloc_stack(std::size_t size)
         {
+            if (use_stack_arenas)
+            {
+                return alloc_arena_stack(size);
+            }
+
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
 #if defined(__APPLE__)
@@ -143,6 +166,11 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
                 // We never free up the first page, as it's initialized only when the
                 // stack is created.
                 ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+
+                // Re-arm the watermark (it lives in the first page), this way
+                // the stack is released again only if it grows beyond its
+                // first page again.
+                *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
                 return true;
             }
 
@@ -151,6 +179,13 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 
         inline void free_stack(void* stack, std::size_t size)
         {
+            // stacks go back to the arena they were allocated from, even if
+            // arenas have been disabled in the meantime
+            if (free_arena_stack(stack, size))
+            {
+                return;
+            }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
             {
@@ -10,11 +10,203 @@
     defined(__FreeBSD__) || defined(__APPLE__)
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+#endif
+
 namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         ///////////////////////////////////////////////////////////////////////
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_LOCAL_EXPORT bool use_guard_pages = true;
+
+        // these are used to control the allocation of stacks from arenas
+        HPX_LOCAL_EXPORT bool use_stack_arenas = false;
+        HPX_LOCAL_EXPORT std::size_t stack_arena_size = 256;
+        HPX_LOCAL_EXPORT bool use_stack_huge_pages = false;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+        namespace {
+            // All stacks of the same size are carved out of a list of
+            // regions, each of which holds stack_arena_size stacks (plus
+            // their guard pages). Stacks are never given back to the system,
+            // returned stacks are kept on a free list instead. The address
+            // space of a region (and the memory of the stacks which did not
+            // grow) stays allocated until the process exits, even if none of
+            // its stacks is in use anymore.
+            //
+            // The guard page of a slot is still protected by a separate
+            // mprotect call when the slot is handed out for the first time,
+            // only the mmap per stack is saved.
+            struct stack_arena
+            {
+                std::size_t slot_size = 0;
+                char* next = nullptr;
+                char* end = nullptr;
+                std::vector<void*> free_stacks;
+            };
+
+            using mutex_type = hpx::util::detail::spinlock;
+
+            mutex_type& get_arena_mutex()
+            {
+                static mutex_type mtx;
+                return mtx;
+            }
+
+            std::map<std::size_t, stack_arena>& get_arenas()
+            {
+                static std::map<std::size_t, stack_arena> arenas;
+                return arenas;
+            }
+
+            // start and end addresses of all arena regions, used to decide
+            // whether a stack has to be returned to an arena
+            std::map<char*, char*>& get_arena_regions()
+            {
+                static std::map<char*, char*> regions;
+                return regions;
+            }
+
+            // set once the first arena region has been created
+            std::atomic<bool> arena_regions_exist(false);
+
+            char* map_arena_region(std::size_t size, bool huge_pages)
+            {
+                void* region = ::mmap(nullptr, size,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                    MAP_PRIVATE | MAP_ANON,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                    -1, 0);
+
+                if (region == MAP_FAILED)
+                {
+                    throw std::runtime_error(
+                        "mmap() failed to allocate thread stack arena");
+                }
+
+#if defined(MADV_HUGEPAGE)
+                // This is only a hint, the kernel falls back to normal pages
+                // if no huge pages are available.
+                if (huge_pages)
+                {
+                    ::madvise(region, size, MADV_HUGEPAGE);
+                }
+#else
+                HPX_UNUSED(huge_pages);
+#endif
+                return static_cast<char*>(region);
+            }
+        }    // namespace
+
+        void* alloc_arena_stack(std::size_t size)
+        {
+            std::size_t guard_size = 0;
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            if (use_guard_pages)
+            {
+                guard_size = EXEC_PAGESIZE;
+            }
+#endif
+
+            char* slot = nullptr;
+            std::size_t slot_guard_size = 0;
+            {
+                std::lock_guard<mutex_type> l(get_arena_mutex());
+
+                stack_arena& arena = get_arenas()[size];
+                if (!arena.free_stacks.empty())
+                {
+                    // recycled stacks already have their guard page set up
+                    // and their watermark re-armed
+                    void* stack = arena.free_stacks.back();
+                    arena.free_stacks.pop_back();
+                    return stack;
+                }
+
+                if (arena.next == arena.end)
+                {
+                    std::size_t const count =
+                        stack_arena_size != 0 ? stack_arena_size : 1;
+
+                    // A guard page below each stack splits the region into
+                    // one mapping per stack, which keeps the kernel from
+                    // backing it with huge pages. Guard pages take
+                    // precedence, huge pages are used only if no guard pages
+                    // are requested.
+                    arena.slot_size = size + guard_size;
+                    std::size_t const region_size = arena.slot_size * count;
+                    char* region = map_arena_region(
+                        region_size, use_stack_huge_pages && guard_size == 0);
+
+                    get_arena_regions()[region] = region + region_size;
+                    arena_regions_exist.store(true, std::memory_order_release);
+
+                    arena.next = region;
+                    arena.end = region + region_size;
+                }
+
+                slot = arena.next;
+                arena.next += arena.slot_size;
+                slot_guard_size = arena.slot_size - size;
+            }
+
+            if (slot_guard_size != 0)
+            {
+                // Add a guard page.
+                ::mprotect(slot, slot_guard_size, PROT_NONE);
+                slot += slot_guard_size;
+            }
+
+            // the watermark of a new stack has to be set before the stack is
+            // freed for the first time, otherwise the whole stack would be
+            // released
+            watermark_stack(slot, size);
+            return slot;
+        }
+
+        bool free_arena_stack(void* stack, std::size_t size)
+        {
+            if (!arena_regions_exist.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            {
+                std::lock_guard<mutex_type> l(get_arena_mutex());
+
+                auto& regions = get_arena_regions();
+                auto it = regions.upper_bound(static_cast<char*>(stack));
+                if (it == regions.begin() ||
+                    (--it)->second <= static_cast<char*>(stack))
+                {
+                    return false;
+                }
+            }
+
+            // Release the memory of stacks which have grown beyond their first
+            // page, stacks which did not grow are kept as they are.
+            reset_stack(stack, size);
+
+            std::lock_guard<mutex_type> l(get_arena_mutex());
+            get_arenas()[size].free_stacks.push_back(stack);
+            return true;
+        }
+#endif
 }}}}}    // namespace hpx::threads::coroutines::detail::posix
 #endif
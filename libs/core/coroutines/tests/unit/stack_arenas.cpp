@@ -0,0 +1,178 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that coroutine stacks allocated from arenas are reused, and that
+// their memory is released only if they have grown beyond their first page.
+
+#include <hpx/local/config.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#define HPX_TEST_STACK_ARENAS
+#endif
+#endif
+
+#if defined(HPX_TEST_STACK_ARENAS)
+#include <cstddef>
+#include <set>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+// every test uses its own stack size, and with that its own arena
+std::size_t const page_size = EXEC_PAGESIZE;
+
+void test_reuse()
+{
+    std::size_t const stack_size = 16 * page_size;
+
+    posix::use_stack_arenas = true;
+
+    void* stack1 = posix::alloc_stack(stack_size);
+    void* stack2 = posix::alloc_stack(stack_size);
+    HPX_TEST(stack1 != stack2);
+
+    // a stack which did not grow beyond its first page is kept as it is
+    char* bottom = static_cast<char*>(stack1);
+    *bottom = 42;
+    posix::free_stack(stack1, stack_size);
+
+    void* stack3 = posix::alloc_stack(stack_size);
+    HPX_TEST(stack3 == stack1);
+    HPX_TEST_EQ(*bottom, 42);
+
+    // a stack which has grown beyond its first page is released, and its
+    // watermark is re-armed
+    void** watermark = static_cast<void**>(stack3) +
+        ((stack_size - page_size) / sizeof(void*));
+    *watermark = nullptr;
+    posix::free_stack(stack3, stack_size);
+
+    void* stack4 = posix::alloc_stack(stack_size);
+    HPX_TEST(stack4 == stack1);
+    HPX_TEST_EQ(*bottom, 0);
+    HPX_TEST(!posix::reset_stack(stack4, stack_size));
+
+    // stacks are returned to their arena, even if arenas have been disabled
+    // in the meantime
+    posix::use_stack_arenas = false;
+    posix::free_stack(stack4, stack_size);
+    posix::free_stack(stack2, stack_size);
+
+    void* stack5 = posix::alloc_stack(stack_size);
+    HPX_TEST(stack5 != stack1 && stack5 != stack2);
+    posix::free_stack(stack5, stack_size);
+
+    posix::use_stack_arenas = true;
+    std::set<void*> stacks = {
+        posix::alloc_stack(stack_size), posix::alloc_stack(stack_size)};
+    HPX_TEST(stacks == (std::set<void*>{stack1, stack2}));
+
+    for (void* stack : stacks)
+    {
+        posix::free_stack(stack, stack_size);
+    }
+}
+
+// Allocating more stacks than an arena region holds creates new regions,
+// all stacks are reused afterwards.
+void test_multiple_regions()
+{
+    std::size_t const stack_size = 8 * page_size;
+
+    posix::use_stack_arenas = true;
+    posix::stack_arena_size = 4;
+
+    std::set<void*> stacks;
+    for (int i = 0; i != 10; ++i)
+    {
+        void* stack = posix::alloc_stack(stack_size);
+        HPX_TEST(stacks.insert(stack).second);
+
+        // the stack is usable all the way down
+        static_cast<char*>(stack)[0] = 1;
+        static_cast<char*>(stack)[stack_size - 1] = 1;
+    }
+
+    for (void* stack : stacks)
+    {
+        posix::free_stack(stack, stack_size);
+    }
+
+    std::set<void*> reused;
+    for (int i = 0; i != 10; ++i)
+    {
+        reused.insert(posix::alloc_stack(stack_size));
+    }
+    HPX_TEST(reused == stacks);
+
+    for (void* stack : reused)
+    {
+        posix::free_stack(stack, stack_size);
+    }
+}
+
+// Requesting huge pages keeps the guard page of every stack if guard pages
+// are enabled. Only without guard pages the stacks are packed back to back.
+void test_huge_pages()
+{
+    std::size_t const stack_size = 4 * page_size;
+
+    posix::use_stack_arenas = true;
+    posix::use_stack_huge_pages = true;
+
+    std::size_t expected_distance = stack_size;
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+    expected_distance += page_size;
+#endif
+
+    {
+        posix::use_guard_pages = true;
+
+        char* stack1 = static_cast<char*>(posix::alloc_stack(stack_size));
+        char* stack2 = static_cast<char*>(posix::alloc_stack(stack_size));
+        HPX_TEST_EQ(std::size_t(stack2 - stack1), expected_distance);
+
+        posix::free_stack(stack1, stack_size);
+        posix::free_stack(stack2, stack_size);
+    }
+
+    {
+        // a different stack size uses a different arena
+        std::size_t const unguarded_stack_size = stack_size + page_size;
+        posix::use_guard_pages = false;
+
+        char* stack1 =
+            static_cast<char*>(posix::alloc_stack(unguarded_stack_size));
+        char* stack2 =
+            static_cast<char*>(posix::alloc_stack(unguarded_stack_size));
+        HPX_TEST_EQ(std::size_t(stack2 - stack1), unguarded_stack_size);
+
+        posix::free_stack(stack1, unguarded_stack_size);
+        posix::free_stack(stack2, unguarded_stack_size);
+
+        posix::use_guard_pages = true;
+    }
+
+    posix::use_stack_huge_pages = false;
+}
+#endif
+
+int main()
+{
+#if defined(HPX_TEST_STACK_ARENAS)
+    test_reuse();
+    test_multiple_regions();
+    test_huge_pages();
+#endif
+
+    return hpx::util::report_errors();
+}
@@ -81,7 +81,11 @@ namespace hpx { namespace detail {
 
             lcos::local::futures_factory<result_type()> p(
                 util::deferred_call(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
-            if (hpx::detail::has_async_policy(policy))
+
+            // launch::inline_if_cheap decides only for continuations, other
+            // work is run on a new thread
+            if (hpx::detail::has_async_policy(policy) ||
+                hpx::detail::has_inline_if_cheap_policy(policy))
             {
                 threads::thread_id_ref_type tid =
                     p.apply(pool, desc.get_description(), policy);
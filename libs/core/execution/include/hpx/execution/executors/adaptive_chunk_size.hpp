@@ -0,0 +1,352 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/execution/detail/execution_parameter_callbacks.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace execution { namespace detail {
+    /// \cond NOINTERNAL
+
+    // The history of the invocations of one call site, see
+    // adaptive_chunk_size.cpp.
+    struct adaptive_chunk_size_site;
+
+    // The configuration a single invocation runs with.
+    struct adaptive_chunk_size_run
+    {
+        adaptive_chunk_size_site* site = nullptr;
+        std::size_t cores = 0;
+        std::size_t chunks_per_core = 0;
+        std::size_t count = 0;
+        std::uint64_t start = 0;    // nanoseconds
+    };
+
+    // The state shared by all copies of an adaptive_chunk_size object. The
+    // invocation hooks may be called on different copies of the object.
+    struct adaptive_chunk_size_state
+    {
+        hpx::util::detail::spinlock mtx;
+        std::size_t available_cores = 0;
+        adaptive_chunk_size_run run;
+
+        // the call site the object was used for last and the key it was
+        // looked up with, call sites are never destroyed
+        void const* key = nullptr;
+        adaptive_chunk_size_site* site = nullptr;
+    };
+
+    // The configuration a call site currently runs with.
+    struct adaptive_chunk_size_site_state
+    {
+        // the number of cores is zero before the first invocation
+        std::size_t cores = 0;
+        std::size_t chunks_per_core = 0;
+
+        // the chunk size for the iteration count of the latest invocation
+        std::size_t chunk_size = 0;
+
+        // the number of invocations between two tries of neighboring
+        // configurations, it grows once all neighbors are known
+        std::uint64_t step = 0;
+        std::uint64_t invocations = 0;
+    };
+
+    // The address of id identifies the call sites invoking an algorithm
+    // with the function object F.
+    template <typename F>
+    struct adaptive_chunk_size_key
+    {
+        static constexpr char id = 0;
+    };
+
+    HPX_LOCAL_EXPORT adaptive_chunk_size_site& get_adaptive_chunk_size_site(
+        void const* key);
+    HPX_LOCAL_EXPORT adaptive_chunk_size_site&
+    get_annotated_adaptive_chunk_size_site(char const* annotation);
+
+    // the number of cores the site currently runs best with
+    HPX_LOCAL_EXPORT std::size_t get_adaptive_chunk_size_cores(
+        adaptive_chunk_size_site& site, std::size_t available_cores);
+
+    HPX_LOCAL_EXPORT adaptive_chunk_size_site_state
+    get_adaptive_chunk_size_site_state(adaptive_chunk_size_site& site);
+
+    HPX_LOCAL_EXPORT adaptive_chunk_size_run start_adaptive_chunk_size_run(
+        adaptive_chunk_size_site& site, std::size_t available_cores,
+        std::size_t count);
+    HPX_LOCAL_EXPORT void finish_adaptive_chunk_size_run(
+        adaptive_chunk_size_run const& run, std::uint64_t elapsed);
+    /// \endcond
+}}}}    // namespace hpx::parallel::execution::detail
+
+namespace hpx { namespace execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of chunks and the number of cores to use are learned from
+    /// the wall time of earlier invocations of the same call site. Unlike
+    /// \a auto_chunk_size, no iterations are executed for measurements.
+    ///
+    /// A call site is identified by the annotation given to this object, by
+    /// the annotation of the executor, or otherwise by the type of the
+    /// function object the algorithm is invoked with. The history of each
+    /// call site is kept for the lifetime of the process and is shared by
+    /// all \a adaptive_chunk_size objects.
+    ///
+    /// Each call site starts out using all cores and four chunks per core.
+    /// Neighboring configurations (half or twice the cores, half or twice
+    /// the chunks per core) are tried once in a while and replace the
+    /// current one if they have shown to run faster per iteration. More
+    /// chunks per core are tried first if the cores were idle for a large
+    /// fraction of the execution time of the current configuration.
+    ///
+    /// \note Copies of an \a adaptive_chunk_size object share the state of
+    ///       the invocation they are used for. An object (or its copies)
+    ///       should not be used by algorithms running concurrently.
+    ///
+    struct adaptive_chunk_size
+    {
+    public:
+        /// The configuration a call site currently runs with
+        using site_state =
+            hpx::parallel::execution::detail::adaptive_chunk_size_site_state;
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a adaptive_chunk_size executor
+        ///       parameter types identify the call site by the annotation
+        ///       of the executor or by the type of the function object the
+        ///       algorithm is invoked with.
+        ///
+        adaptive_chunk_size()
+          : state_(std::make_shared<state_type>())
+        {
+        }
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param annotation   [in] The name of the call site. All
+        ///                     invocations with the same name share their
+        ///                     history.
+        ///
+        explicit adaptive_chunk_size(std::string annotation)
+          : annotation_(HPX_MOVE(annotation))
+          , state_(std::make_shared<state_type>())
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // Return the number of cores the call site runs best with, if the
+        // call site can be identified before the function object is known.
+        template <typename Executor>
+        std::size_t processing_units_count(Executor&& exec)
+        {
+            std::size_t const available_cores =
+                hpx::parallel::execution::detail::get_os_thread_count();
+            {
+                std::lock_guard<mutex_type> l(state_->mtx);
+                state_->available_cores = available_cores;
+            }
+
+            if (site_type* site = get_site(exec, nullptr))
+            {
+                return hpx::parallel::execution::detail::
+                    get_adaptive_chunk_size_cores(*site, available_cores);
+            }
+            return available_cores;
+        }
+
+        // Divide the iterations into the number of chunks the call site
+        // runs best with, or into the one of a configuration to try.
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor& exec, F&& /* f */, std::size_t cores, std::size_t count)
+        {
+            namespace detail = hpx::parallel::execution::detail;
+
+            site_type* site = get_site(
+                exec, &detail::adaptive_chunk_size_key<std::decay_t<F>>::id);
+
+            // the executor may have reported the number of cores itself
+            std::size_t available_cores = 0;
+            {
+                std::lock_guard<mutex_type> l(state_->mtx);
+                std::swap(available_cores, state_->available_cores);
+            }
+            if (available_cores == 0)
+            {
+                available_cores = cores;
+            }
+
+            detail::adaptive_chunk_size_run run =
+                detail::start_adaptive_chunk_size_run(
+                    *site, available_cores, count);
+            run.start = hpx::chrono::high_resolution_clock::now();
+            {
+                std::lock_guard<mutex_type> l(state_->mtx);
+                state_->run = run;
+            }
+
+            std::size_t const chunks = run.cores * run.chunks_per_core;
+            return (count + chunks - 1) / chunks;
+        }
+
+        // Report the wall time of the invocation to its call site.
+        template <typename Executor>
+        void mark_end_execution(Executor&& /* exec */)
+        {
+            hpx::parallel::execution::detail::adaptive_chunk_size_run run;
+            {
+                std::lock_guard<mutex_type> l(state_->mtx);
+                std::swap(run, state_->run);
+            }
+
+            if (run.site != nullptr)
+            {
+                hpx::parallel::execution::detail::
+                    finish_adaptive_chunk_size_run(run,
+                        hpx::chrono::high_resolution_clock::now() - run.start);
+            }
+        }
+        /// \endcond
+
+        /// Return the configuration of the call site this object (or one
+        /// of its copies) was used for last. All members are zero if the
+        /// object has not been used yet.
+        site_state get_site_state() const
+        {
+            site_type* site = nullptr;
+            {
+                std::lock_guard<mutex_type> l(state_->mtx);
+                site = state_->site;
+            }
+
+            if (site == nullptr && !annotation_.empty())
+            {
+                site = &hpx::parallel::execution::detail::
+                           get_annotated_adaptive_chunk_size_site(
+                               annotation_.c_str());
+            }
+
+            if (site == nullptr)
+            {
+                return site_state();
+            }
+            return hpx::parallel::execution::detail::
+                get_adaptive_chunk_size_site_state(*site);
+        }
+
+    private:
+        /// \cond NOINTERNAL
+        using site_type =
+            hpx::parallel::execution::detail::adaptive_chunk_size_site;
+        using state_type =
+            hpx::parallel::execution::detail::adaptive_chunk_size_state;
+        using mutex_type = hpx::util::detail::spinlock;
+
+        // Return the call site identified by the annotation of this object,
+        // by the one of the executor, or otherwise by the given key (if
+        // any). The site is looked up in the global registry only if the
+        // key differs from the one of the previous invocation.
+        template <typename Executor>
+        site_type* get_site(Executor const& exec, void const* key) const
+        {
+            namespace detail = hpx::parallel::execution::detail;
+
+            char const* annotation = nullptr;
+            if (!annotation_.empty())
+            {
+                // the shared state is unique to this object and its copies
+                annotation = annotation_.c_str();
+                key = state_.get();
+            }
+            else
+            {
+                if constexpr (hpx::functional::is_tag_invocable_v<
+                                  hpx::execution::experimental::
+                                      get_annotation_t,
+                                  Executor const&>)
+                {
+                    // annotations of executors are stored for the lifetime
+                    // of the process, equal addresses denote equal names
+                    annotation =
+                        hpx::execution::experimental::get_annotation(exec);
+                    if (annotation != nullptr)
+                    {
+                        key = annotation;
+                    }
+                }
+
+                if (key == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+
+            {
+                std::lock_guard<mutex_type> l(state_->mtx);
+                if (state_->key == key)
+                {
+                    return state_->site;
+                }
+            }
+
+            site_type* site = annotation != nullptr ?
+                &detail::get_annotated_adaptive_chunk_size_site(annotation) :
+                &detail::get_adaptive_chunk_size_site(key);
+
+            std::lock_guard<mutex_type> l(state_->mtx);
+            state_->key = key;
+            state_->site = site;
+            return site;
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & annotation_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::string annotation_;
+        std::shared_ptr<state_type> state_;
+        /// \endcond
+    };
+}}    // namespace hpx::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::adaptive_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -0,0 +1,154 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/sticky_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/execution/detail/execution_parameter_callbacks.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <hpx/execution/executors/execution_parameters_fwd.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx { namespace parallel { namespace execution { namespace detail {
+    /// \cond NOINTERNAL
+
+    // The number of iterations of each chunk if count iterations are
+    // divided into (at most) one chunk per core, every chunk except the
+    // last one being a multiple of granularity iterations.
+    constexpr std::size_t get_sticky_chunk_size(std::size_t count,
+        std::size_t cores, std::size_t granularity) noexcept
+    {
+        if (cores == 0)
+        {
+            cores = 1;
+        }
+        if (granularity == 0)
+        {
+            granularity = 1;
+        }
+
+        std::size_t const chunk_size = (count + cores - 1) / cores;
+        std::size_t const units = (chunk_size + granularity - 1) / granularity;
+        return units == 0 ? granularity : units * granularity;
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::execution::detail
+
+namespace hpx { namespace execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into one contiguous chunk per core. As
+    /// executors like \a hpx::execution::parallel_executor place the chunks
+    /// of a bulk operation on the worker threads based on their index only,
+    /// chunk \a i runs on the same worker thread on every invocation. All
+    /// algorithms invoked with the same executor over sequences of the
+    /// same length (for instance \a hpx::fill followed by \a hpx::copy and
+    /// \a hpx::transform over the same arrays) will process each element on
+    /// the same worker thread, and therefore on the same NUMA domain.
+    ///
+    /// Combined with memory first touched under the same placement (see
+    /// \a hpx::execution::experimental::numa_allocator), this keeps the
+    /// memory accesses of bandwidth bound loops local to the NUMA domain of
+    /// the accessing core.
+    ///
+    /// \note The chunks are only as sticky as the scheduler allows. Work
+    ///       stealing across NUMA domains should be disabled (by setting
+    ///       \a hpx.numa_sensitive=2) to keep chunks from being executed by
+    ///       a core on a different NUMA domain.
+    ///
+    struct sticky_chunk_size
+    {
+        /// Construct a \a sticky_chunk_size executor parameters object
+        ///
+        /// \note By default the chunk boundaries may fall on any loop
+        ///       iteration.
+        ///
+        constexpr sticky_chunk_size()
+          : granularity_(1)
+        {
+        }
+
+        /// Construct a \a sticky_chunk_size executor parameters object
+        ///
+        /// \param granularity  [in] The number of loop iterations the size
+        ///                     of all but the last chunk is a multiple of.
+        ///                     Choosing the number of elements fitting into
+        ///                     a memory page makes sure no page is shared
+        ///                     between two chunks.
+        ///
+        constexpr explicit sticky_chunk_size(std::size_t granularity)
+          : granularity_(granularity == 0 ? 1 : granularity)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // Always use all cores, otherwise the chunks would move between
+        // worker threads whenever the number of cores changed.
+        template <typename Executor>
+        std::size_t processing_units_count(Executor&&) const
+        {
+            return hpx::parallel::execution::detail::get_os_thread_count();
+        }
+
+        template <typename Executor>
+        constexpr std::size_t maximal_number_of_chunks(
+            Executor&&, std::size_t cores, std::size_t) const noexcept
+        {
+            return cores;
+        }
+
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor& exec, F&&, std::size_t cores, std::size_t num_tasks)
+        {
+            // Make sure the internal round robin counter of the executor is
+            // reset, the first chunk has to land on the first core
+            parallel::execution::reset_thread_distribution(*this, exec);
+
+            return hpx::parallel::execution::detail::get_sticky_chunk_size(
+                num_tasks, cores, granularity_);
+        }
+
+        constexpr std::size_t granularity() const noexcept
+        {
+            return granularity_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & granularity_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t granularity_;
+        /// \endcond
+    };
+}}    // namespace hpx::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::sticky_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -0,0 +1,307 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/config.hpp>
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace execution { namespace detail {
+
+    namespace {
+        // the weight of a new measurement in the average time per iteration
+        constexpr double measurement_weight = 0.25;
+
+        // the fraction of the time per iteration of the current configuration
+        // another one has to undercut to replace it
+        constexpr double improvement_threshold = 0.95;
+
+        // the core time per iteration relative to the lowest one observed
+        // above which trying more chunks per core is preferred
+        constexpr double imbalance_threshold = 1.25;
+
+        // the number of invocations between two tries of other
+        // configurations once all neighbors of the current one are known
+        constexpr std::uint64_t exploration_interval = 16;
+
+        constexpr std::size_t initial_chunks_per_core = 4;
+        constexpr std::size_t max_chunks_per_core = 16;
+    }    // namespace
+
+    // The measurements of one configuration of a call site.
+    struct adaptive_chunk_size_measurement
+    {
+        double time = 0.0;    // nanoseconds per iteration
+        std::uint64_t invocation = 0;
+    };
+
+    struct adaptive_chunk_size_site
+    {
+        using configuration = std::pair<std::size_t, std::size_t>;
+
+        hpx::util::detail::spinlock mtx;
+
+        // the configuration which has run fastest so far, the number of
+        // cores is zero before the first invocation
+        configuration current{0, initial_chunks_per_core};
+        std::map<configuration, adaptive_chunk_size_measurement> measurements;
+
+        // the lowest core time per iteration observed and the one of the
+        // current configuration relative to it
+        double cost = 0.0;
+        double imbalance = 1.0;
+
+        std::uint64_t invocations = 0;
+        std::uint64_t last_exploration = 0;
+
+        // the number of available cores and the iteration count of the
+        // latest invocation
+        std::size_t available_cores = 0;
+        std::size_t count = 0;
+    };
+
+    namespace {
+        struct adaptive_chunk_size_registry
+        {
+            hpx::util::detail::spinlock mtx;
+            std::map<void const*, adaptive_chunk_size_site> sites;
+            std::map<std::string, adaptive_chunk_size_site, std::less<>>
+                annotated_sites;
+        };
+
+        adaptive_chunk_size_registry& get_adaptive_chunk_size_registry()
+        {
+            static adaptive_chunk_size_registry registry;
+            return registry;
+        }
+
+        using configuration = adaptive_chunk_size_site::configuration;
+
+        // Select the configuration to try next among the neighbors of the
+        // current one. Neighbors which have not run yet come first, then the
+        // one which has not run for the longest time.
+        bool select_neighbor(adaptive_chunk_size_site const& site,
+            std::size_t available_cores, configuration& result)
+        {
+            std::size_t const cores = site.current.first;
+            std::size_t const chunks_per_core = site.current.second;
+
+            configuration const more_chunks(cores,
+                (std::min)(2 * chunks_per_core, max_chunks_per_core));
+            configuration const fewer_chunks(
+                cores, (std::max)(chunks_per_core / 2, std::size_t(1)));
+            configuration const more_cores(
+                (std::min)(2 * cores, available_cores), chunks_per_core);
+            configuration const fewer_cores(
+                (std::max)(cores / 2, std::size_t(1)), chunks_per_core);
+
+            // idle cores are best fixed by finer grained chunks, otherwise
+            // try to reduce the overheads first
+            configuration candidates[4] = {
+                fewer_chunks, fewer_cores, more_cores, more_chunks};
+            if (site.imbalance > imbalance_threshold)
+            {
+                std::swap(candidates[0], candidates[3]);
+                std::swap(candidates[1], candidates[2]);
+            }
+
+            bool found = false;
+            std::uint64_t oldest = 0;
+            for (configuration const& candidate : candidates)
+            {
+                if (candidate == site.current)
+                {
+                    continue;
+                }
+
+                auto it = site.measurements.find(candidate);
+                if (it == site.measurements.end())
+                {
+                    result = candidate;
+                    return true;
+                }
+
+                if (!found || it->second.invocation < oldest)
+                {
+                    found = true;
+                    oldest = it->second.invocation;
+                    result = candidate;
+                }
+            }
+            return found;
+        }
+
+        bool has_unknown_neighbors(adaptive_chunk_size_site const& site,
+            std::size_t available_cores)
+        {
+            configuration next;
+            return select_neighbor(site, available_cores, next) &&
+                site.measurements.find(next) == site.measurements.end();
+        }
+
+        // try another configuration every other invocation as long as not
+        // all neighbors of the current one have run, less often afterwards
+        std::uint64_t exploration_step(adaptive_chunk_size_site const& site,
+            std::size_t available_cores)
+        {
+            return has_unknown_neighbors(site, available_cores) ?
+                2 :
+                exploration_interval;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_chunk_size_site& get_adaptive_chunk_size_site(void const* key)
+    {
+        auto& registry = get_adaptive_chunk_size_registry();
+
+        std::lock_guard<hpx::util::detail::spinlock> l(registry.mtx);
+        return registry.sites[key];
+    }
+
+    adaptive_chunk_size_site& get_annotated_adaptive_chunk_size_site(
+        char const* annotation)
+    {
+        auto& registry = get_adaptive_chunk_size_registry();
+
+        std::lock_guard<hpx::util::detail::spinlock> l(registry.mtx);
+        auto it = registry.annotated_sites.find(annotation);
+        if (it == registry.annotated_sites.end())
+        {
+            it = registry.annotated_sites
+                     .emplace(std::piecewise_construct,
+                         std::forward_as_tuple(annotation),
+                         std::forward_as_tuple())
+                     .first;
+        }
+        return it->second;
+    }
+
+    std::size_t get_adaptive_chunk_size_cores(
+        adaptive_chunk_size_site& site, std::size_t available_cores)
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(site.mtx);
+        if (site.current.first == 0)
+        {
+            return available_cores;
+        }
+        return (std::min)(site.current.first, available_cores);
+    }
+
+    adaptive_chunk_size_site_state get_adaptive_chunk_size_site_state(
+        adaptive_chunk_size_site& site)
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(site.mtx);
+
+        adaptive_chunk_size_site_state state;
+        if (site.current.first == 0)
+        {
+            return state;
+        }
+
+        std::size_t const chunks = site.current.first * site.current.second;
+
+        state.cores = site.current.first;
+        state.chunks_per_core = site.current.second;
+        state.chunk_size = (site.count + chunks - 1) / chunks;
+        state.step = exploration_step(site, site.available_cores);
+        state.invocations = site.invocations;
+        return state;
+    }
+
+    adaptive_chunk_size_run start_adaptive_chunk_size_run(
+        adaptive_chunk_size_site& site, std::size_t available_cores,
+        std::size_t count)
+    {
+        available_cores = (std::max)(available_cores, std::size_t(1));
+
+        std::lock_guard<hpx::util::detail::spinlock> l(site.mtx);
+
+        // the number of available cores might have changed since the last
+        // invocation
+        if (site.current.first == 0 || site.current.first > available_cores)
+        {
+            site.current.first = available_cores;
+        }
+
+        std::uint64_t const invocation = ++site.invocations;
+        site.available_cores = available_cores;
+        site.count = count;
+
+        configuration config = site.current;
+        if (invocation - site.last_exploration >=
+                exploration_step(site, available_cores) &&
+            select_neighbor(site, available_cores, config))
+        {
+            site.last_exploration = invocation;
+        }
+
+        adaptive_chunk_size_run run;
+        run.site = &site;
+        run.cores = config.first;
+        run.chunks_per_core = config.second;
+        run.count = count;
+        return run;
+    }
+
+    void finish_adaptive_chunk_size_run(
+        adaptive_chunk_size_run const& run, std::uint64_t elapsed)
+    {
+        if (run.site == nullptr || run.count == 0)
+        {
+            return;
+        }
+
+        adaptive_chunk_size_site& site = *run.site;
+        configuration const config(run.cores, run.chunks_per_core);
+
+        double const time = double(elapsed) / double(run.count);
+        double const core_time = time * double(run.cores);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(site.mtx);
+
+        adaptive_chunk_size_measurement& measurement =
+            site.measurements[config];
+        if (measurement.invocation == 0)
+        {
+            measurement.time = time;
+        }
+        else
+        {
+            measurement.time += measurement_weight * (time - measurement.time);
+        }
+        measurement.invocation = site.invocations;
+
+        if (site.cost == 0.0 || core_time < site.cost)
+        {
+            site.cost = core_time;
+        }
+
+        auto current = site.measurements.find(site.current);
+        if (config != site.current &&
+            (current == site.measurements.end() ||
+                measurement.time <
+                    improvement_threshold * current->second.time))
+        {
+            site.current = config;
+        }
+
+        if (config == site.current && site.cost != 0.0)
+        {
+            site.imbalance = core_time / site.cost;
+        }
+    }
+}}}}    // namespace hpx::parallel::execution::detail
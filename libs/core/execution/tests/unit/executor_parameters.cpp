@@ -11,6 +11,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -89,6 +91,19 @@ void test_static_chunk_size()
     }
 }
 
+void test_sticky_chunk_size()
+{
+    {
+        hpx::execution::sticky_chunk_size scs;
+        parameters_test(scs);
+    }
+
+    {
+        hpx::execution::sticky_chunk_size scs(64);
+        parameters_test(scs);
+    }
+}
+
 void test_guided_chunk_size()
 {
     {
@@ -135,6 +150,98 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+void test_adaptive_chunk_size()
+{
+    {
+        hpx::execution::adaptive_chunk_size acs;
+        HPX_TEST_EQ(acs.get_site_state().invocations, std::uint64_t(0));
+
+        parameters_test(acs);
+
+        // the parallel invocations run on the site of the last one
+        HPX_TEST_LT(std::uint64_t(0), acs.get_site_state().invocations);
+    }
+
+    {
+        hpx::execution::adaptive_chunk_size acs("test_adaptive_chunk_size");
+        parameters_test(acs);
+
+        // all parallel invocations share the annotated site
+        auto const state = acs.get_site_state();
+        HPX_TEST_LT(std::uint64_t(0), state.invocations);
+        HPX_TEST_LT(std::size_t(0), state.cores);
+        HPX_TEST_LT(std::size_t(0), state.chunks_per_core);
+        HPX_TEST_LT(std::size_t(0), state.chunk_size);
+    }
+}
+
+// The time per iteration falls with the number of cores and grows with the
+// number of chunks per core, the cheapest configuration uses all cores and a
+// single chunk per core.
+void test_adaptive_chunk_size_hill_climbing()
+{
+    namespace detail = hpx::parallel::execution::detail;
+
+    std::size_t const available_cores = 8;
+    std::size_t const count = 1000;
+
+    auto time_per_iteration = [](std::size_t cores,
+                                  std::size_t chunks_per_core) {
+        return 1000 / cores + 10 * chunks_per_core;
+    };
+
+    hpx::execution::adaptive_chunk_size acs(
+        "test_adaptive_chunk_size_hill_climbing");
+    detail::adaptive_chunk_size_site& site =
+        detail::get_annotated_adaptive_chunk_size_site(
+            "test_adaptive_chunk_size_hill_climbing");
+
+    auto invoke = [&]() {
+        detail::adaptive_chunk_size_run run =
+            detail::start_adaptive_chunk_size_run(
+                site, available_cores, count);
+        detail::finish_adaptive_chunk_size_run(run,
+            count * time_per_iteration(run.cores, run.chunks_per_core));
+    };
+
+    // the configuration only moves to cheaper ones
+    invoke();
+    auto state = acs.get_site_state();
+    HPX_TEST_EQ(state.cores, available_cores);
+    HPX_TEST_EQ(state.chunks_per_core, std::size_t(4));
+    HPX_TEST_EQ(state.step, std::uint64_t(2));
+
+    for (int i = 0; i != 20; ++i)
+    {
+        auto const previous = state;
+
+        invoke();
+        state = acs.get_site_state();
+
+        HPX_TEST_LTE(time_per_iteration(state.cores, state.chunks_per_core),
+            time_per_iteration(previous.cores, previous.chunks_per_core));
+        HPX_TEST_LTE(previous.chunk_size, state.chunk_size);
+    }
+
+    HPX_TEST_EQ(state.cores, available_cores);
+    HPX_TEST_EQ(state.chunks_per_core, std::size_t(1));
+    HPX_TEST_EQ(state.chunk_size, count / available_cores);
+
+    // once all neighbors are known to be slower the configuration settles
+    // and other ones are tried less often
+    HPX_TEST_LT(std::uint64_t(2), state.step);
+    for (int i = 0; i != 100; ++i)
+    {
+        invoke();
+
+        auto const current = acs.get_site_state();
+        HPX_TEST_EQ(current.cores, state.cores);
+        HPX_TEST_EQ(current.chunks_per_core, state.chunks_per_core);
+        HPX_TEST_EQ(current.step, state.step);
+    }
+    HPX_TEST_EQ(acs.get_site_state().invocations, std::uint64_t(121));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct timer_hooks_parameters
 {
@@ -189,9 +296,12 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_dynamic_chunk_size();
     test_static_chunk_size();
+    test_sticky_chunk_size();
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_adaptive_chunk_size();
+    test_adaptive_chunk_size_hill_climbing();
 
     test_combined_hooks();
 
@@ -10,6 +10,8 @@
 #include <hpx/modules/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -86,6 +88,81 @@ void test_persistent_executitor_parameters_ref()
     }
 }
 
+// repeated invocations of the same call site explore the configurations
+// around the current one and keep the fastest one
+void check_adaptive_site_state(
+    hpx::execution::adaptive_chunk_size const& p, std::uint64_t invocations)
+{
+    auto const state = p.get_site_state();
+
+    HPX_TEST_EQ(state.invocations, invocations);
+    HPX_TEST_LT(std::size_t(0), state.cores);
+    HPX_TEST_LTE(state.cores, hpx::get_os_thread_count());
+    HPX_TEST_LT(std::size_t(0), state.chunks_per_core);
+    HPX_TEST_LTE(state.chunks_per_core, std::size_t(16));
+    HPX_TEST_EQ(state.chunk_size,
+        (std::size_t(10007) + state.cores * state.chunks_per_core - 1) /
+            (state.cores * state.chunks_per_core));
+    HPX_TEST_LTE(std::uint64_t(2), state.step);
+}
+
+void test_adaptive_executor_parameters()
+{
+    typedef std::random_access_iterator_tag iterator_tag;
+
+    {
+        hpx::execution::adaptive_chunk_size p;
+        auto policy = hpx::execution::par.with(p);
+        for (int i = 0; i != 50; ++i)
+        {
+            test_for_each(policy, iterator_tag());
+        }
+        check_adaptive_site_state(p, 50);
+    }
+
+    {
+        hpx::execution::adaptive_chunk_size p("test_adaptive");
+        for (int i = 0; i != 50; ++i)
+        {
+            test_for_each_async(
+                hpx::execution::par(hpx::execution::task).with(std::ref(p)),
+                iterator_tag());
+        }
+        check_adaptive_site_state(p, 50);
+    }
+
+    hpx::execution::parallel_executor par_exec;
+
+    {
+        // the copy of the parameters object used by the policy shares its
+        // site with the original, the site is the one of the first loop as
+        // the function object is the same
+        hpx::execution::adaptive_chunk_size p;
+        auto policy = hpx::execution::par.on(par_exec).with(p);
+        for (int i = 0; i != 50; ++i)
+        {
+            test_for_each(policy, iterator_tag());
+        }
+        check_adaptive_site_state(p, 100);
+    }
+
+    {
+        // the annotation of the executor identifies the call site
+        hpx::execution::adaptive_chunk_size p;
+        auto exec = hpx::execution::experimental::with_annotation(
+            par_exec, "test_adaptive_executor");
+        for (int i = 0; i != 50; ++i)
+        {
+            test_for_each(
+                hpx::execution::par.on(exec).with(std::ref(p)), iterator_tag());
+        }
+        check_adaptive_site_state(p, 50);
+
+        hpx::execution::adaptive_chunk_size annotated("test_adaptive_executor");
+        check_adaptive_site_state(annotated, 50);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -98,6 +175,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_persistent_executitor_parameters();
     test_persistent_executitor_parameters_ref();
+    test_adaptive_executor_parameters();
 
     return hpx::local::finalize();
 }
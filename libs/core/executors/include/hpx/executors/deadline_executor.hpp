@@ -0,0 +1,219 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/deadline_executor.hpp
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+
+    namespace detail {
+        // Temporarily give the calling HPX thread the requested deadline,
+        // threads created in the meantime inherit it.
+        class scoped_thread_deadline
+        {
+        public:
+            using deadline_type = threads::thread_init_data::deadline_type;
+
+            explicit scoped_thread_deadline(deadline_type deadline)
+              : id_(threads::get_self_id())
+              , previous_(deadline_type::max())
+            {
+                if (id_)
+                {
+                    previous_ =
+                        threads::set_thread_deadline(id_, deadline, throws);
+                }
+            }
+
+            ~scoped_thread_deadline()
+            {
+                if (id_)
+                {
+                    threads::set_thread_deadline(id_, previous_, throws);
+                }
+            }
+
+            scoped_thread_deadline(scoped_thread_deadline const&) = delete;
+            scoped_thread_deadline& operator=(
+                scoped_thread_deadline const&) = delete;
+
+        private:
+            threads::thread_id_type id_;
+            deadline_type previous_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a deadline_executor wraps any other executor and gives all threads
+    /// it creates the given deadline. Deadline based schedulers (see
+    /// hpx::resource::scheduling_policy::deadline) run the threads with the
+    /// earliest deadline first, other schedulers ignore the deadline.
+    ///
+    /// The deadline is passed on to the new threads the same way as a
+    /// thread passes on its own deadline to the threads it creates. This
+    /// requires the work to be launched from an HPX thread. Work launched
+    /// from other threads runs without a deadline.
+    template <typename BaseExecutor>
+    struct deadline_executor
+    {
+        using deadline_type = threads::thread_init_data::deadline_type;
+
+        template <typename Executor,
+            typename Enable = std::enable_if_t<
+                hpx::traits::is_executor_any_v<Executor> &&
+                !std::is_same_v<std::decay_t<Executor>, deadline_executor>>>
+        constexpr deadline_executor(Executor&& exec, deadline_type deadline)
+          : exec_(HPX_FORWARD(Executor, exec))
+          , deadline_(deadline)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr bool operator==(deadline_executor const& rhs) const noexcept
+        {
+            return exec_ == rhs.exec_ && deadline_ == rhs.deadline_;
+        }
+
+        constexpr bool operator!=(deadline_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        constexpr auto const& context() const noexcept
+        {
+            return exec_.context();
+        }
+
+        constexpr deadline_type deadline() const noexcept
+        {
+            return deadline_;
+        }
+        /// \endcond
+
+        /// \cond NOINTERNAL
+        using execution_category =
+            hpx::traits::executor_execution_category_t<BaseExecutor>;
+
+        using parameters_type =
+            hpx::traits::executor_parameters_type_t<BaseExecutor>;
+
+        template <typename T, typename... Ts>
+        using future_type =
+            hpx::traits::executor_future_t<BaseExecutor, T, Ts...>;
+
+        // NonBlockingOneWayExecutor interface
+        template <typename F, typename... Ts>
+        decltype(auto) post(F&& f, Ts&&... ts)
+        {
+            detail::scoped_thread_deadline d(deadline_);
+            return parallel::execution::post(
+                exec_, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // OneWayExecutor interface
+        template <typename F, typename... Ts>
+        decltype(auto) sync_execute(F&& f, Ts&&... ts)
+        {
+            detail::scoped_thread_deadline d(deadline_);
+            return parallel::execution::sync_execute(
+                exec_, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // TwoWayExecutor interface
+        //
+        // There is no then_execute, continuations are launched through
+        // async_execute once their predecessor has become ready.
+        template <typename F, typename... Ts>
+        decltype(auto) async_execute(F&& f, Ts&&... ts)
+        {
+            detail::scoped_thread_deadline d(deadline_);
+            return parallel::execution::async_execute(
+                exec_, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // BulkTwoWayExecutor interface
+        template <typename F, typename S, typename... Ts>
+        decltype(auto) bulk_async_execute(F&& f, S const& shape, Ts&&... ts)
+        {
+            detail::scoped_thread_deadline d(deadline_);
+            return parallel::execution::bulk_async_execute(
+                exec_, HPX_FORWARD(F, f), shape, HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename F, typename S, typename... Ts>
+        decltype(auto) bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
+        {
+            detail::scoped_thread_deadline d(deadline_);
+            return parallel::execution::bulk_sync_execute(
+                exec_, HPX_FORWARD(F, f), shape, HPX_FORWARD(Ts, ts)...);
+        }
+
+    private:
+        BaseExecutor exec_;
+        deadline_type deadline_;
+        /// \endcond
+    };
+
+    template <typename Executor>
+    deadline_executor(Executor&&, threads::thread_init_data::deadline_type)
+        -> deadline_executor<std::decay_t<Executor>>;
+}}}    // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+
+    // The deadline executor exposes the same executor categories as its
+    // underlying (wrapped) executor.
+
+    /// \cond NOINTERNAL
+    template <typename BaseExecutor>
+    struct is_one_way_executor<
+        hpx::execution::experimental::deadline_executor<BaseExecutor>>
+      : is_one_way_executor<BaseExecutor>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_never_blocking_one_way_executor<
+        hpx::execution::experimental::deadline_executor<BaseExecutor>>
+      : is_never_blocking_one_way_executor<BaseExecutor>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_bulk_one_way_executor<
+        hpx::execution::experimental::deadline_executor<BaseExecutor>>
+      : is_bulk_one_way_executor<BaseExecutor>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_two_way_executor<
+        hpx::execution::experimental::deadline_executor<BaseExecutor>>
+      : is_two_way_executor<BaseExecutor>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_bulk_two_way_executor<
+        hpx::execution::experimental::deadline_executor<BaseExecutor>>
+      : is_bulk_two_way_executor<BaseExecutor>
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -17,14 +17,18 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/functional/deferred_call.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/futures_factory.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
 #include <algorithm>
@@ -36,6 +40,46 @@
 
 namespace hpx { namespace parallel { namespace execution { namespace detail {
 
+    // Launch the work items [part_begin, part_end) of a bulk operation.
+    // Work items which end up as new HPX threads are handed to the scheduler
+    // all at once.
+    template <typename Launch, typename Result, typename F, typename Iter,
+        typename... Ts>
+    void bulk_async_execute_part(hpx::util::thread_description const& desc,
+        threads::thread_pool_base* pool, Launch const& policy,
+        std::vector<hpx::future<Result>>& results, std::size_t part_begin,
+        std::size_t part_end, F& f, Iter it, Ts&... ts)
+    {
+        hpx::launch const l(policy);
+        if ((!hpx::detail::has_async_policy(l) &&
+                !hpx::detail::has_inline_if_cheap_policy(l)) ||
+            l == hpx::launch::sync || l == hpx::launch::fork)
+        {
+            for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+            {
+                results[part_i] =
+                    hpx::detail::async_launch_policy_dispatch<Launch>::call(
+                        policy, desc, pool, f, *it, ts...);
+                ++it;
+            }
+            return;
+        }
+
+        std::vector<threads::thread_init_data> data;
+        data.reserve(part_end - part_begin);
+        for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+        {
+            hpx::lcos::local::futures_factory<Result()> p(
+                hpx::util::deferred_call(f, *it, ts...));
+            data.push_back(
+                p.make_thread_init_data(desc.get_description(), l));
+            results[part_i] = p.get_future();
+            ++it;
+        }
+
+        threads::register_work_bulk(data.data(), data.size(), pool);
+    }
+
     template <typename Launch, typename F, typename S, typename... Ts>
     std::vector<
         hpx::future<typename detail::bulk_function_result<F, S, Ts...>::type>>
@@ -75,15 +119,8 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                 detail::post_policy_dispatch<Launch>::call(post_policy, desc,
                     pool,
                     [&, part_begin, part_end, part_size, f, it]() mutable {
-                        for (std::size_t part_i = part_begin; part_i < part_end;
-                             ++part_i)
-                        {
-                            results[part_i] =
-                                hpx::detail::async_launch_policy_dispatch<
-                                    Launch>::call(async_policy, desc, pool, f,
-                                    *it, ts...);
-                            ++it;
-                        }
+                        bulk_async_execute_part(desc, pool, async_policy,
+                            results, part_begin, part_end, f, it, ts...);
                         l.count_down(part_size);
                     });
 
@@ -91,14 +128,9 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             }
             else
             {
-                for (std::size_t part_i = part_begin; part_i < part_end;
-                     ++part_i)
-                {
-                    results[part_i] =
-                        hpx::detail::async_launch_policy_dispatch<Launch>::call(
-                            async_policy, desc, pool, f, *it, ts...);
-                    ++it;
-                }
+                bulk_async_execute_part(desc, pool, async_policy, results,
+                    part_begin, part_end, f, it, ts...);
+                std::advance(it, part_size);
                 l.count_down(part_size);
             }
 
@@ -0,0 +1,230 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/executors/numa_allocator.hpp
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/executors/sticky_chunk_size.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An allocator placing the memory it hands out on the NUMA domains of
+    /// the cores which will later process it. The pages of each allocation
+    /// are first touched in parallel by the worker threads of the given
+    /// executor, each worker thread touching the pages of the chunk it is
+    /// assigned by \a hpx::execution::sticky_chunk_size. The operating
+    /// system places each page on the NUMA domain of the core touching it
+    /// first.
+    ///
+    /// Algorithms invoked on the allocated elements with the same executor
+    /// and the executor parameters returned by \a parameters() access the
+    /// memory local to the NUMA domain of the executing core:
+    ///
+    /// \code
+    ///     numa_allocator<double> alloc;
+    ///     std::vector<double, numa_allocator<double>> v(size, alloc);
+    ///
+    ///     auto policy = hpx::execution::par.on(alloc.executor())
+    ///                       .with(alloc.parameters());
+    ///     hpx::fill(policy, v.begin(), v.end(), 1.0);
+    /// \endcode
+    ///
+    /// \note The constructors of the elements are not invoked by the
+    ///       allocator, containers may still construct the elements
+    ///       sequentially without affecting the placement of the memory.
+    ///
+    template <typename T, typename Executor = hpx::execution::parallel_executor>
+    class numa_allocator
+    {
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using reference = T&;
+        using const_reference = T const&;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = numa_allocator<U, Executor>;
+        };
+
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        numa_allocator() = default;
+
+        explicit numa_allocator(Executor const& exec)
+          : exec_(exec)
+        {
+        }
+
+        template <typename U>
+        numa_allocator(numa_allocator<U, Executor> const& rhs)
+          : exec_(rhs.executor())
+        {
+        }
+
+        /// Return the executor which touches the allocated memory first.
+        Executor const& executor() const noexcept
+        {
+            return exec_;
+        }
+
+        /// Return the executor parameters dividing the elements of an
+        /// allocation into the chunks their memory was placed for.
+        hpx::execution::sticky_chunk_size parameters() const noexcept
+        {
+            return hpx::execution::sticky_chunk_size(granularity());
+        }
+
+        HPX_NODISCARD pointer allocate(size_type n)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+            if (n == 0)
+            {
+                return nullptr;
+            }
+
+            void* p = hpx::threads::create_topology().allocate(n * sizeof(T));
+            if (p == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            try
+            {
+                first_touch(static_cast<char*>(p), n);
+            }
+            catch (...)
+            {
+                hpx::threads::create_topology().deallocate(p, n * sizeof(T));
+                throw;
+            }
+
+            return static_cast<pointer>(p);
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if (p != nullptr)
+            {
+                hpx::threads::create_topology().deallocate(p, n * sizeof(T));
+            }
+        }
+
+        size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+
+        template <typename U>
+        friend bool operator==(numa_allocator const& lhs,
+            numa_allocator<U, Executor> const& rhs) noexcept
+        {
+            return lhs.exec_ == rhs.executor();
+        }
+
+        template <typename U>
+        friend bool operator!=(numa_allocator const& lhs,
+            numa_allocator<U, Executor> const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        // the number of elements fitting into a memory page, chunks made of
+        // whole pages don't share any page
+        static std::size_t granularity() noexcept
+        {
+            return (std::max)(
+                hpx::threads::get_memory_page_size() / sizeof(T),
+                std::size_t(1));
+        }
+
+        // Touch every page of the allocation from the worker thread which
+        // processes the chunk the beginning of the page belongs to.
+        void first_touch(char* base, std::size_t n) const
+        {
+            hpx::execution::sticky_chunk_size params = parameters();
+
+            std::size_t const cores =
+                hpx::parallel::execution::processing_units_count(
+                    params, exec_);
+            std::size_t const chunk_size = hpx::parallel::execution::detail::
+                get_sticky_chunk_size(n, cores, params.granularity());
+            std::size_t const chunks = (n + chunk_size - 1) / chunk_size;
+
+            std::size_t const page_size = hpx::threads::get_memory_page_size();
+            std::uintptr_t const base_address =
+                reinterpret_cast<std::uintptr_t>(base);
+
+            auto touch = [=](std::size_t chunk) {
+                std::uintptr_t const begin =
+                    base_address + chunk * chunk_size * sizeof(T);
+                std::uintptr_t const end = base_address +
+                    (std::min)((chunk + 1) * chunk_size, n) * sizeof(T);
+
+                // the first page starting at or after begin, the first
+                // chunk touches a leading partial page as well
+                std::uintptr_t page =
+                    ((begin + page_size - 1) / page_size) * page_size;
+                if (chunk == 0 && page != begin)
+                {
+                    *reinterpret_cast<char volatile*>(begin) = 0;
+                }
+
+                for (/**/; page < end; page += page_size)
+                {
+                    *reinterpret_cast<char volatile*>(page) = 0;
+                }
+            };
+
+            // some executors support bulk execution through non-const
+            // references only
+            Executor exec(exec_);
+            auto futures = hpx::parallel::execution::bulk_async_execute(
+                exec, touch, hpx::util::detail::make_counting_shape(chunks));
+
+            // all pages have to be touched before an exception is rethrown,
+            // the memory is released afterwards
+            for (auto& f : futures)
+            {
+                f.wait();
+            }
+            for (auto& f : futures)
+            {
+                f.get();
+            }
+        }
+
+    private:
+        Executor exec_;
+    };
+}}}    // namespace hpx::execution::experimental
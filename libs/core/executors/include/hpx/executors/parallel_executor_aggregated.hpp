@@ -351,7 +351,8 @@ namespace hpx { namespace parallel { namespace execution {
 
                 std::size_t size = hpx::util::size(shape);
                 lcos::local::latch l(size);
-                if (hpx::detail::has_async_policy(policy_))
+                if (hpx::detail::has_async_policy(policy_) ||
+                    hpx::detail::has_inline_if_cheap_policy(policy_))
                 {
                     spawn_hierarchical(l, size, num_tasks, f,
                         hpx::util::begin(shape), e, mtx_e, ts...);
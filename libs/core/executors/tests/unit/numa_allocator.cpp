@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <hpx/executors/numa_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::execution::experimental::numa_allocator;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Executor>
+void test_allocate(numa_allocator<T, Executor> alloc, std::size_t size)
+{
+    T* p = alloc.allocate(size);
+    if (size == 0)
+    {
+        HPX_TEST(p == nullptr);
+        return;
+    }
+
+    HPX_TEST(p != nullptr);
+    HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(T),
+        std::uintptr_t(0));
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        p[i] = T(i);
+    }
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(p[i], T(i));
+    }
+
+    alloc.deallocate(p, size);
+}
+
+template <typename Executor>
+void test_numa_allocator(Executor const& exec)
+{
+    numa_allocator<double, Executor> alloc(exec);
+
+    // whole pages of elements form a chunk
+    HPX_TEST_EQ(alloc.parameters().granularity(),
+        hpx::threads::get_memory_page_size() / sizeof(double));
+
+    for (std::size_t size : {0, 1, 17, 1000, 100000, 1000000})
+    {
+        test_allocate(alloc, size);
+    }
+
+    // rebound allocators compare equal
+    numa_allocator<char, Executor> rebound(alloc);
+    HPX_TEST(rebound == alloc);
+    HPX_TEST_EQ(rebound.parameters().granularity(),
+        hpx::threads::get_memory_page_size());
+    test_allocate(rebound, 12345);
+
+    std::vector<double, numa_allocator<double, Executor>> v(123456, 1.0, alloc);
+    for (double d : v)
+    {
+        HPX_TEST_EQ(d, 1.0);
+    }
+}
+
+// all algorithm invocations over the same range divide it into the same
+// chunks
+void test_sticky_chunks()
+{
+    numa_allocator<int> alloc;
+    std::vector<int, numa_allocator<int>> v(1000000, 0, alloc);
+
+    auto exec = alloc.executor();
+    auto params = alloc.parameters();
+
+    std::size_t const cores =
+        hpx::parallel::execution::processing_units_count(params, exec);
+    std::size_t const chunk_size =
+        hpx::parallel::execution::get_chunk_size(params, exec,
+            [](std::size_t) { return 0; }, cores, v.size());
+
+    HPX_TEST_EQ(cores, hpx::get_os_thread_count());
+    HPX_TEST(chunk_size * cores >= v.size());
+    HPX_TEST_EQ(chunk_size % params.granularity(), std::size_t(0));
+    HPX_TEST_EQ(chunk_size,
+        hpx::parallel::execution::get_chunk_size(params, exec,
+            [](std::size_t) { return 0; }, cores, v.size()));
+}
+
+int hpx_main()
+{
+    test_numa_allocator(hpx::execution::parallel_executor());
+    test_numa_allocator(hpx::execution::experimental::fork_join_executor());
+
+    test_sticky_chunks();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -13,6 +13,7 @@
 #include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
@@ -24,6 +25,7 @@
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <atomic>
@@ -32,6 +34,7 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -110,6 +113,36 @@ namespace hpx { namespace lcos { namespace detail {
             delete this;
         }
 
+        // Shared states which are not created using an allocator are
+        // allocated from a pool (see shared_state_pool.hpp).
+        HPX_NODISCARD static void* operator new(std::size_t size)
+        {
+            return allocate_shared_state(size);
+        }
+        static void operator delete(void* p, std::size_t size) noexcept
+        {
+            deallocate_shared_state(p, size);
+        }
+
+        // over-aligned shared states bypass the pool
+        HPX_NODISCARD static void* operator new(
+            std::size_t size, std::align_val_t align)
+        {
+            return ::operator new(size, align);
+        }
+        static void operator delete(
+            void* p, std::size_t, std::align_val_t align) noexcept
+        {
+            ::operator delete(p, align);
+        }
+
+        // placement new is still available
+        HPX_NODISCARD static void* operator new(std::size_t, void* p) noexcept
+        {
+            return p;
+        }
+        static void operator delete(void*, void*) noexcept {}
+
         // This is a tag type used to convey the information that the caller is
         // _not_ going to addref the future_data instance
         struct init_no_addref
@@ -243,12 +276,21 @@ namespace hpx { namespace lcos { namespace detail {
 
         virtual ~future_data_base();
 
+        // The state is modified using atomic operations only, the mutex is
+        // acquired only if threads are waiting for the future to become ready
+        // or if more than one continuation was registered.
         enum state
         {
             empty = 0,
             ready = 1,
             value = 2 | ready,
-            exception = 4 | ready
+            exception = 4 | ready,
+
+            // The flags below are set only as long as the future is not ready.
+            has_callback = 8,    // a single continuation is stored
+            has_waiters = 16,    // waiting threads or several continuations
+                                 // exist, those are protected by the mutex
+            busy = 32            // a continuation is about to be stored
         };
 
         /// Return whether or not the data is available for this
@@ -334,6 +376,15 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
+        // Make the future ready by changing the state to the given one, then
+        // wake up all waiting threads and run the registered continuations.
+        void make_ready(state new_state, char const* func);
+
+        // Flag that the mutex has to be acquired when making the future ready.
+        // Returns false if the future is ready already. The mutex has to be
+        // held by the caller.
+        bool set_has_waiters();
+
         mutable mutex_type mtx_;
         std::atomic<state> state_;    // current state
         completed_callback_vector_type on_completed_;
@@ -456,50 +507,9 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, HPX_FORWARD(Ts, ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
-            {
-                // this future should be 'empty' still (it can't be made ready
-                // more than once).
-                l.unlock();
-                HPX_THROW_EXCEPTION(promise_already_satisfied,
-                    "future_data_base::set_value",
-                    "data has already been set for this future");
-                return;
-            }
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
+            this->make_ready(value, "future_data_base::set_value");
         }
 
         void set_exception(std::exception_ptr data) override
@@ -515,50 +525,10 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(HPX_MOVE(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
-            // The value has been set, changing the state to 'exception' at this
-            // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
-            {
-                // this future should be 'empty' still (it can't be made ready
-                // more than once).
-                l.unlock();
-                HPX_THROW_EXCEPTION(promise_already_satisfied,
-                    "future_data_base::set_exception",
-                    "data has already been set for this future");
-                return;
-            }
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
+            // The exception has been set, changing the state to 'exception' at
+            // this point signals to all other threads that this future is
+            // ready.
+            this->make_ready(exception, "future_data_base::set_exception");
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -641,7 +611,6 @@ namespace hpx { namespace lcos { namespace detail {
         using base_type::state_;
 
     private:
-        using base_type::cond_;
         future_data_storage_t<Result> storage_;
     };
 
@@ -910,6 +879,15 @@ namespace hpx { namespace lcos { namespace detail {
             return threads::invalid_thread_id;
         }
 
+        // prepare running in a separate thread, the returned data has to be
+        // used to register exactly one new work item
+        virtual threads::thread_init_data make_thread_init_data(
+            const char* /*annotation*/, launch /*policy*/)
+        {
+            HPX_ASSERT(false);    // shouldn't ever be called
+            return threads::thread_init_data();
+        }
+
     protected:
         static void run_impl(future_base_type this_)
         {
@@ -0,0 +1,32 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace lcos { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Shared states (future_data, task objects, continuations) are allocated
+    // from per-thread free lists, one for each size class. Objects larger than
+    // HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE bytes are allocated directly.
+    //
+    // Memory is returned to the free list of the thread which allocated it,
+    // also if it is released on another thread. Each free list holds at most
+    // HPX_SHARED_STATE_POOL_MAX_CACHED objects released by the owning thread
+    // and as many released by other threads.
+    HPX_LOCAL_EXPORT void* allocate_shared_state(std::size_t size);
+    HPX_LOCAL_EXPORT void deallocate_shared_state(
+        void* p, std::size_t size) noexcept;
+
+    // Return the number of allocations which were served from (hits) or which
+    // could not be served from (misses) the free lists of all threads.
+    HPX_LOCAL_EXPORT std::int64_t get_shared_state_pool_hits(bool reset);
+    HPX_LOCAL_EXPORT std::int64_t get_shared_state_pool_misses(bool reset);
+}}}    // namespace hpx::lcos::detail
@@ -95,11 +95,11 @@ namespace hpx { namespace lcos { namespace local {
             threads::thread_id_ref_type apply(threads::thread_pool_base* pool,
                 const char* annotation, launch policy, error_code& ec) override
             {
-                this->check_started();
-
-                hpx::intrusive_ptr<base_type> this_(this);
                 if (policy == launch::fork)
                 {
+                    this->check_started();
+
+                    hpx::intrusive_ptr<base_type> this_(this);
                     threads::thread_init_data data(
                         threads::make_thread_function_nullary(
                             util::deferred_call(
@@ -116,13 +116,22 @@ namespace hpx { namespace lcos { namespace local {
                 }
 
                 threads::thread_init_data data(
+                    make_thread_init_data(annotation, policy));
+                return threads::register_work(data, pool, ec);
+            }
+
+            threads::thread_init_data make_thread_init_data(
+                const char* annotation, launch policy) override
+            {
+                this->check_started();
+
+                hpx::intrusive_ptr<base_type> this_(this);
+                return threads::thread_init_data(
                     threads::make_thread_function_nullary(util::deferred_call(
                         &base_type::run_impl, HPX_MOVE(this_))),
                     util::thread_description(f_, annotation), policy.priority(),
                     policy.hint(), policy.stacksize(),
                     threads::thread_schedule_state::pending);
-
-                return threads::register_work(data, pool, ec);
             }
         };
 
@@ -249,6 +258,15 @@ namespace hpx { namespace lcos { namespace local {
 
                 return this->base_type::apply(pool, annotation, policy, ec);
             }
+
+            threads::thread_init_data make_thread_init_data(
+                const char* annotation, launch policy) override
+            {
+                // tasks bound to an executor are always launched through it
+                HPX_ASSERT(exec_ == nullptr);
+                return this->base_type::make_thread_init_data(
+                    annotation, policy);
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -745,6 +763,24 @@ namespace hpx { namespace lcos { namespace local {
             return task_->apply(pool, annotation, policy, ec);
         }
 
+        // Prepare the asynchronous execution of the task without launching
+        // it. The returned data has to be used to register exactly one new
+        // work item (see threads::register_work and
+        // threads::register_work_bulk).
+        threads::thread_init_data make_thread_init_data(
+            const char* annotation = "futures_factory::apply",
+            launch policy = launch::async) const
+        {
+            if (!task_)
+            {
+                HPX_THROW_EXCEPTION(task_moved,
+                    "futures_factory<Result()>::make_thread_init_data()",
+                    "futures_factory invalid (has it been moved?)");
+                return threads::thread_init_data();
+            }
+            return task_->make_thread_init_data(annotation, policy);
+        }
+
         // This is the same as get_future, except that it moves the
         // shared state into the returned future.
         hpx::future<Result> get_future(error_code& ec = throws)
@@ -20,7 +20,12 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <memory>
@@ -120,6 +125,53 @@ namespace hpx { namespace lcos { namespace detail {
             [&](std::exception_ptr ep) { cont.set_exception(HPX_MOVE(ep)); });
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Continuations attached using launch::inline_if_cheap keep track of how
+    // long the invocations of the same continuation type take. They are run
+    // inline if that time is short enough.
+    template <typename F>
+    struct inline_continuation_cost
+    {
+        static std::atomic<std::int64_t>& average() noexcept
+        {
+            // a negative value means nothing was measured yet
+            static std::atomic<std::int64_t> average_time(-1);
+            return average_time;
+        }
+
+        static bool is_cheap() noexcept
+        {
+            std::int64_t const avg = average().load(std::memory_order_relaxed);
+            return avg >= 0 && avg <= HPX_CONTINUATION_MAX_INLINE_TIME;
+        }
+
+        static void update(std::int64_t elapsed) noexcept
+        {
+            // exponential moving average, concurrent updates may lose a
+            // sample which is fine for our purposes
+            std::int64_t avg = average().load(std::memory_order_relaxed);
+            avg = avg < 0 ? elapsed : avg + (elapsed - avg) / 8;
+            average().store(avg, std::memory_order_relaxed);
+        }
+    };
+
+    // make sure inlined continuations do not recurse deeper than allowed
+    inline bool can_run_continuation_inline() noexcept
+    {
+        if (threads::get_self_ptr() == nullptr)
+        {
+            return false;
+        }
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        if (!this_thread::has_sufficient_stack_space())
+        {
+            return false;
+        }
+#endif
+        return threads::get_continuation_recursion_count() <
+            HPX_CONTINUATION_MAX_RECURSION_DEPTH;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Future, typename F, typename ContResult>
     class continuation : public detail::future_data<ContResult>
@@ -168,6 +220,7 @@ namespace hpx { namespace lcos { namespace detail {
         // NOLINTNEXTLINE(bugprone-forwarding-reference-overload)
         continuation(Func&& f)
           : started_(false)
+          , measure_(false)
           , id_(threads::invalid_thread_id)
           , f_(HPX_FORWARD(Func, f))
         {
@@ -177,16 +230,55 @@ namespace hpx { namespace lcos { namespace detail {
         continuation(init_no_addref no_addref, Func&& f)
           : base_type(no_addref)
           , started_(false)
+          , measure_(false)
           , id_(threads::invalid_thread_id)
           , f_(HPX_FORWARD(Func, f))
         {
         }
 
     protected:
+        // Returns whether the continuation has to be run on a new thread, as
+        // opposed to directly on the current thread.
+        template <typename Policy>
+        bool run_async(Policy const& policy)
+        {
+            if (hpx::detail::has_inline_if_cheap_policy(policy))
+            {
+                measure_ = true;
+                return !inline_continuation_cost<F>::is_cheap() ||
+                    !can_run_continuation_inline();
+            }
+            return hpx::detail::has_async_policy(policy);
+        }
+
+        // Record the time the invocation takes, if needed
+        template <typename Invoke>
+        void invoke_measured(Invoke&& invoke)
+        {
+            if (!measure_)
+            {
+                invoke();
+                return;
+            }
+
+            std::size_t& count = threads::get_continuation_recursion_count();
+            ++count;
+
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            invoke();
+            inline_continuation_cost<F>::update(static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now() - start));
+
+            --count;
+        }
+
         void run_impl(traits::detail::shared_state_ptr_for_t<Future>&& f)
         {
             Future future = traits::future_access<Future>::create(HPX_MOVE(f));
-            invoke_continuation(f_, HPX_MOVE(future), *this);
+            invoke_measured([&]() {
+                invoke_continuation(f_, HPX_MOVE(future), *this);
+            });
         }
 
         void run_impl_nounwrap(
@@ -195,8 +287,10 @@ namespace hpx { namespace lcos { namespace detail {
             using is_void = std::is_void<util::invoke_result_t<F, Future>>;
 
             Future future = traits::future_access<Future>::create(HPX_MOVE(f));
-            invoke_continuation_nounwrap(
-                f_, HPX_MOVE(future), *this, is_void{});
+            invoke_measured([&]() {
+                invoke_continuation_nounwrap(
+                    f_, HPX_MOVE(future), *this, is_void{});
+            });
         }
 
     public:
@@ -247,7 +341,9 @@ namespace hpx { namespace lcos { namespace detail {
             reset_id r(*this);
 
             Future future = traits::future_access<Future>::create(HPX_MOVE(f));
-            invoke_continuation(f_, HPX_MOVE(future), *this);
+            invoke_measured([&]() {
+                invoke_continuation(f_, HPX_MOVE(future), *this);
+            });
         }
 
         void async_impl_nounwrap(
@@ -258,8 +354,10 @@ namespace hpx { namespace lcos { namespace detail {
             reset_id r(*this);
 
             Future future = traits::future_access<Future>::create(HPX_MOVE(f));
-            invoke_continuation_nounwrap(
-                f_, HPX_MOVE(future), *this, is_void{});
+            invoke_measured([&]() {
+                invoke_continuation_nounwrap(
+                    f_, HPX_MOVE(future), *this, is_void{});
+            });
         }
 
     public:
@@ -396,7 +494,7 @@ namespace hpx { namespace lcos { namespace detail {
                 [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
                     policy = HPX_FORWARD(Policy, policy),
                     &spawner]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (this_->run_async(policy))
                     {
                         this_->async(HPX_MOVE(state), spawner);
                     }
@@ -432,7 +530,7 @@ namespace hpx { namespace lcos { namespace detail {
                 [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
                     policy = HPX_FORWARD(Policy, policy),
                     spawner = HPX_MOVE(spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (this_->run_async(policy))
                     {
                         this_->async(HPX_MOVE(state), HPX_MOVE(spawner));
                     }
@@ -469,7 +567,7 @@ namespace hpx { namespace lcos { namespace detail {
                 [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
                     policy = HPX_FORWARD(Policy, policy),
                     &spawner]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (this_->run_async(policy))
                     {
                         this_->async_nounwrap(HPX_MOVE(state), spawner);
                     }
@@ -505,7 +603,7 @@ namespace hpx { namespace lcos { namespace detail {
                 [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
                     policy = HPX_FORWARD(Policy, policy),
                     spawner = HPX_MOVE(spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (this_->run_async(policy))
                     {
                         this_->async_nounwrap(
                             HPX_MOVE(state), HPX_MOVE(spawner));
@@ -519,6 +617,7 @@ namespace hpx { namespace lcos { namespace detail {
 
     protected:
         bool started_;
+        bool measure_;
         threads::thread_id_type id_;
         std::decay_t<F> f_;
     };
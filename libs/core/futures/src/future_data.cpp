@@ -110,11 +110,12 @@ namespace hpx { namespace lcos { namespace detail {
         // - there are multiple readers only (shared_future, lock hurts
         //   concurrency)
 
-        // Avoid retrieving state twice. If wait() returns 'empty' then this
-        // thread was suspended, in this case we need to load it again.
-        if (s == empty)
+        // Avoid retrieving state twice. If wait() returns a state which is not
+        // ready then this thread was suspended, in this case we need to load
+        // it again.
+        if ((s & ready) == 0)
         {
-            s = state_.load(std::memory_order_relaxed);
+            s = state_.load(std::memory_order_acquire);
         }
 
         if (s == value)
@@ -122,7 +123,7 @@ namespace hpx { namespace lcos { namespace detail {
             return &unused_;
         }
 
-        if (s == empty)
+        if ((s & ready) == 0)
         {
             // the value has already been moved out of this future
             HPX_THROWS_IF(ec, no_state, "future_data_base::get_result",
@@ -245,6 +246,131 @@ namespace hpx { namespace lcos { namespace detail {
     future_data_base<traits::detail::future_data_void>::handle_on_completed<
         completed_callback_vector_type>(completed_callback_vector_type&&);
 
+    ///////////////////////////////////////////////////////////////////////////
+    bool future_data_base<traits::detail::future_data_void>::set_has_waiters()
+    {
+        state s = state_.load(std::memory_order_acquire);
+        while (true)
+        {
+            if ((s & ready) != 0)
+            {
+                return false;
+            }
+
+            if ((s & busy) != 0)
+            {
+                // a continuation is being stored concurrently, this will be
+                // finished shortly
+                hpx::util::yield_while(
+                    [this]() {
+                        return (state_.load(std::memory_order_acquire) &
+                                   busy) != 0;
+                    },
+                    "future_data_base::set_has_waiters");
+                s = state_.load(std::memory_order_acquire);
+                continue;
+            }
+
+            if ((s & has_waiters) != 0 ||
+                state_.compare_exchange_weak(s,
+                    static_cast<state>(s | has_waiters),
+                    std::memory_order_acq_rel))
+            {
+                return true;
+            }
+        }
+    }
+
+    void future_data_base<traits::detail::future_data_void>::make_ready(
+        state new_state, char const* func)
+    {
+        HPX_ASSERT((new_state & ready) != 0);
+
+        // Fast path: as long as nobody waits for this future and at most one
+        // continuation was registered, the mutex is not needed.
+        state s = state_.load(std::memory_order_acquire);
+        while ((s & has_waiters) == 0)
+        {
+            if ((s & ready) != 0)
+            {
+                // this future should not be ready yet (it can't be made ready
+                // more than once).
+                HPX_THROW_EXCEPTION(promise_already_satisfied, func,
+                    "data has already been set for this future");
+                return;
+            }
+
+            if ((s & busy) != 0)
+            {
+                hpx::util::yield_while(
+                    [this]() {
+                        return (state_.load(std::memory_order_acquire) &
+                                   busy) != 0;
+                    },
+                    "future_data_base::make_ready");
+                s = state_.load(std::memory_order_acquire);
+                continue;
+            }
+
+            if (state_.compare_exchange_weak(
+                    s, new_state, std::memory_order_acq_rel))
+            {
+                // invoke the callback (continuation) function, nobody else
+                // is able to access it anymore
+                if ((s & has_callback) != 0)
+                {
+                    auto on_completed = HPX_MOVE(on_completed_);
+                    on_completed_.clear();
+
+                    handle_on_completed(HPX_MOVE(on_completed));
+                }
+                return;
+            }
+        }
+
+        // At this point the lock needs to be acquired to safely access the
+        // registered continuations and the waiting threads
+        std::unique_lock l(mtx_);
+
+        // handle all threads waiting for the future to become ready
+        auto on_completed = HPX_MOVE(on_completed_);
+        on_completed_.clear();
+
+        // Nobody can modify the state while the lock is held, except for
+        // threads which attempt to make this future ready concurrently.
+        s = state_.load(std::memory_order_relaxed);
+        if ((s & ready) != 0 ||
+            !state_.compare_exchange_strong(
+                s, new_state, std::memory_order_release))
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(promise_already_satisfied, func,
+                "data has already been set for this future");
+            return;
+        }
+
+        // Note: we use notify_one repeatedly instead of notify_all as we
+        //       know: a) that most of the time we have at most one thread
+        //       waiting on the future (most futures are not shared), and
+        //       b) our implementation of condition_variable::notify_one
+        //       relinquishes the lock before resuming the waiting thread
+        //       which avoids suspension of this thread when it tries to
+        //       re-lock the mutex while exiting from condition_variable::wait
+        while (cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
+        {
+            l = std::unique_lock(mtx_);
+        }
+
+        // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+        //       it unlocked when returning.
+
+        // invoke the callback (continuation) function
+        if (!on_completed.empty())
+        {
+            handle_on_completed(HPX_MOVE(on_completed));
+        }
+    }
+
     /// Set the callback which needs to be invoked when the future becomes
     /// ready. If the future is ready the function will be invoked
     /// immediately.
@@ -254,48 +380,52 @@ namespace hpx { namespace lcos { namespace detail {
         if (!data_sink)
             return;
 
-        if (is_ready())
+        state s = state_.load(std::memory_order_acquire);
+        if (s == empty &&
+            state_.compare_exchange_strong(
+                s, busy, std::memory_order_acquire))
         {
-            // invoke the callback (continuation) function right away
-            handle_on_completed(HPX_MOVE(data_sink));
+            // This is the first continuation and nobody is waiting, store it
+            // without acquiring the lock. Marking the state as 'busy' keeps
+            // all other threads from touching the continuations meanwhile.
+            on_completed_.push_back(HPX_MOVE(data_sink));
+            state_.store(has_callback, std::memory_order_release);
+            return;
         }
-        else
+
+        if ((s & ready) == 0)
         {
             std::unique_lock l(mtx_);
-            if (is_ready())
-            {
-                l.unlock();
-
-                // invoke the callback (continuation) function
-                handle_on_completed(HPX_MOVE(data_sink));
-            }
-            else
+            if (set_has_waiters())
             {
                 on_completed_.push_back(HPX_MOVE(data_sink));
+                return;
             }
         }
+
+        // invoke the callback (continuation) function right away
+        handle_on_completed(HPX_MOVE(data_sink));
     }
 
     future_data_base<traits::detail::future_data_void>::state
     future_data_base<traits::detail::future_data_void>::wait(error_code& ec)
     {
-        // block if this entry is empty
+        // block if this entry is not ready yet
         state s = state_.load(std::memory_order_acquire);
-        if (s == empty)
+        if ((s & ready) == 0)
         {
             std::unique_lock l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
-            if (s == empty)
+            if (set_has_waiters())
             {
                 cond_.wait(l, "future_data_base::wait", ec);
                 if (ec)
                 {
-                    return s;
+                    return state_.load(std::memory_order_relaxed);
                 }
-
-                // reload the state, it's not empty anymore
-                s = state_.load(std::memory_order_relaxed);
             }
+
+            // reload the state, it's ready now
+            s = state_.load(std::memory_order_acquire);
         }
 
         if (&ec != &throws)
@@ -309,11 +439,11 @@ namespace hpx { namespace lcos { namespace detail {
     future_data_base<traits::detail::future_data_void>::wait_until(
         std::chrono::steady_clock::time_point const& abs_time, error_code& ec)
     {
-        // block if this entry is empty
-        if (state_.load(std::memory_order_acquire) == empty)
+        // block if this entry is not ready yet
+        if (!is_ready())
         {
             std::unique_lock l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            if (set_has_waiters())
             {
                 threads::thread_restart_state const reason = cond_.wait_until(
                     l, abs_time, "future_data_base::wait_until", ec);
@@ -0,0 +1,394 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail {
+
+#if HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE > 0
+    namespace {
+        struct shared_state_cache;
+
+        // Every block starts with a header referring to the cache of the
+        // thread which allocated it. The header is padded to keep the
+        // alignment of the object stored behind it.
+        struct block_header
+        {
+            shared_state_cache* owner;
+        };
+
+        constexpr std::size_t header_size =
+            (std::max)(sizeof(block_header), alignof(std::max_align_t));
+
+        constexpr std::size_t size_class_granularity = 64;
+        constexpr std::size_t num_size_classes =
+            (HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE + header_size +
+                size_class_granularity - 1) /
+            size_class_granularity;
+
+        constexpr std::size_t get_size_class(std::size_t size) noexcept
+        {
+            return (size + header_size - 1) / size_class_granularity;
+        }
+
+        void* allocate_block(std::size_t size_class)
+        {
+            util::internal_allocator<char> alloc;
+            return alloc.allocate((size_class + 1) * size_class_granularity);
+        }
+
+        void deallocate_block(void* p, std::size_t size_class) noexcept
+        {
+            util::internal_allocator<char> alloc;
+            alloc.deallocate(static_cast<char*>(p),
+                (size_class + 1) * size_class_granularity);
+        }
+
+        // unused blocks are linked through their first bytes
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Each thread owns a cache with one free list per size class. Blocks
+        // released by the owner go on its free list directly, blocks released
+        // by other threads are pushed onto a lock-free list of the owner
+        // which the owner takes over once its own free list runs empty. This
+        // way blocks flow back to the producer if shared states are created
+        // on one thread and released on another.
+        //
+        // Caches are never destroyed. The cache of an exiting thread is handed
+        // over to the next thread which needs one, as other threads may still
+        // return blocks to it.
+        struct shared_state_cache
+        {
+            shared_state_cache()
+              : hits_(0)
+              , misses_(0)
+            {
+                for (std::size_t i = 0; i != num_size_classes; ++i)
+                {
+                    free_lists_[i] = nullptr;
+                    free_counts_[i] = 0;
+                    remote_free_lists_[i].data_.store(
+                        nullptr, std::memory_order_relaxed);
+                    remote_free_counts_[i].data_.store(
+                        0, std::memory_order_relaxed);
+                }
+            }
+
+            // only the owning thread modifies the counters
+            static void increment(std::atomic<std::int64_t>& count) noexcept
+            {
+                count.store(count.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+            }
+
+            // called by the owner
+            void* allocate(std::size_t size_class) noexcept
+            {
+                if (free_lists_[size_class] == nullptr)
+                {
+                    collect_remote(size_class);
+                    if (free_lists_[size_class] == nullptr)
+                    {
+                        increment(misses_);
+                        return nullptr;
+                    }
+                }
+
+                increment(hits_);
+
+                free_block* block = free_lists_[size_class];
+                free_lists_[size_class] = block->next;
+                --free_counts_[size_class];
+                return block;
+            }
+
+            // called by the owner
+            bool deallocate(void* p, std::size_t size_class) noexcept
+            {
+                if (free_counts_[size_class] >=
+                    HPX_SHARED_STATE_POOL_MAX_CACHED)
+                {
+                    return false;
+                }
+
+                free_block* block = static_cast<free_block*>(p);
+                block->next = free_lists_[size_class];
+                free_lists_[size_class] = block;
+                ++free_counts_[size_class];
+                return true;
+            }
+
+            // called by any thread other than the owner
+            bool deallocate_remote(void* p, std::size_t size_class) noexcept
+            {
+                std::atomic<std::size_t>& count =
+                    remote_free_counts_[size_class].data_;
+                if (count.fetch_add(1, std::memory_order_relaxed) >=
+                    HPX_SHARED_STATE_POOL_MAX_CACHED)
+                {
+                    count.fetch_sub(1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                std::atomic<free_block*>& head =
+                    remote_free_lists_[size_class].data_;
+
+                free_block* block = static_cast<free_block*>(p);
+                block->next = head.load(std::memory_order_relaxed);
+                while (!head.compare_exchange_weak(block->next, block,
+                    std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+                return true;
+            }
+
+            // Move the blocks returned by other threads to the free list of
+            // the owner. The whole list is taken at once, which avoids the
+            // ABA problem.
+            void collect_remote(std::size_t size_class) noexcept
+            {
+                std::atomic<free_block*>& head =
+                    remote_free_lists_[size_class].data_;
+                if (head.load(std::memory_order_relaxed) == nullptr)
+                {
+                    return;
+                }
+
+                free_block* blocks =
+                    head.exchange(nullptr, std::memory_order_acquire);
+
+                std::size_t count = 0;
+                while (blocks != nullptr)
+                {
+                    free_block* next = blocks->next;
+                    blocks->next = free_lists_[size_class];
+                    free_lists_[size_class] = blocks;
+                    blocks = next;
+                    ++count;
+                }
+
+                free_counts_[size_class] += count;
+                remote_free_counts_[size_class].data_.fetch_sub(
+                    count, std::memory_order_relaxed);
+            }
+
+            std::array<free_block*, num_size_classes> free_lists_;
+            std::array<std::size_t, num_size_classes> free_counts_;
+
+            std::array<util::cache_line_data<std::atomic<free_block*>>,
+                num_size_classes>
+                remote_free_lists_;
+            std::array<util::cache_line_data<std::atomic<std::size_t>>,
+                num_size_classes>
+                remote_free_counts_;
+
+            std::atomic<std::int64_t> hits_;
+            std::atomic<std::int64_t> misses_;
+        };
+
+        // All caches are registered, which allows to collect the statistics
+        // and to hand over the caches of exited threads.
+        struct shared_state_cache_registry
+        {
+            using mutex_type = hpx::util::detail::spinlock;
+
+            mutex_type mtx_;
+            std::vector<shared_state_cache*> caches_;
+            std::vector<shared_state_cache*> unused_caches_;
+            std::int64_t reset_hits_ = 0;
+            std::int64_t reset_misses_ = 0;
+        };
+
+        shared_state_cache_registry& get_registry()
+        {
+            // the registry is never destroyed, threads may exit (and release
+            // their caches) during static destruction
+            static shared_state_cache_registry* registry =
+                new shared_state_cache_registry;
+            return *registry;
+        }
+
+        // Associates a cache with the current thread, the cache is released
+        // for reuse by other threads once the thread exits.
+        struct thread_cache_holder
+        {
+            thread_cache_holder()
+              : cache_(nullptr)
+            {
+                shared_state_cache_registry& registry = get_registry();
+
+                std::lock_guard<shared_state_cache_registry::mutex_type> l(
+                    registry.mtx_);
+                if (!registry.unused_caches_.empty())
+                {
+                    cache_ = registry.unused_caches_.back();
+                    registry.unused_caches_.pop_back();
+                }
+                else
+                {
+                    cache_ = new shared_state_cache;
+                    registry.caches_.push_back(cache_);
+                }
+            }
+
+            ~thread_cache_holder();
+
+            shared_state_cache* cache_;
+        };
+
+        // this is set once the cache of the current thread has been released
+        thread_local bool cache_released = false;
+
+        thread_cache_holder::~thread_cache_holder()
+        {
+            cache_released = true;
+
+            shared_state_cache_registry& registry = get_registry();
+
+            std::lock_guard<shared_state_cache_registry::mutex_type> l(
+                registry.mtx_);
+            registry.unused_caches_.push_back(cache_);
+        }
+
+        shared_state_cache* get_cache() noexcept
+        {
+            // memory may still be released while the thread exits
+            if (cache_released)
+            {
+                return nullptr;
+            }
+
+            static thread_local thread_cache_holder holder;
+            return holder.cache_;
+        }
+
+        std::int64_t get_statistics(
+            std::atomic<std::int64_t> shared_state_cache::*count,
+            std::int64_t shared_state_cache_registry::*reset_value, bool reset)
+        {
+            shared_state_cache_registry& registry = get_registry();
+
+            std::lock_guard<shared_state_cache_registry::mutex_type> l(
+                registry.mtx_);
+
+            std::int64_t result = 0;
+            for (shared_state_cache* cache : registry.caches_)
+            {
+                result += (cache->*count).load(std::memory_order_relaxed);
+            }
+
+            std::int64_t const value = result - registry.*reset_value;
+            if (reset)
+            {
+                registry.*reset_value = result;
+            }
+            return value;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* allocate_shared_state(std::size_t size)
+    {
+        if (size == 0 || size > HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE)
+        {
+            return ::operator new(size);
+        }
+
+        std::size_t const size_class = get_size_class(size);
+
+        shared_state_cache* cache = get_cache();
+
+        void* p = nullptr;
+        if (cache != nullptr)
+        {
+            p = cache->allocate(size_class);
+        }
+        if (p == nullptr)
+        {
+            p = allocate_block(size_class);
+        }
+
+        static_cast<block_header*>(p)->owner = cache;
+        return static_cast<char*>(p) + header_size;
+    }
+
+    void deallocate_shared_state(void* p, std::size_t size) noexcept
+    {
+        if (size == 0 || size > HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        std::size_t const size_class = get_size_class(size);
+
+        void* block = static_cast<char*>(p) - header_size;
+        shared_state_cache* owner = static_cast<block_header*>(block)->owner;
+
+        if (owner != nullptr)
+        {
+            if (owner == get_cache() ?
+                    owner->deallocate(block, size_class) :
+                    owner->deallocate_remote(block, size_class))
+            {
+                return;
+            }
+        }
+
+        deallocate_block(block, size_class);
+    }
+
+    std::int64_t get_shared_state_pool_hits(bool reset)
+    {
+        return get_statistics(&shared_state_cache::hits_,
+            &shared_state_cache_registry::reset_hits_, reset);
+    }
+
+    std::int64_t get_shared_state_pool_misses(bool reset)
+    {
+        return get_statistics(&shared_state_cache::misses_,
+            &shared_state_cache_registry::reset_misses_, reset);
+    }
+#else
+    ///////////////////////////////////////////////////////////////////////////
+    // pooling has been disabled
+    void* allocate_shared_state(std::size_t size)
+    {
+        return ::operator new(size);
+    }
+
+    void deallocate_shared_state(void* p, std::size_t) noexcept
+    {
+        ::operator delete(p);
+    }
+
+    std::int64_t get_shared_state_pool_hits(bool)
+    {
+        return 0;
+    }
+
+    std::int64_t get_shared_state_pool_misses(bool)
+    {
+        return 0;
+    }
+#endif
+}}}    // namespace hpx::lcos::detail
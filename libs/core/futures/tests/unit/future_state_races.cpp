@@ -0,0 +1,172 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Making a future ready races with registering continuations and with
+// threads waiting for the future. Every continuation has to run exactly
+// once and every waiting thread has to be woken up, independently of
+// whether the shared state was modified with or without acquiring its lock.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+constexpr int num_iterations = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+// A single continuation is registered while the future is made ready.
+void test_single_continuation()
+{
+    for (int i = 0; i != num_iterations; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::future<int> f = p.get_future();
+
+        hpx::latch l(2);
+        hpx::future<void> setter = hpx::async([&]() {
+            l.arrive_and_wait();
+            p.set_value(i);
+        });
+
+        std::atomic<int> calls(0);
+        l.arrive_and_wait();
+        hpx::future<int> result = f.then([&](hpx::future<int>&& f) {
+            ++calls;
+            return f.get();
+        });
+
+        HPX_TEST_EQ(result.get(), i);
+        HPX_TEST_EQ(calls.load(), 1);
+        setter.get();
+    }
+}
+
+// Several continuations and waiting threads are registered while the future
+// is made ready with an exception.
+void test_continuations_and_waiters()
+{
+    std::size_t const num_continuations = 4;
+    std::size_t const num_waiters = 4;
+
+    for (int i = 0; i != num_iterations / 10; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::shared_future<int> f = p.get_future();
+
+        std::atomic<std::size_t> calls(0);
+        std::atomic<std::size_t> exceptions(0);
+
+        hpx::latch l(num_continuations + num_waiters + 2);
+
+        std::vector<hpx::future<void>> tasks;
+        for (std::size_t j = 0; j != num_continuations; ++j)
+        {
+            tasks.push_back(hpx::async([&]() {
+                l.arrive_and_wait();
+                f.then([&](hpx::shared_future<int>&& f) {
+                     ++calls;
+                     if (f.has_exception())
+                     {
+                         ++exceptions;
+                     }
+                 }).get();
+            }));
+        }
+        for (std::size_t j = 0; j != num_waiters; ++j)
+        {
+            tasks.push_back(hpx::async([&]() {
+                l.arrive_and_wait();
+                f.wait();
+                HPX_TEST(f.is_ready());
+                HPX_TEST(f.has_exception());
+            }));
+        }
+        tasks.push_back(hpx::async([&]() {
+            l.arrive_and_wait();
+            p.set_exception(
+                std::make_exception_ptr(std::runtime_error("test")));
+        }));
+
+        l.arrive_and_wait();
+        hpx::wait_all(tasks);
+
+        HPX_TEST_EQ(calls.load(), num_continuations);
+        HPX_TEST_EQ(exceptions.load(), num_continuations);
+    }
+}
+
+// A future can't be made ready twice, both with and without threads
+// waiting for it.
+void test_promise_already_satisfied()
+{
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::future<int> f = p.get_future();
+        p.set_value(1);
+
+        bool caught_exception = false;
+        try
+        {
+            p.set_value(2);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::promise_already_satisfied);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+        HPX_TEST_EQ(f.get(), 1);
+    }
+
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::shared_future<int> f = p.get_future();
+
+        // two continuations force the lock to be taken
+        hpx::future<int> f1 =
+            f.then([](hpx::shared_future<int>&& f) { return f.get(); });
+        hpx::future<int> f2 =
+            f.then([](hpx::shared_future<int>&& f) { return f.get(); });
+        p.set_value(1);
+
+        bool caught_exception = false;
+        try
+        {
+            p.set_exception(
+                std::make_exception_ptr(std::runtime_error("test")));
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::promise_already_satisfied);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+        HPX_TEST_EQ(f1.get(), 1);
+        HPX_TEST_EQ(f2.get(), 1);
+    }
+}
+
+int hpx_main()
+{
+    test_single_continuation();
+    test_continuations_and_waiters();
+    test_promise_already_satisfied();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
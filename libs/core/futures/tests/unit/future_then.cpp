@@ -211,6 +211,41 @@ void test_complex_then_chain_two()
     HPX_TEST(f2.get() == 4);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_then_inline_if_cheap()
+{
+    // cheap continuations are run inline once they have been measured,
+    // the results have to be the same either way
+    for (int i = 0; i != 100; ++i)
+    {
+        hpx::future<int> f = hpx::make_ready_future(i);
+        for (int j = 0; j != 10; ++j)
+        {
+            f = f.then(hpx::launch::inline_if_cheap,
+                [](hpx::future<int>&& f) { return f.get() + 1; });
+        }
+        HPX_TEST_EQ(f.get(), i + 10);
+    }
+
+    // continuations which suspend work as well
+    hpx::future<int> f2 =
+        hpx::async(p1).then(hpx::launch::inline_if_cheap, &p2);
+    HPX_TEST_EQ(f2.get(), 2);
+
+    // the policy is neither launch::sync nor launch::async
+    hpx::launch const policy = hpx::launch::inline_if_cheap;
+    HPX_TEST(policy != hpx::launch::sync);
+    HPX_TEST(policy != hpx::launch::async);
+    HPX_TEST(!hpx::detail::has_async_policy(policy));
+    HPX_TEST(hpx::detail::has_inline_if_cheap_policy(policy));
+
+    // anything but a continuation is run on a new thread
+    hpx::thread::id const self = hpx::this_thread::get_id();
+    hpx::future<hpx::thread::id> f3 = hpx::async(hpx::launch::inline_if_cheap,
+        []() { return hpx::this_thread::get_id(); });
+    HPX_TEST(f3.get() != self);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -227,6 +262,7 @@ int hpx_main()
         test_complex_then_chain_one();
         test_complex_then_chain_one_launch();
         test_complex_then_chain_two();
+        test_then_inline_if_cheap();
     }
 
     hpx::local::finalize();
@@ -0,0 +1,121 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/config.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using hpx::lcos::detail::get_shared_state_pool_hits;
+using hpx::lcos::detail::get_shared_state_pool_misses;
+
+// Shared states created by promises are allocated from the pool, shared
+// states created through an allocator (like make_ready_future) are not.
+hpx::future<int> make_future(int value)
+{
+    hpx::lcos::local::promise<int> p;
+    hpx::future<int> f = p.get_future();
+    p.set_value(value);
+    return f;
+}
+
+// Shared states released on the thread which created them are recycled.
+void test_same_thread()
+{
+    std::int64_t const hits_before = get_shared_state_pool_hits(false);
+    std::int64_t const misses_before = get_shared_state_pool_misses(false);
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        hpx::future<int> f = make_future(i);
+        HPX_TEST_EQ(f.get(), i);
+    }
+
+    {
+        std::vector<hpx::future<int>> futures;
+        for (int i = 0; i != 100; ++i)
+        {
+            futures.push_back(make_future(i));
+        }
+        for (int i = 0; i != 100; ++i)
+        {
+            HPX_TEST_EQ(futures[i].get(), i);
+        }
+    }
+
+    std::int64_t const hits = get_shared_state_pool_hits(false) - hits_before;
+    std::int64_t const misses =
+        get_shared_state_pool_misses(false) - misses_before;
+
+#if HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE > 0
+    // All but the first few shared states should have been recycled.
+    HPX_TEST_LTE(std::int64_t(1100), hits + misses);
+    HPX_TEST_LTE(misses, std::int64_t(100));
+#else
+    HPX_TEST_EQ(hits, std::int64_t(0));
+    HPX_TEST_EQ(misses, std::int64_t(0));
+#endif
+}
+
+// Shared states created by a producer and released by a consumer are
+// returned to the producer.
+void test_producer_consumer()
+{
+    int const num_rounds = 10;
+    int const num_futures = 100;
+
+    std::int64_t const hits_before = get_shared_state_pool_hits(false);
+    std::int64_t const misses_before = get_shared_state_pool_misses(false);
+
+    std::thread([&]() {
+        for (int round = 0; round != num_rounds; ++round)
+        {
+            std::vector<hpx::future<int>> futures;
+            for (int i = 0; i != num_futures; ++i)
+            {
+                futures.push_back(make_future(i));
+            }
+
+            std::thread([futures = std::move(futures), num_futures]() mutable {
+                for (int i = 0; i != num_futures; ++i)
+                {
+                    HPX_TEST_EQ(futures[i].get(), i);
+                }
+                futures.clear();
+            }).join();
+        }
+    }).join();
+
+    std::int64_t const hits = get_shared_state_pool_hits(false) - hits_before;
+    std::int64_t const misses =
+        get_shared_state_pool_misses(false) - misses_before;
+
+#if HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE > 0
+    // Only the shared states of the first round have to be allocated.
+    HPX_TEST_LTE(std::int64_t(num_rounds * num_futures), hits + misses);
+    HPX_TEST_LTE(misses, std::int64_t(num_futures));
+#else
+    HPX_TEST_EQ(hits, std::int64_t(0));
+    HPX_TEST_EQ(misses, std::int64_t(0));
+#endif
+}
+
+int main()
+{
+    test_same_thread();
+    test_producer_consumer();
+
+    // resetting the counters starts counting from zero
+    get_shared_state_pool_hits(true);
+    HPX_TEST_EQ(get_shared_state_pool_hits(false), std::int64_t(0));
+
+    return hpx::util::report_errors();
+}
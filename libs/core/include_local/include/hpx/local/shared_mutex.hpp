@@ -6,10 +6,12 @@
 
 #pragma once
 
+#include <hpx/synchronization/distributed_shared_mutex.hpp>
 #include <hpx/synchronization/lock_types.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 
 namespace hpx {
+    using hpx::lcos::local::distributed_shared_mutex;
     using hpx::lcos::local::shared_mutex;
     using hpx::lcos::local::upgrade_lock;
     using hpx::lcos::local::upgrade_to_unique_lock;
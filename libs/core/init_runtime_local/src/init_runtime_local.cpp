@@ -237,6 +237,12 @@ namespace hpx {
     defined(__FreeBSD__)
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
+                threads::coroutines::detail::posix::use_stack_arenas =
+                    cmdline.rtcfg_.use_stack_arenas();
+                threads::coroutines::detail::posix::stack_arena_size =
+                    cmdline.rtcfg_.get_stack_arena_size();
+                threads::coroutines::detail::posix::use_stack_huge_pages =
+                    cmdline.rtcfg_.use_stack_huge_pages();
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
@@ -264,6 +270,20 @@ namespace hpx {
                 util::detail::init_logging_local(cmdline.rtcfg_);
 #else
                 util::detail::warn_if_logging_requested(cmdline.rtcfg_);
+#endif
+#if (defined(__linux) || defined(linux) || defined(__linux__) ||               \
+    defined(__FreeBSD__)) &&                                                   \
+    defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                // guard pages keep the stack arenas from using huge pages
+                if (threads::coroutines::detail::posix::use_stack_huge_pages &&
+                    threads::coroutines::detail::posix::use_stack_arenas &&
+                    threads::coroutines::detail::posix::use_guard_pages)
+                {
+                    LRT_(warning).format(
+                        "activate_global_options: hpx.stacks.use_huge_pages "
+                        "is ignored because hpx.stacks.use_guard_pages is "
+                        "set");
+                }
 #endif
             }
 
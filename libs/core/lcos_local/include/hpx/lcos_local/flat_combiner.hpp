@@ -0,0 +1,284 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/future_access.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace local {
+    namespace detail {
+        // An operation published to a flat_combiner.
+        template <typename T>
+        struct flat_combiner_operation
+        {
+            virtual ~flat_combiner_operation() = default;
+
+            // Execute the operation, releases the reference to the
+            // operation held by the combiner.
+            virtual void run(T& data) noexcept = 0;
+
+            flat_combiner_operation* next = nullptr;
+        };
+
+        // The operation record is the shared state of the future returned
+        // for it, each operation needs a single allocation which is served
+        // from the pool of shared states (see shared_state_pool.hpp).
+        template <typename T, typename Result, typename F>
+        struct flat_combiner_task final
+          : lcos::detail::future_data<Result>
+          , flat_combiner_operation<T>
+        {
+            using base_type = lcos::detail::future_data<Result>;
+            using init_no_addref = typename base_type::init_no_addref;
+            using result_type = typename base_type::result_type;
+
+            template <typename F_>
+            flat_combiner_task(init_no_addref no_addref, F_&& f)
+              : base_type(no_addref)
+              , f_(HPX_FORWARD(F_, f))
+            {
+            }
+
+            void run(T& data) noexcept override
+            {
+                hpx::intrusive_ptr<base_type> this_(this, false);
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        if constexpr (std::is_void_v<Result>)
+                        {
+                            HPX_INVOKE(f_, data);
+                            this->set_value(result_type());
+                        }
+                        else
+                        {
+                            this->set_value(HPX_INVOKE(f_, data));
+                        }
+                    },
+                    [&](std::exception_ptr ep) {
+                        this->set_exception(HPX_MOVE(ep));
+                    });
+            }
+
+            F f_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Serializes operations on an object of type \a T by flat combining.
+    ///
+    /// A thread publishes its operation in the slot of the worker thread it
+    /// runs on and tries to become the combiner afterwards. The combiner
+    /// executes the operations published in all slots one after the other,
+    /// the other threads return right away. The object is touched by a
+    /// single thread at a time, and stays in the caches of the core running
+    /// the combiner while a burst of operations is executed. Threads not
+    /// managed by HPX share an additional slot.
+    ///
+    /// A combiner stops once no more operations are pending, or once it has
+    /// executed \a max_operations of them. In the latter case it hands the
+    /// remaining operations over to a new HPX thread, a thread publishing an
+    /// operation is never kept combining indefinitely.
+    ///
+    /// The result of an operation is returned through a future. There is
+    /// no order between operations, not even between two operations
+    /// published by the same HPX thread as the thread may be resumed on
+    /// another worker thread in between. Wait for the returned futures to
+    /// order operations.
+    template <typename T>
+    class flat_combiner
+    {
+    private:
+        using operation = detail::flat_combiner_operation<T>;
+
+    public:
+        /// Construct a \a flat_combiner guarding \a data with one slot for
+        /// each of \a num_slots worker threads. A combiner executes up to
+        /// \a max_operations operations before handing off.
+        explicit flat_combiner(T data = T(),
+            std::size_t num_slots = threads::hardware_concurrency(),
+            std::size_t max_operations = 256)
+          : slots_((num_slots == 0 ? 1 : num_slots) + 1)
+          , max_operations_(max_operations == 0 ? 1 : max_operations)
+          , handoffs_(0)
+          , data_(HPX_MOVE(data))
+        {
+            combining_.data_.store(false, std::memory_order_relaxed);
+        }
+
+        flat_combiner(flat_combiner const&) = delete;
+        flat_combiner& operator=(flat_combiner const&) = delete;
+
+        ~flat_combiner()
+        {
+            // wait for the threads the remaining operations were handed
+            // over to
+            hpx::util::yield_while([this]() {
+                return handoffs_.load(std::memory_order_acquire) != 0;
+            });
+            HPX_ASSERT(!has_pending());
+        }
+
+        /// Execute \a f with a reference to the guarded object, returns a
+        /// future to the result of \a f. The operation may be executed on
+        /// the calling thread, along with the operations of other threads.
+        template <typename F>
+        hpx::future<util::invoke_result_t<F, T&>> async(F&& f)
+        {
+            using result_type = util::invoke_result_t<F, T&>;
+            using task_type =
+                detail::flat_combiner_task<T, result_type, std::decay_t<F>>;
+            using init_no_addref = typename task_type::init_no_addref;
+
+            // one reference is held by the combiner, one by the future
+            task_type* task =
+                new task_type(init_no_addref{}, HPX_FORWARD(F, f));
+            hpx::future<result_type> result =
+                traits::future_access<hpx::future<result_type>>::create(task);
+
+            publish(task);
+            return result;
+        }
+
+    private:
+        void publish(operation* op)
+        {
+            std::size_t const num_thread = hpx::get_worker_thread_num();
+            std::atomic<operation*>& slot = num_thread == std::size_t(-1) ?
+                slots_.back().data_ :
+                slots_[num_thread % (slots_.size() - 1)].data_;
+
+            op->next = slot.load(std::memory_order_relaxed);
+            while (!slot.compare_exchange_weak(
+                op->next, op, std::memory_order_seq_cst))
+            {
+            }
+
+            combine();
+        }
+
+        void combine()
+        {
+            // operations published after the last pass of the combiner but
+            // before it released the lock are picked up by the combiner
+            // itself
+            while (!combining_.data_.exchange(true, std::memory_order_seq_cst))
+            {
+                std::size_t count = 0;
+                std::size_t passed = 0;
+                while (count < max_operations_ &&
+                    (passed = run_pending()) != 0)
+                {
+                    count += passed;
+                }
+
+                combining_.data_.store(false, std::memory_order_seq_cst);
+                if (!has_pending())
+                {
+                    return;
+                }
+
+                if (count >= max_operations_)
+                {
+                    hand_off();
+                    return;
+                }
+            }
+        }
+
+        // Continue combining on a new HPX thread.
+        void hand_off()
+        {
+            handoffs_.fetch_add(1, std::memory_order_relaxed);
+
+            threads::thread_init_data data(
+                threads::make_thread_function_nullary([this]() {
+                    combine();
+                    handoffs_.fetch_sub(1, std::memory_order_release);
+                }),
+                "flat_combiner::combine");
+            threads::register_work(data);
+        }
+
+        // Execute all operations published so far, returns the number of
+        // operations executed.
+        std::size_t run_pending()
+        {
+            std::size_t count = 0;
+            for (auto& slot : slots_)
+            {
+                // don't claim the cache line of an empty slot
+                if (slot.data_.load(std::memory_order_relaxed) == nullptr)
+                {
+                    continue;
+                }
+
+                operation* ops =
+                    slot.data_.exchange(nullptr, std::memory_order_acquire);
+
+                // the slot is a stack, execute the operations in the order
+                // they were published
+                operation* reversed = nullptr;
+                while (ops != nullptr)
+                {
+                    operation* next = ops->next;
+                    ops->next = reversed;
+                    reversed = ops;
+                    ops = next;
+                }
+
+                while (reversed != nullptr)
+                {
+                    ++count;
+
+                    operation* next = reversed->next;
+                    reversed->run(data_);
+                    reversed = next;
+                }
+            }
+            return count;
+        }
+
+        bool has_pending() const noexcept
+        {
+            for (auto const& slot : slots_)
+            {
+                if (slot.data_.load(std::memory_order_seq_cst) != nullptr)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // one slot per worker thread, the last one is shared by the threads
+        // not managed by HPX
+        std::vector<util::cache_aligned_data<std::atomic<operation*>>> slots_;
+        util::cache_aligned_data<std::atomic<bool>> combining_;
+        std::size_t const max_operations_;
+        std::atomic<std::size_t> handoffs_;
+        T data_;
+    };
+}}}    // namespace hpx::lcos::local
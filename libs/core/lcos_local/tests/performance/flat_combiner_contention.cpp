@@ -0,0 +1,135 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the throughput of increments of a shared counter by many HPX
+// threads serialized by a flat_combiner, a guard, and a mutex.
+
+#include <hpx/lcos_local/composable_guard.hpp>
+#include <hpx/lcos_local/flat_combiner.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#if HPX_DEBUG
+constexpr std::size_t NUM_INCREMENTS = 10000;
+#else
+constexpr std::size_t NUM_INCREMENTS = 100000;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run_tasks(std::size_t num_tasks, F const& f)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(f));
+    }
+    hpx::wait_all(tasks);
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+double test_flat_combiner(std::size_t num_tasks)
+{
+    hpx::lcos::local::flat_combiner<std::size_t> counter(0);
+
+    double elapsed = run_tasks(num_tasks, [&]() {
+        std::vector<hpx::future<void>> increments;
+        increments.reserve(NUM_INCREMENTS);
+        for (std::size_t i = 0; i != NUM_INCREMENTS; ++i)
+        {
+            increments.push_back(counter.async([](std::size_t& c) { ++c; }));
+        }
+        hpx::wait_all(increments);
+    });
+
+    if (counter.async([](std::size_t& c) { return c; }).get() !=
+        num_tasks * NUM_INCREMENTS)
+    {
+        std::cout << "Error!\n";
+    }
+    return elapsed;
+}
+
+double test_guard(std::size_t num_tasks)
+{
+    hpx::lcos::local::guard g;
+    std::size_t counter = 0;
+
+    double elapsed = run_tasks(num_tasks, [&]() {
+        for (std::size_t i = 0; i != NUM_INCREMENTS; ++i)
+        {
+            hpx::lcos::local::run_guarded(g, [&]() { ++counter; });
+        }
+    });
+
+    // the guarded tasks run in the order they were queued
+    hpx::lcos::local::promise<std::size_t> p;
+    hpx::future<std::size_t> f = p.get_future();
+    hpx::lcos::local::run_guarded(g, [&]() { p.set_value(counter); });
+    if (f.get() != num_tasks * NUM_INCREMENTS)
+    {
+        std::cout << "Error!\n";
+    }
+    return elapsed;
+}
+
+double test_mutex(std::size_t num_tasks)
+{
+    hpx::mutex mtx;
+    std::size_t counter = 0;
+
+    double elapsed = run_tasks(num_tasks, [&]() {
+        for (std::size_t i = 0; i != NUM_INCREMENTS; ++i)
+        {
+            std::lock_guard<hpx::mutex> l(mtx);
+            ++counter;
+        }
+    });
+
+    if (counter != num_tasks * NUM_INCREMENTS)
+    {
+        std::cout << "Error!\n";
+    }
+    return elapsed;
+}
+
+void print(char const* name, std::size_t num_tasks, double elapsed)
+{
+    double const num_ops = double(num_tasks * NUM_INCREMENTS);
+    std::cout << name << " throughput: " << (num_ops / elapsed)
+              << " [op/s] (" << (elapsed / num_ops) << " [s/op])\n";
+}
+
+int hpx_main()
+{
+    std::size_t const num_tasks = hpx::get_os_thread_count();
+
+    print("flat_combiner", num_tasks, test_flat_combiner(num_tasks));
+    print("guard", num_tasks, test_guard(num_tasks));
+    print("mutex", num_tasks, test_mutex(num_tasks));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
@@ -0,0 +1,317 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/futures/detail/shared_state_pool.hpp>
+#include <hpx/lcos_local/flat_combiner.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::lcos::local::flat_combiner;
+
+///////////////////////////////////////////////////////////////////////////////
+// Every increment sees a distinct value of the counter.
+void test_counter()
+{
+    flat_combiner<std::size_t> counter(0);
+
+    std::size_t const num_tasks = 100;
+    std::size_t const num_increments = 1000;
+
+    std::vector<hpx::future<std::vector<std::size_t>>> tasks;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&]() {
+            std::vector<hpx::future<std::size_t>> increments;
+            for (std::size_t j = 0; j != num_increments; ++j)
+            {
+                increments.push_back(
+                    counter.async([](std::size_t& c) { return c++; }));
+            }
+
+            std::vector<std::size_t> values;
+            for (auto& f : increments)
+            {
+                values.push_back(f.get());
+            }
+            return values;
+        }));
+    }
+
+    std::vector<std::size_t> values;
+    for (auto& f : tasks)
+    {
+        std::vector<std::size_t> v = f.get();
+        values.insert(values.end(), v.begin(), v.end());
+    }
+
+    std::sort(values.begin(), values.end());
+    HPX_TEST_EQ(values.size(), num_tasks * num_increments);
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(values[i], i);
+    }
+
+    HPX_TEST_EQ(counter.async([](std::size_t& c) { return c; }).get(),
+        num_tasks * num_increments);
+}
+
+// Operations on a data structure which is not thread-safe.
+void test_priority_queue()
+{
+    flat_combiner<std::priority_queue<int>> queue;
+
+    std::size_t const num_tasks = 100;
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&, i]() {
+            std::vector<hpx::future<void>> pushes;
+            for (int j = 0; j != 100; ++j)
+            {
+                int const value = int(i) * 100 + j;
+                pushes.push_back(queue.async(
+                    [value](std::priority_queue<int>& q) { q.push(value); }));
+            }
+            hpx::wait_all(pushes);
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    std::vector<int> values =
+        queue
+            .async([](std::priority_queue<int>& q) {
+                std::vector<int> result;
+                while (!q.empty())
+                {
+                    result.push_back(q.top());
+                    q.pop();
+                }
+                return result;
+            })
+            .get();
+
+    HPX_TEST_EQ(values.size(), num_tasks * 100);
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(values[i], int(values.size() - i - 1));
+    }
+}
+
+// An exception thrown by an operation is returned through its future, the
+// other operations are not affected.
+void test_exception()
+{
+    flat_combiner<std::string> str;
+
+    hpx::future<void> f1 = str.async([](std::string& s) { s += "a"; });
+    hpx::future<void> f2 = str.async(
+        [](std::string&) { throw std::runtime_error("operation failed"); });
+    hpx::future<void> f3 = str.async([](std::string& s) { s += "b"; });
+
+    f1.get();
+    bool caught_exception = false;
+    try
+    {
+        f2.get();
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    f3.get();
+
+    HPX_TEST_EQ(str.async([](std::string& s) { return s.size(); }).get(),
+        std::size_t(2));
+}
+
+// Threads not managed by HPX publish their operations as well.
+void test_external_threads()
+{
+    flat_combiner<std::size_t> counter(0);
+
+    std::size_t const num_threads = 4;
+    std::size_t const num_increments = 1000;
+
+    std::vector<std::vector<hpx::future<std::size_t>>> increments(
+        num_threads);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            for (std::size_t j = 0; j != num_increments; ++j)
+            {
+                increments[i].push_back(
+                    counter.async([](std::size_t& c) { return c++; }));
+            }
+        });
+    }
+
+    // operations published by HPX threads at the same time
+    std::vector<hpx::future<std::size_t>> hpx_increments;
+    for (std::size_t j = 0; j != num_increments; ++j)
+    {
+        hpx_increments.push_back(
+            counter.async([](std::size_t& c) { return c++; }));
+    }
+
+    for (std::thread& t : threads)
+    {
+        t.join();
+    }
+    increments.push_back(std::move(hpx_increments));
+
+    std::vector<std::size_t> values;
+    for (auto& v : increments)
+    {
+        for (auto& f : v)
+        {
+            values.push_back(f.get());
+        }
+    }
+
+    std::sort(values.begin(), values.end());
+    HPX_TEST_EQ(values.size(), (num_threads + 1) * num_increments);
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(values[i], i);
+    }
+}
+
+// Every operation publishes the next one of a chain while it is executed.
+struct publish_chain
+{
+    std::size_t operator()(std::size_t& c) const
+    {
+        if (remaining != 0)
+        {
+            futures.push_back(
+                counter.async(publish_chain{counter, futures, remaining - 1}));
+        }
+        return c++;
+    }
+
+    flat_combiner<std::size_t>& counter;
+    std::vector<hpx::future<std::size_t>>& futures;
+    std::size_t remaining;
+};
+
+// A combiner executing more than the given number of operations hands the
+// remaining ones over to a new thread. The combiner is destroyed only after
+// that thread has finished.
+void test_hand_off()
+{
+    std::size_t const num_tasks = 16;
+    std::size_t const num_increments = 1000;
+    std::size_t const chain_length = 100;
+
+    for (std::size_t max_operations : {1, 7})
+    {
+        {
+            flat_combiner<std::size_t> counter(
+                0, hpx::threads::hardware_concurrency(), max_operations);
+
+            std::vector<hpx::future<void>> tasks;
+            for (std::size_t i = 0; i != num_tasks; ++i)
+            {
+                tasks.push_back(hpx::async([&]() {
+                    std::vector<hpx::future<std::size_t>> increments;
+                    for (std::size_t j = 0; j != num_increments; ++j)
+                    {
+                        increments.push_back(
+                            counter.async([](std::size_t& c) { return c++; }));
+                    }
+                    hpx::wait_all(increments);
+                }));
+            }
+            hpx::wait_all(tasks);
+
+            HPX_TEST_EQ(counter.async([](std::size_t& c) { return c; }).get(),
+                num_tasks * num_increments);
+        }
+
+        // the operations published by operations are left to the thread
+        // combining after the current one
+        std::vector<hpx::future<std::size_t>> futures;
+        futures.reserve(chain_length);
+        {
+            flat_combiner<std::size_t> counter(
+                0, hpx::threads::hardware_concurrency(), max_operations);
+            HPX_TEST_EQ(
+                counter.async(publish_chain{counter, futures, chain_length})
+                    .get(),
+                std::size_t(0));
+        }
+
+        HPX_TEST_EQ(futures.size(), chain_length);
+        for (std::size_t i = 0; i != futures.size(); ++i)
+        {
+            HPX_TEST(futures[i].is_ready());
+            HPX_TEST_EQ(futures[i].get(), i + 1);
+        }
+    }
+}
+
+// The operations are allocated from the pool of shared states.
+void test_pooled_operations()
+{
+    using hpx::lcos::detail::get_shared_state_pool_hits;
+    using hpx::lcos::detail::get_shared_state_pool_misses;
+
+    flat_combiner<std::size_t> counter(0);
+
+    std::int64_t const hits_before = get_shared_state_pool_hits(false);
+    std::int64_t const misses_before = get_shared_state_pool_misses(false);
+
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        HPX_TEST_EQ(
+            counter.async([](std::size_t& c) { return c++; }).get(), i);
+    }
+
+    std::int64_t const hits = get_shared_state_pool_hits(false) - hits_before;
+    std::int64_t const misses =
+        get_shared_state_pool_misses(false) - misses_before;
+
+#if HPX_SHARED_STATE_POOL_MAX_OBJECT_SIZE > 0
+    HPX_TEST_LTE(std::int64_t(1000), hits + misses);
+    HPX_TEST_LTE(misses, std::int64_t(100));
+#else
+    HPX_TEST_EQ(hits, std::int64_t(0));
+    HPX_TEST_EQ(misses, std::int64_t(0));
+#endif
+}
+
+int hpx_main()
+{
+    test_counter();
+    test_priority_queue();
+    test_exception();
+    test_external_threads();
+    test_hand_off();
+    test_pooled_operations();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -71,5 +71,7 @@ namespace hpx { namespace resource {
         abp_priority_fifo = 5,
         abp_priority_lifo = 6,
         shared_priority = 7,
+        work_stealing = 8,
+        deadline = 9,
     };
 }}    // namespace hpx::resource
@@ -149,6 +149,12 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::work_stealing:
+            sched = "work_stealing";
+            break;
+        case resource::deadline:
+            sched = "deadline";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -476,6 +482,14 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 == std::string("work-stealing").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::work_stealing;
+        }
+        else if (0 == std::string("deadline").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::deadline;
+        }
         else
         {
             throw hpx::detail::command_line_error(
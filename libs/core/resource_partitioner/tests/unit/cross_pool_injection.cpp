@@ -276,6 +276,8 @@ int main(int argc, char* argv[])
 #endif
         hpx::resource::scheduling_policy::static_,
         hpx::resource::scheduling_policy::static_priority,
+        hpx::resource::scheduling_policy::work_stealing,
+        hpx::resource::scheduling_policy::deadline,
         // The shared_priority scheduler sometimes hangs in this test.
         //hpx::resource::scheduling_policy::shared_priority,
     };
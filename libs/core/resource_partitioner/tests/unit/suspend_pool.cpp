@@ -180,6 +180,8 @@ int main(int argc, char* argv[])
 #endif
         hpx::resource::scheduling_policy::static_,
         hpx::resource::scheduling_policy::static_priority,
+        hpx::resource::scheduling_policy::work_stealing,
+        hpx::resource::scheduling_policy::deadline,
         hpx::resource::scheduling_policy::shared_priority,
     };
 
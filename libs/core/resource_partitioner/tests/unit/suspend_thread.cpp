@@ -227,6 +227,8 @@ int main(int argc, char* argv[])
             hpx::resource::scheduling_policy::abp_priority_lifo,
 #endif
             hpx::resource::scheduling_policy::shared_priority,
+            hpx::resource::scheduling_policy::work_stealing,
+            hpx::resource::scheduling_policy::deadline,
         };
 
         for (auto const scheduler : schedulers)
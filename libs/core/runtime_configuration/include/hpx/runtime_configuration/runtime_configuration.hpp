@@ -112,6 +112,9 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+        bool use_stack_arenas() const;
+        std::size_t get_stack_arena_size() const;
+        bool use_stack_huge_pages() const;
 #endif
 
         // return trace_depth for stack-backtraces
@@ -210,6 +210,9 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_arenas = ${HPX_USE_STACK_ARENAS:0}",
+            "arena_size = ${HPX_STACK_ARENA_SIZE:256}",
+            "use_huge_pages = ${HPX_USE_STACK_HUGE_PAGES:0}",
 #endif
 
             "[hpx.threadpools]",
@@ -251,6 +254,9 @@ namespace hpx { namespace util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "max_remote_cached_threads = "
+            "${HPX_THREAD_QUEUE_MAX_REMOTE_CACHED_THREADS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_REMOTE_CACHED_THREADS)) "}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -1087,6 +1093,38 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_arenas() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_arenas", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    std::size_t runtime_configuration::get_stack_arena_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "arena_size", 256);
+        }
+        return 256;
+    }
+
+    bool runtime_configuration::use_stack_huge_pages() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_huge_pages", 0) !=
+                0;
+        }
+        return false;    // default is false
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
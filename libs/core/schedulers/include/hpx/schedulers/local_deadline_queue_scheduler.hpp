@@ -0,0 +1,289 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/local/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    namespace detail {
+        // The pending queues store either plain thread pointers or thread
+        // descriptions (if HPX_HAVE_THREAD_QUEUE_WAITTIME is defined).
+        inline thread_init_data::deadline_type get_deadline(
+            threads::detail::thread_data_reference_counting* thrd) noexcept
+        {
+            return static_cast<thread_data*>(thrd)->get_deadline();
+        }
+
+        template <typename ThreadDescription>
+        auto get_deadline(ThreadDescription* tdesc) noexcept
+            -> decltype(get_thread_id_data(tdesc->data)->get_deadline())
+        {
+            return get_thread_id_data(tdesc->data)->get_deadline();
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Queue backend which returns the work item with the earliest deadline
+    // first. Work items with the same deadline are returned in FIFO order,
+    // items pushed to the other end go before all items with the same
+    // deadline.
+    template <typename T>
+    struct deadline_heap_backend
+    {
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        using deadline_type = thread_init_data::deadline_type;
+        using mutex_type = hpx::util::detail::spinlock;
+
+        deadline_heap_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = size_type(-1))
+          : push_count_(0)
+          , push_front_count_(0)
+        {
+            heap_.reserve(std::size_t(initial_size));
+            earliest_.data_.store(
+                deadline_type::max().time_since_epoch().count(),
+                std::memory_order_relaxed);
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            push_locked(val, other_end);
+            update_earliest();
+            return true;
+        }
+
+        bool push_bulk(value_type const* first, std::size_t count,
+            bool other_end = false)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                push_locked(first[i], other_end);
+            }
+            update_earliest();
+            return true;
+        }
+
+        bool pop(reference val, bool /* steal */ = true)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (heap_.empty())
+            {
+                return false;
+            }
+
+            std::pop_heap(heap_.begin(), heap_.end(), entry_compare{});
+            val = heap_.back().value;
+            heap_.pop_back();
+
+            update_earliest();
+            return true;
+        }
+
+        bool empty()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return heap_.empty();
+        }
+
+        // Return the earliest deadline of all work items in this queue, this
+        // is deadline_type::max() if the queue is empty or if none of the work
+        // items has a deadline.
+        deadline_type get_earliest_deadline() const noexcept
+        {
+            return deadline_type(deadline_type::duration(
+                earliest_.data_.load(std::memory_order_relaxed)));
+        }
+
+    private:
+        struct entry
+        {
+            deadline_type deadline;
+            std::int64_t sequence;
+            value_type value;
+        };
+
+        // std::push_heap/pop_heap create a max-heap, the entry with the
+        // earliest deadline compares greatest
+        struct entry_compare
+        {
+            bool operator()(entry const& lhs, entry const& rhs) const noexcept
+            {
+                if (lhs.deadline != rhs.deadline)
+                {
+                    return rhs.deadline < lhs.deadline;
+                }
+                return rhs.sequence < lhs.sequence;
+            }
+        };
+
+        void push_locked(const_reference val, bool other_end)
+        {
+            std::int64_t const sequence =
+                other_end ? --push_front_count_ : ++push_count_;
+
+            heap_.push_back(entry{detail::get_deadline(val), sequence, val});
+            std::push_heap(heap_.begin(), heap_.end(), entry_compare{});
+        }
+
+        void update_earliest() noexcept
+        {
+            deadline_type const earliest =
+                heap_.empty() ? deadline_type::max() : heap_.front().deadline;
+            earliest_.data_.store(earliest.time_since_epoch().count(),
+                std::memory_order_relaxed);
+        }
+
+        mutex_type mtx_;
+        std::vector<entry, util::internal_allocator<entry>> heap_;
+        std::int64_t push_count_;
+        std::int64_t push_front_count_;
+
+        // allow other workers to find the most urgent work without locking
+        util::cache_line_data<std::atomic<deadline_type::rep>> earliest_;
+    };
+
+    struct deadline_heap
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = deadline_heap_backend<T>;
+        };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_deadline_queue_scheduler has the same queue structure as the
+    /// local_priority_queue_scheduler, but each worker thread runs its
+    /// pending threads in earliest-deadline-first order. Threads receive
+    /// their deadline through thread_init_data::deadline or through
+    /// hpx::execution::experimental::deadline_executor (or inherit the
+    /// deadline of the thread creating them), threads without a deadline run
+    /// after all threads which have one.
+    ///
+    /// A worker runs its own pending threads first. Only if it has none
+    /// left, it steals from the worker whose most urgent pending thread has
+    /// the earliest deadline, the other queues are not inspected otherwise.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = deadline_heap,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_priority_queue_scheduler_terminated_queue>
+    class HPX_LOCAL_EXPORT local_deadline_queue_scheduler
+      : public local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>
+    {
+    public:
+        using base_type = local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+
+        using init_parameter_type = typename base_type::init_parameter_type;
+        using deadline_type = thread_init_data::deadline_type;
+
+        local_deadline_queue_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+        {
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "local_deadline_queue_scheduler";
+        }
+
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing) override
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+
+            if (running && enable_stealing && !has_local_work(num_thread))
+            {
+                std::size_t const victim = find_most_urgent_queue(num_thread);
+                if (victim != num_thread &&
+                    base_type::steal_pending(this->queues_[victim].data_,
+                        this->queues_[num_thread].data_, thrd, running,
+                        false))
+                {
+                    return true;
+                }
+            }
+
+            return base_type::get_next_thread(
+                num_thread, running, thrd, enable_stealing);
+        }
+
+    private:
+        bool has_local_work(std::size_t num_thread) const
+        {
+            if (num_thread < this->num_high_priority_queues_ &&
+                this->high_priority_queues_[num_thread]
+                        .data_->get_pending_queue_length(
+                            std::memory_order_relaxed) != 0)
+            {
+                return true;
+            }
+            return this->queues_[num_thread].data_->get_pending_queue_length(
+                       std::memory_order_relaxed) != 0;
+        }
+
+        // Find the queue holding the work item with the earliest deadline,
+        // this returns the given worker if no other queue has work with a
+        // deadline.
+        std::size_t find_most_urgent_queue(std::size_t num_thread) const
+        {
+            std::size_t result = num_thread;
+            deadline_type earliest = deadline_type::max();
+
+            for (std::size_t i = 0; i != this->num_queues_; ++i)
+            {
+                if (i == num_thread)
+                {
+                    continue;
+                }
+
+                deadline_type const deadline =
+                    this->queues_[i].data_->get_work_items()
+                        .get_earliest_deadline();
+                if (deadline < earliest)
+                {
+                    earliest = deadline;
+                    result = i;
+                }
+            }
+            return result;
+        }
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/local/config/warnings_suffix.hpp>
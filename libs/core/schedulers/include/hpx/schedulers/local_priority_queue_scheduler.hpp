@@ -207,6 +207,74 @@ namespace hpx { namespace threads { namespace policies {
         }
 #endif
 
+        std::int64_t get_thread_cache_hits(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    count += high_priority_queues_[i]
+                                 .data_->get_thread_cache_hits(reset);
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += queues_[i].data_->get_thread_cache_hits(reset);
+                }
+                count += low_priority_queue_.get_thread_cache_hits(reset);
+
+                return count;
+            }
+
+            count += queues_[num_thread].data_->get_thread_cache_hits(reset);
+
+            if (num_thread < num_high_priority_queues_)
+            {
+                count += high_priority_queues_[num_thread]
+                             .data_->get_thread_cache_hits(reset);
+            }
+            if (num_thread == num_queues_ - 1)
+            {
+                count += low_priority_queue_.get_thread_cache_hits(reset);
+            }
+            return count;
+        }
+
+        std::int64_t get_thread_cache_misses(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    count += high_priority_queues_[i]
+                                 .data_->get_thread_cache_misses(reset);
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += queues_[i].data_->get_thread_cache_misses(reset);
+                }
+                count += low_priority_queue_.get_thread_cache_misses(reset);
+
+                return count;
+            }
+
+            count += queues_[num_thread].data_->get_thread_cache_misses(reset);
+
+            if (num_thread < num_high_priority_queues_)
+            {
+                count += high_priority_queues_[num_thread]
+                             .data_->get_thread_cache_misses(reset);
+            }
+            if (num_thread == num_queues_ - 1)
+            {
+                count += low_priority_queue_.get_thread_cache_misses(reset);
+            }
+            return count;
+        }
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(
             std::size_t num_thread, bool reset) override
@@ -593,6 +661,99 @@ namespace hpx { namespace threads { namespace policies {
                 ;
         }
 
+        // create count new threads at once, staged normal priority threads
+        // targeting the same queue are handed to that queue in one go
+        void create_threads_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            if (count == 0)
+                return;
+
+            // Threads without a hint are distributed over the queues in
+            // contiguous blocks of (roughly) equal size instead of strictly
+            // round-robin, which keeps neighboring work items together.
+            std::size_t const block_size =
+                (count + num_queues_ - 1) / num_queues_;
+            std::size_t const first_queue =
+                curr_queue_.fetch_add((count + block_size - 1) / block_size);
+
+            std::size_t num_unhinted = 0;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+                if (!is_bulk_staged(d))
+                    continue;
+
+                std::size_t num_thread =
+                    d.schedulehint.mode == thread_schedule_hint_mode::thread ?
+                    d.schedulehint.hint :
+                    std::size_t(-1);
+
+                if (std::size_t(-1) == num_thread)
+                {
+                    num_thread =
+                        (first_queue + num_unhinted++ / block_size) %
+                        num_queues_;
+                }
+                else if (num_thread >= num_queues_)
+                {
+                    num_thread %= num_queues_;
+                }
+
+                d.schedulehint.mode = thread_schedule_hint_mode::thread;
+                d.schedulehint.hint = static_cast<std::int16_t>(num_thread);
+            }
+
+            std::size_t i = 0;
+            while (i != count)
+            {
+                if (!is_bulk_staged(data[i]))
+                {
+                    thread_id_ref_type id = invalid_thread_id;
+                    create_thread(data[i], data[i].run_now ? &id : nullptr, ec);
+                    if (ec)
+                        return;
+
+                    ++i;
+                    continue;
+                }
+
+                // find all following threads targeting the same queue
+                std::int16_t const hint = data[i].schedulehint.hint;
+                std::size_t j = i + 1;
+                while (j != count && is_bulk_staged(data[j]) &&
+                    data[j].schedulehint.hint == hint)
+                {
+                    ++j;
+                }
+
+                std::unique_lock<pu_mutex_type> l;
+                std::size_t num_thread =
+                    select_active_pu(l, static_cast<std::size_t>(hint));
+
+                for (std::size_t k = i; k != j; ++k)
+                {
+                    data[k].schedulehint.hint =
+                        static_cast<std::int16_t>(num_thread);
+                }
+
+                HPX_ASSERT(num_thread < num_queues_);
+                queues_[num_thread].data_->create_threads_bulk(
+                    data + i, j - i, ec);
+
+                LTM_(debug).format(
+                    "local_priority_queue_scheduler::create_threads_bulk "
+                    "normal priority queue: pool({}), scheduler({}), "
+                    "worker_thread({}), count({})",
+                    *this->get_parent_pool(), *this, num_thread, j - i);
+
+                if (ec)
+                    return;
+
+                i = j;
+            }
+        }
+
         /// Return the next thread to be executed, return false if none is
         /// available
         bool get_next_thread(std::size_t num_thread, bool running,
@@ -639,30 +800,29 @@ namespace hpx { namespace threads { namespace policies {
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
+                bool const steal_half_enabled =
+                    has_scheduler_mode(policies::steal_half);
 
-                    if (idx < num_high_priority_queues_ &&
-                        num_thread < num_high_priority_queues_)
-                    {
-                        thread_queue_type* q = high_priority_queues_[idx].data_;
-                        if (q->get_next_thread(thrd, running, true))
+                bool const stolen =
+                    for_each_victim(num_thread, [&](std::size_t idx) {
+                        HPX_ASSERT(idx != num_thread);
+
+                        if (idx < num_high_priority_queues_ &&
+                            num_thread < num_high_priority_queues_ &&
+                            steal_pending(high_priority_queues_[idx].data_,
+                                this_high_priority_queue, thrd, running,
+                                steal_half_enabled))
                         {
-                            q->increment_num_stolen_from_pending();
-                            this_high_priority_queue
-                                ->increment_num_stolen_to_pending();
                             return true;
                         }
-                    }
 
-                    if (queues_[idx].data_->get_next_thread(
-                            thrd, running, true))
-                    {
-                        queues_[idx].data_->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
-                        return true;
-                    }
+                        return steal_pending(queues_[idx].data_, this_queue,
+                            thrd, running, steal_half_enabled);
+                    });
+
+                if (stolen)
+                {
+                    return true;
                 }
             }
 
@@ -1135,38 +1295,45 @@ namespace hpx { namespace threads { namespace policies {
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
+                bool const stolen =
+                    for_each_victim(num_thread, [&](std::size_t idx) {
+                        HPX_ASSERT(idx != num_thread);
 
-                    if (idx < num_high_priority_queues_ &&
-                        num_thread < num_high_priority_queues_)
-                    {
-                        thread_queue_type* q = high_priority_queues_[idx].data_;
-                        result = this_high_priority_queue->wait_or_add_new(
-                                     true, added, q) &&
+                        if (idx < num_high_priority_queues_ &&
+                            num_thread < num_high_priority_queues_)
+                        {
+                            thread_queue_type* q =
+                                high_priority_queues_[idx].data_;
+                            result = this_high_priority_queue->wait_or_add_new(
+                                         true, added, q) &&
+                                result;
+
+                            if (0 != added)
+                            {
+                                q->increment_num_stolen_from_staged(added);
+                                this_high_priority_queue
+                                    ->increment_num_stolen_to_staged(added);
+                                return true;
+                            }
+                        }
+
+                        thread_queue_type* q = queues_[idx].data_;
+                        result =
+                            this_queue->wait_or_add_new(true, added, q) &&
                             result;
 
                         if (0 != added)
                         {
                             q->increment_num_stolen_from_staged(added);
-                            this_high_priority_queue
-                                ->increment_num_stolen_to_staged(added);
-                            return result;
+                            this_queue->increment_num_stolen_to_staged(added);
+                            return true;
                         }
-                    }
-
-                    result = this_queue->wait_or_add_new(
-                                 true, added, queues_[idx].data_) &&
-                        result;
+                        return false;
+                    });
 
-                    if (0 != added)
-                    {
-                        queues_[idx].data_->increment_num_stolen_from_staged(
-                            added);
-                        this_queue->increment_num_stolen_to_staged(added);
-                        return result;
-                    }
+                if (stolen)
+                {
+                    return result;
                 }
             }
 
@@ -1250,26 +1417,37 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_threads = num_queues_;
             auto const& topo = create_topology();
 
-            // get NUMA domain masks of all queues...
+            // get NUMA domain, core, and cache masks of all queues...
             std::vector<mask_type> numa_masks(num_threads);
             std::vector<mask_type> core_masks(num_threads);
+            std::vector<mask_type> l2_masks(num_threads);
+            std::vector<mask_type> l3_masks(num_threads);
             for (std::size_t i = 0; i != num_threads; ++i)
             {
                 std::size_t num_pu = affinity_data_.get_pu_num(i);
                 numa_masks[i] = topo.get_numa_node_affinity_mask(num_pu);
                 core_masks[i] = topo.get_core_affinity_mask(num_pu);
+                l2_masks[i] = topo.get_cache_affinity_mask(num_pu, 2);
+                l3_masks[i] = topo.get_cache_affinity_mask(num_pu, 3);
             }
 
             // iterate over the number of threads again to determine where to
             // steal from
             std::ptrdiff_t radius =
                 std::lround(static_cast<double>(num_threads) / 2.0);
-            victim_threads_[num_thread].data_.reserve(num_threads);
+
+            victim_data& victims = victim_threads_[num_thread].data_;
+            victims.victims_.clear();
+            victims.victims_.reserve(num_threads);
+            victims.tiers_.clear();
+            victims.seed_ = static_cast<std::uint32_t>(num_thread + 1);
 
             std::size_t num_pu = affinity_data_.get_pu_num(num_thread);
             mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
             mask_cref_type numa_mask = numa_masks[num_thread];
             mask_cref_type core_mask = core_masks[num_thread];
+            mask_cref_type l2_mask = l2_masks[num_thread];
+            mask_cref_type l3_mask = l3_masks[num_thread];
 
             // we allow the thread on the boundary of the NUMA domain to steal
             mask_type first_mask = mask_type();
@@ -1281,6 +1459,8 @@ namespace hpx { namespace threads { namespace policies {
             else
                 first_mask = pu_mask;
 
+            // Every call adds one tier of victims which are equally close to
+            // this thread.
             auto iterate =
                 [&](hpx::util::function_nonser<bool(std::size_t)> f) {
                     // check our neighbors in a radial fashion (left and right
@@ -1296,14 +1476,14 @@ namespace hpx { namespace threads { namespace policies {
 
                         if (f(std::size_t(left)))
                         {
-                            victim_threads_[num_thread].data_.push_back(
+                            victims.victims_.push_back(
                                 static_cast<std::size_t>(left));
                         }
 
                         std::size_t right = (num_thread + i) % num_threads;
                         if (f(right))
                         {
-                            victim_threads_[num_thread].data_.push_back(right);
+                            victims.victims_.push_back(right);
                         }
                     }
                     if ((num_threads % 2) == 0)
@@ -1311,20 +1491,47 @@ namespace hpx { namespace threads { namespace policies {
                         std::size_t right = (num_thread + i) % num_threads;
                         if (f(right))
                         {
-                            victim_threads_[num_thread].data_.push_back(right);
+                            victims.victims_.push_back(right);
                         }
                     }
+                    victims.tiers_.push_back(victims.victims_.size());
                 };
 
+            auto shares_core = [&](std::size_t other_num_thread) {
+                return any(core_mask & core_masks[other_num_thread]);
+            };
+            auto shares_l2 = [&](std::size_t other_num_thread) {
+                return shares_core(other_num_thread) ||
+                    any(l2_mask & l2_masks[other_num_thread]);
+            };
+            auto shares_l3 = [&](std::size_t other_num_thread) {
+                return shares_l2(other_num_thread) ||
+                    any(l3_mask & l3_masks[other_num_thread]);
+            };
+            auto shares_numa = [&](std::size_t other_num_thread) {
+                return shares_l3(other_num_thread) ||
+                    any(numa_mask & numa_masks[other_num_thread]);
+            };
+
             // check for threads which share the same core...
+            iterate(shares_core);
+
+            // check for threads which share the same L2 cache...
             iterate([&](std::size_t other_num_thread) {
-                return any(core_mask & core_masks[other_num_thread]);
+                return !shares_core(other_num_thread) &&
+                    shares_l2(other_num_thread);
+            });
+
+            // check for threads which share the same L3 cache...
+            iterate([&](std::size_t other_num_thread) {
+                return !shares_l2(other_num_thread) &&
+                    shares_l3(other_num_thread);
             });
 
             // check for threads which share the same NUMA domain...
             iterate([&](std::size_t other_num_thread) {
-                return !any(core_mask & core_masks[other_num_thread]) &&
-                    any(numa_mask & numa_masks[other_num_thread]);
+                return !shares_l3(other_num_thread) &&
+                    shares_numa(other_num_thread);
             });
 
             // check for the rest and if we are NUMA aware
@@ -1332,7 +1539,7 @@ namespace hpx { namespace threads { namespace policies {
                 any(first_mask & pu_mask))
             {
                 iterate([&](std::size_t other_num_thread) {
-                    return !any(numa_mask & numa_masks[other_num_thread]);
+                    return !shares_numa(other_num_thread);
                 });
             }
         }
@@ -1369,7 +1576,117 @@ namespace hpx { namespace threads { namespace policies {
             curr_queue_.store(0, std::memory_order_release);
         }
 
+        /// Return the queues the given OS thread steals from, grouped into
+        /// tiers of victims which are equally close to it (closest first).
+        std::vector<std::vector<std::size_t>> get_victim_tiers(
+            std::size_t num_thread) const
+        {
+            HPX_ASSERT(num_thread < num_queues_);
+
+            victim_data const& data = victim_threads_[num_thread].data_;
+
+            std::vector<std::vector<std::size_t>> tiers;
+            tiers.reserve(data.tiers_.size());
+
+            std::size_t begin = 0;
+            for (std::size_t end : data.tiers_)
+            {
+                tiers.emplace_back(data.victims_.begin() + begin,
+                    data.victims_.begin() + end);
+                begin = end;
+            }
+            return tiers;
+        }
+
     protected:
+        // The queues to steal from for one OS thread, ordered by their
+        // distance in the hardware topology. Each tier lists the victims which
+        // are equally close to the OS thread, tiers_ holds the end index of
+        // each tier in victims_.
+        struct victim_data
+        {
+            std::vector<std::size_t> victims_;
+            std::vector<std::size_t> tiers_;
+            std::uint32_t seed_ = 1;
+        };
+
+        // Invoke f for the victims of the given OS thread until it returns
+        // true. If randomized stealing is enabled, each tier is visited
+        // starting at a random victim.
+        template <typename F>
+        bool for_each_victim(std::size_t num_thread, F&& f)
+        {
+            victim_data& data = victim_threads_[num_thread].data_;
+            if (!has_scheduler_mode(policies::steal_randomized_victims))
+            {
+                for (std::size_t idx : data.victims_)
+                {
+                    if (f(idx))
+                        return true;
+                }
+                return false;
+            }
+
+            std::size_t begin = 0;
+            for (std::size_t end : data.tiers_)
+            {
+                std::size_t const size = end - begin;
+                if (size != 0)
+                {
+                    // xorshift32
+                    std::uint32_t x = data.seed_;
+                    x ^= x << 13;
+                    x ^= x >> 17;
+                    x ^= x << 5;
+                    data.seed_ = x;
+
+                    std::size_t const offset = x % size;
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        if (f(data.victims_[begin + (offset + i) % size]))
+                            return true;
+                    }
+                }
+                begin = end;
+            }
+            return false;
+        }
+
+        // Steal one pending thread from the victim queue. If steal_half is
+        // set, additionally move half of the remaining pending threads of the
+        // victim to the thief queue.
+        static bool steal_pending(thread_queue_type* victim,
+            thread_queue_type* thief, threads::thread_id_ref_type& thrd,
+            bool running, bool steal_half)
+        {
+            if (!victim->get_next_thread(thrd, running, true))
+                return false;
+
+            std::int64_t stolen = 1;
+            if (steal_half)
+            {
+                stolen += thief->steal_half_work_items_from(victim);
+            }
+
+            victim->increment_num_stolen_from_pending(
+                static_cast<std::size_t>(stolen));
+            thief->increment_num_stolen_to_pending(
+                static_cast<std::size_t>(stolen));
+            return true;
+        }
+
+        // threads which end up as staged tasks in one of the normal priority
+        // queues can be created in bulk
+        static bool is_bulk_staged(thread_init_data const& data) noexcept
+        {
+            return !data.run_now &&
+                data.initial_state == thread_schedule_state::pending &&
+                data.priority != thread_priority::high_recursive &&
+                data.priority != thread_priority::high &&
+                data.priority != thread_priority::boost &&
+                data.priority != thread_priority::low;
+        }
+
         std::atomic<std::size_t> curr_queue_;
 
         detail::affinity_data const& affinity_data_;
@@ -1382,8 +1699,7 @@ namespace hpx { namespace threads { namespace policies {
         std::vector<util::cache_line_data<thread_queue_type*>> queues_;
         std::vector<util::cache_line_data<thread_queue_type*>>
             high_priority_queues_;
-        std::vector<util::cache_line_data<std::vector<std::size_t>>>
-            victim_threads_;
+        std::vector<util::cache_line_data<victim_data>> victim_threads_;
     };
 }}}    // namespace hpx::threads::policies
 
@@ -157,6 +157,36 @@ namespace hpx { namespace threads { namespace policies {
         }
 #endif
 
+        std::int64_t get_thread_cache_hits(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t hits = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    hits += queues_[i]->get_thread_cache_hits(reset);
+                return hits;
+            }
+
+            hits += queues_[num_thread]->get_thread_cache_hits(reset);
+            return hits;
+        }
+
+        std::int64_t get_thread_cache_misses(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t misses = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    misses += queues_[i]->get_thread_cache_misses(reset);
+                return misses;
+            }
+
+            misses += queues_[num_thread]->get_thread_cache_misses(reset);
+            return misses;
+        }
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(
             std::size_t num_thread, bool reset) override
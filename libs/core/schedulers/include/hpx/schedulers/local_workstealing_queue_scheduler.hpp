@@ -0,0 +1,113 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <hpx/local/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_workstealing_queue_scheduler maintains exactly one
+    /// Chase-Lev work-stealing deque of work items (threads) per OS thread.
+    /// The owning OS thread pushes and pops work at the bottom of its deque
+    /// (LIFO) without any read-modify-write operations in the common case,
+    /// while other OS threads steal the oldest work items from the top of
+    /// the deque. Work which is scheduled from outside of the owning OS
+    /// thread is pushed through a separate multi-producer queue.
+    ///
+    /// Threads which are created without an explicit scheduling hint by one
+    /// of the OS threads of this scheduler are placed on that OS thread's own
+    /// deque (instead of being distributed round-robin).
+    ///
+    /// Additionally it maintains separate queues for high and low priority
+    /// threads in the same way as the local_priority_queue_scheduler.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_chase_lev,
+        typename StagedQueuing = lockfree_chase_lev,
+        typename TerminatedQueuing =
+            default_local_priority_queue_scheduler_terminated_queue>
+    class HPX_LOCAL_EXPORT local_workstealing_queue_scheduler
+      : public local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>
+    {
+    public:
+        using base_type = local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+        local_workstealing_queue_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+        {
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "local_workstealing_queue_scheduler";
+        }
+
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            if (data.schedulehint.mode == thread_schedule_hint_mode::none)
+            {
+                apply_local_hint(data.schedulehint);
+            }
+            base_type::create_thread(data, id, ec);
+        }
+
+        /// Schedule the passed thread
+        void schedule_thread(threads::thread_id_ref_type thrd,
+            threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false,
+            thread_priority priority = thread_priority::normal) override
+        {
+            if (schedulehint.mode == thread_schedule_hint_mode::none)
+            {
+                apply_local_hint(schedulehint);
+            }
+            base_type::schedule_thread(
+                HPX_MOVE(thrd), schedulehint, allow_fallback, priority);
+        }
+
+    private:
+        // If the calling OS thread is one of our own worker threads, direct
+        // the work to that worker's queue so that it is pushed to the owning
+        // end of the deque.
+        void apply_local_hint(thread_schedule_hint& schedulehint) const
+        {
+            threads::detail::thread_nums const nums =
+                threads::detail::get_thread_nums_tss();
+            if (nums.local_thread_num < this->num_queues_ &&
+                nums.thread_pool_num ==
+                    this->get_parent_pool()->get_pool_index())
+            {
+                schedulehint = thread_schedule_hint(
+                    static_cast<std::int16_t>(nums.local_thread_num));
+            }
+        }
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/local/config/warnings_suffix.hpp>
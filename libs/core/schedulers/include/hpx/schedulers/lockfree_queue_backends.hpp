@@ -18,12 +18,16 @@
 #endif
 
 #include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
+#include <hpx/concurrency/chase_lev_deque.hpp>
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <utility>
 
 namespace hpx { namespace threads { namespace policies {
@@ -74,6 +78,17 @@ namespace hpx { namespace threads { namespace policies {
 #endif
         }
 
+        bool push_bulk(value_type const* first, std::size_t count,
+            bool other_end = false)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (!push(first[i], other_end))
+                    return false;
+            }
+            return true;
+        }
+
         bool pop(reference val, bool /* steal */ = true)
         {
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
@@ -130,6 +145,12 @@ namespace hpx { namespace threads { namespace policies {
             return queue_.enqueue(HPX_MOVE(val));
         }
 
+        bool push_bulk(value_type const* first, std::size_t count,
+            bool /*other_end*/ = false)
+        {
+            return queue_.enqueue_bulk(first, count);
+        }
+
         bool pop(reference val, bool /* steal */ = true)
         {
             return queue_.try_dequeue(val);
@@ -153,6 +174,117 @@ namespace hpx { namespace threads { namespace policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Chase-Lev work-stealing deque: LIFO for the owning worker, FIFO for
+    // thieves.
+    //
+    // The owner of the queue is the worker thread whose local thread number
+    // matches num_thread. It is determined the first time that worker pops
+    // from the queue without stealing. The owner pushes and pops at the
+    // bottom of the deque, everybody else steals from its top. Elements
+    // pushed by any other thread go through a multi-producer inbox, which is
+    // drained after the deque.
+    template <typename T>
+    struct lockfree_chase_lev_backend
+    {
+        using container_type = hpx::concurrency::chase_lev_deque<T>;
+        using inbox_type = hpx::concurrency::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        lockfree_chase_lev_backend(size_type initial_size = 0,
+            size_type num_thread = size_type(-1))
+          : queue_(std::size_t(initial_size))
+          , inbox_(std::size_t(initial_size))
+          , num_thread_(num_thread)
+          , owner_()
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            if (!other_end && is_owner())
+            {
+                queue_.push_bottom(val);
+                return true;
+            }
+            return inbox_.enqueue(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)
+        {
+            return push(const_reference(val), other_end);
+        }
+
+        bool push_bulk(value_type const* first, std::size_t count,
+            bool other_end = false)
+        {
+            if (!other_end && is_owner())
+            {
+                queue_.push_bottom(first, count);
+                return true;
+            }
+            return inbox_.enqueue_bulk(first, count);
+        }
+
+        bool pop(reference val, bool steal = true)
+        {
+            if (!steal && (is_owner() || try_claim_ownership()))
+            {
+                if (queue_.pop_bottom(val))
+                    return true;
+            }
+            else if (queue_.steal(val))
+            {
+                return true;
+            }
+            return inbox_.try_dequeue(val);
+        }
+
+        bool empty()
+        {
+            return queue_.empty() && inbox_.size_approx() == 0;
+        }
+
+    private:
+        bool is_owner() const noexcept
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        bool try_claim_ownership() noexcept
+        {
+            if (num_thread_ == size_type(-1) ||
+                hpx::get_local_worker_thread_num() != num_thread_)
+            {
+                return false;
+            }
+
+            std::thread::id expected;
+            return owner_.compare_exchange_strong(expected,
+                std::this_thread::get_id(), std::memory_order_relaxed);
+        }
+
+        container_type queue_;
+        inbox_type inbox_;
+        size_type const num_thread_;
+        std::atomic<std::thread::id> owner_;
+    };
+
+    struct lockfree_chase_lev
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = lockfree_chase_lev_backend<T>;
+        };
+    };
+
     // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     struct lockfree_lifo;
@@ -190,6 +322,17 @@ namespace hpx { namespace threads { namespace policies {
             return queue_.push_left(HPX_MOVE(val));
         }
 
+        bool push_bulk(value_type const* first, std::size_t count,
+            bool other_end = false)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (!push(first[i], other_end))
+                    return false;
+            }
+            return true;
+        }
+
         bool pop(reference val, bool /* steal */ = true)
         {
             return queue_.pop_left(val);
@@ -247,6 +390,17 @@ namespace hpx { namespace threads { namespace policies {
             return queue_.push_left(HPX_MOVE(val));
         }
 
+        bool push_bulk(value_type const* first, std::size_t count,
+            bool other_end = false)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (!push(first[i], other_end))
+                    return false;
+            }
+            return true;
+        }
+
         bool pop(reference val, bool steal = true)
         {
             if (steal)
@@ -309,6 +463,17 @@ namespace hpx { namespace threads { namespace policies {
             return queue_.push_left(val);
         }
 
+        bool push_bulk(value_type const* first, std::size_t count,
+            bool other_end = false)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (!push(first[i], other_end))
+                    return false;
+            }
+            return true;
+        }
+
         bool pop(reference val, bool steal = true)
         {
             if (steal)
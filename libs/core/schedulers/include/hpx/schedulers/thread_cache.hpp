@@ -0,0 +1,165 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A cache of recycled thread objects (and their stacks) of a single
+    /// stack size.
+    ///
+    /// The cache is owned by the worker thread which services the enclosing
+    /// thread_queue. The owner keeps recycled thread objects on a private
+    /// LIFO list which is accessed without any synchronization, so that the
+    /// most recently used (and most likely still cached) stacks are reused
+    /// first. All other threads hand thread objects back through a bounded
+    /// lock-free list which is consumed once the private list runs empty.
+    /// Objects which do not fit into the bounded list are not cached at all,
+    /// which keeps foreign threads from growing the cache without limit.
+    ///
+    /// The RemoteQueuing policy has the same form as the queuing policies of
+    /// the thread_queue.
+    template <typename RemoteQueuing>
+    class thread_cache
+    {
+        using local_list_type = std::vector<thread_data*,
+            util::internal_allocator<thread_data*>>;
+
+        using remote_list_type =
+            typename RemoteQueuing::template apply<thread_data*>::type;
+
+    public:
+        explicit thread_cache(std::int64_t max_remote_count = 1024)
+          : owner_(std::thread::id())
+          , max_remote_count_(max_remote_count)
+          , remote_(128)
+          , remote_count_()
+          , hits_(0)
+          , misses_(0)
+        {
+            remote_count_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        thread_cache(thread_cache const&) = delete;
+        thread_cache& operator=(thread_cache const&) = delete;
+
+        ~thread_cache()
+        {
+            for (thread_data* p : local_)
+            {
+                p->destroy();
+            }
+
+            thread_data* p = nullptr;
+            while (remote_.pop(p))
+            {
+                p->destroy();
+            }
+        }
+
+        /// Make the calling OS thread the owner of this cache. This must be
+        /// called before the owner recycles any thread object.
+        void set_owner()
+        {
+            owner_.store(std::this_thread::get_id(), std::memory_order_release);
+        }
+
+        void reserve(std::size_t count)
+        {
+            HPX_ASSERT(is_owner());
+            local_.reserve(count);
+        }
+
+        /// Take a thread object out of the cache. Returns nullptr if the
+        /// cache is empty.
+        thread_data* get()
+        {
+            thread_data* p = nullptr;
+            if (is_owner() && !local_.empty())
+            {
+                p = local_.back();
+                local_.pop_back();
+            }
+            else if (remote_.pop(p))
+            {
+                remote_count_.data_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                misses_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return p;
+        }
+
+        /// Return a thread object to the cache. Returns false if the object
+        /// was not accepted, in which case the caller has to destroy it.
+        bool put(thread_data* p)
+        {
+            if (is_owner())
+            {
+                local_.push_back(p);
+                return true;
+            }
+
+            if (remote_count_.data_.fetch_add(1, std::memory_order_relaxed) >=
+                max_remote_count_)
+            {
+                remote_count_.data_.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (!remote_.push(p))
+            {
+                remote_count_.data_.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        std::int64_t get_hits(bool reset)
+        {
+            return util::get_and_reset_value(hits_, reset);
+        }
+
+        std::int64_t get_misses(bool reset)
+        {
+            return util::get_and_reset_value(misses_, reset);
+        }
+
+    private:
+        bool is_owner() const
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        std::atomic<std::thread::id> owner_;
+        local_list_type local_;
+
+        std::int64_t const max_remote_count_;
+        remote_list_type remote_;
+        util::cache_line_data<std::atomic<std::int64_t>> remote_count_;
+
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+    };
+}}}    // namespace hpx::threads::policies
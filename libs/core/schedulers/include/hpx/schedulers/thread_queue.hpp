@@ -19,6 +19,7 @@
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
+#include <hpx/schedulers/thread_cache.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -32,11 +33,13 @@
 #include <hpx/timing/tick_counter.hpp>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -66,6 +69,8 @@ namespace hpx { namespace threads { namespace policies {
     //
     //     bool push(const_reference val);
     //
+    //     bool push_bulk(value_type const* first, std::size_t count);
+    //
     //     bool pop(reference val, bool steal = true);
     //
     //     bool empty();
@@ -92,8 +97,7 @@ namespace hpx { namespace threads { namespace policies {
             std::hash<thread_id_type>, std::equal_to<thread_id_type>,
             util::internal_allocator<thread_id_type>>;
 
-        using thread_heap_type = std::vector<thread_id_type,
-            util::internal_allocator<thread_id_type>>;
+        using thread_cache_type = thread_cache<TerminatedQueuing>;
 
         struct task_description
         {
@@ -134,29 +138,9 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t const stacksize =
                 data.scheduler_base->get_stack_size(data.stacksize);
 
-            thread_heap_type* heap = nullptr;
-
-            if (stacksize == parameters_.small_stacksize_)
-            {
-                heap = &thread_heap_small_;
-            }
-            else if (stacksize == parameters_.medium_stacksize_)
-            {
-                heap = &thread_heap_medium_;
-            }
-            else if (stacksize == parameters_.large_stacksize_)
-            {
-                heap = &thread_heap_large_;
-            }
-            else if (stacksize == parameters_.huge_stacksize_)
-            {
-                heap = &thread_heap_huge_;
-            }
-            else if (stacksize == parameters_.nostack_stacksize_)
-            {
-                heap = &thread_heap_nostack_;
-            }
-            HPX_ASSERT(heap);
+            thread_cache_type* cache = get_thread_cache(stacksize);
+            HPX_ASSERT(cache);
+            HPX_UNUSED(cache);
 
             if (data.initial_state ==
                     thread_schedule_state::pending_do_not_schedule ||
@@ -169,12 +153,11 @@ namespace hpx { namespace threads { namespace policies {
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
 
             // Check for an unused thread object.
-            if (!heap->empty())
+            if (threads::thread_data* recycled = cache->get())
             {
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->back();
-                heap->pop_back();
-                get_thread_id_data(thrd)->rebind(data);
+                thrd = thread_id_ref_type(recycled);
+                recycled->rebind(data);
             }
             else
 #endif
@@ -323,35 +306,49 @@ namespace hpx { namespace threads { namespace policies {
             return addednew != 0;
         }
 
-        void recycle_thread(thread_id_type thrd)
+        thread_cache_type* get_thread_cache(std::ptrdiff_t stacksize)
         {
-            std::ptrdiff_t stacksize =
-                get_thread_id_data(thrd)->get_stack_size();
-
             if (stacksize == parameters_.small_stacksize_)
             {
-                thread_heap_small_.push_back(thrd);
+                return &thread_cache_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                thread_heap_medium_.push_back(thrd);
+                return &thread_cache_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                thread_heap_large_.push_back(thrd);
+                return &thread_cache_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                thread_heap_huge_.push_back(thrd);
+                return &thread_cache_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                thread_heap_nostack_.push_back(thrd);
+                return &thread_cache_nostack_;
             }
-            else
+            return nullptr;
+        }
+
+        void recycle_thread(thread_id_type thrd)
+        {
+            threads::thread_data* p = get_thread_id_data(thrd);
+            std::ptrdiff_t stacksize = p->get_stack_size();
+
+            thread_cache_type* cache = get_thread_cache(stacksize);
+            if (cache == nullptr)
             {
                 HPX_ASSERT_MSG(
                     false, util::format("Invalid stack size {1}", stacksize));
+                return;
+            }
+
+            // Threads which are recycled by a thread other than the owner of
+            // the cache may be rejected, those are destroyed right away.
+            if (!cache->put(p))
+            {
+                deallocate(p);
             }
         }
 
@@ -359,10 +356,17 @@ namespace hpx { namespace threads { namespace policies {
         /// This function makes sure all threads which are marked for deletion
         /// (state is terminated) are properly destroyed.
         ///
+        /// The terminated threads are removed from the thread map while
+        /// holding the lock, they are recycled in batches with the lock
+        /// released in between.
+        ///
         /// This returns 'true' if there are no more terminated threads waiting
         /// to be deleted.
-        bool cleanup_terminated_locked(bool delete_all = false)
+        bool cleanup_terminated_locked(
+            std::unique_lock<mutex_type>& lk, bool delete_all = false)
         {
+            HPX_ASSERT(lk.owns_lock());
+
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             util::tick_counter tc(cleanup_terminated_time_);
 #endif
@@ -370,55 +374,59 @@ namespace hpx { namespace threads { namespace policies {
             if (terminated_items_count_.load(std::memory_order_acquire) == 0)
                 return true;
 
-            if (delete_all)
+            // delete only this many threads
+            std::int64_t delete_count =
+                (std::numeric_limits<std::int64_t>::max)();
+            if (!delete_all)
             {
-                // delete all threads
-                thread_data* todelete;
-                while (terminated_items_.pop(todelete))
-                {
-                    thread_id_type tid(todelete);
-                    --terminated_items_count_;
-
-                    // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(tid) != thread_map_.end());
-
-                    if (thread_map_.erase(tid) != 0)
-                    {
-                        recycle_thread(tid);
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
-                }
-            }
-            else
-            {
-                // delete only this many threads
-                std::int64_t delete_count = (std::min)(
+                delete_count = (std::min)(
                     static_cast<std::int64_t>(terminated_items_count_ / 10),
                     static_cast<std::int64_t>(parameters_.max_delete_count_));
 
                 // delete at least this many threads
                 delete_count = (std::max)(delete_count,
                     static_cast<std::int64_t>(parameters_.min_delete_count_));
+            }
+
+            constexpr std::size_t max_batch_size = 64;
+            thread_data* batch[max_batch_size];
+
+            while (delete_count != 0)
+            {
+                std::size_t batch_size = 0;
 
                 thread_data* todelete;
-                while (delete_count && terminated_items_.pop(todelete))
+                while (delete_count != 0 && batch_size != max_batch_size &&
+                    terminated_items_.pop(todelete))
                 {
                     thread_id_type tid(todelete);
                     --terminated_items_count_;
 
-                    // this thread has to be in this map, except if it has changed
-                    // its priority, then it could be elsewhere
+                    // this thread has to be in this map, except if it has
+                    // changed its priority, then it could be elsewhere
                     HPX_ASSERT(thread_map_.find(tid) != thread_map_.end());
 
                     if (thread_map_.erase(tid) != 0)
                     {
-                        recycle_thread(tid);
+                        batch[batch_size++] = todelete;
                         --thread_map_count_;
                         HPX_ASSERT(thread_map_count_ >= 0);
                     }
                     --delete_count;
                 }
+
+                if (batch_size == 0)
+                {
+                    break;
+                }
+
+                // recycling may destroy the thread objects, don't hold the
+                // lock meanwhile
+                hpx::util::unlock_guard<std::unique_lock<mutex_type>> ul(lk);
+                for (std::size_t i = 0; i != batch_size; ++i)
+                {
+                    recycle_thread(thread_id_type(batch[i]));
+                }
             }
             return terminated_items_count_.load(std::memory_order_acquire) == 0;
         }
@@ -434,8 +442,8 @@ namespace hpx { namespace threads { namespace policies {
                 // do not lock mutex while deleting all threads, do it piece-wise
                 while (true)
                 {
-                    std::lock_guard<mutex_type> lk(mtx_);
-                    if (cleanup_terminated_locked(false))
+                    std::unique_lock<mutex_type> lk(mtx_);
+                    if (cleanup_terminated_locked(lk, false))
                     {
                         return true;
                     }
@@ -443,8 +451,8 @@ namespace hpx { namespace threads { namespace policies {
                 return false;
             }
 
-            std::lock_guard<mutex_type> lk(mtx_);
-            return cleanup_terminated_locked(false);
+            std::unique_lock<mutex_type> lk(mtx_);
+            return cleanup_terminated_locked(lk, false);
         }
 
         thread_queue(std::size_t queue_num = std::size_t(-1),
@@ -458,16 +466,16 @@ namespace hpx { namespace threads { namespace policies {
 #endif
           , terminated_items_(128)
           , terminated_items_count_(0)
-          , new_tasks_(128)
+          , new_tasks_(128, queue_num)
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
           , new_tasks_wait_(0)
           , new_tasks_wait_count_(0)
 #endif
-          , thread_heap_small_()
-          , thread_heap_medium_()
-          , thread_heap_large_()
-          , thread_heap_huge_()
-          , thread_heap_nostack_()
+          , thread_cache_small_(parameters.max_remote_cached_threads_)
+          , thread_cache_medium_(parameters.max_remote_cached_threads_)
+          , thread_cache_large_(parameters.max_remote_cached_threads_)
+          , thread_cache_huge_(parameters.max_remote_cached_threads_)
+          , thread_cache_nostack_(parameters.max_remote_cached_threads_)
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -490,22 +498,26 @@ namespace hpx { namespace threads { namespace policies {
             p->destroy();
         }
 
-        ~thread_queue()
-        {
-            for (auto t : thread_heap_small_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_medium_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_large_)
-                deallocate(get_thread_id_data(t));
+        ~thread_queue() = default;
 
-            for (auto t : thread_heap_huge_)
-                deallocate(get_thread_id_data(t));
+        // Return the number of thread objects which could (hits) or could not
+        // (misses) be taken from the caches of recycled threads
+        std::int64_t get_thread_cache_hits(bool reset)
+        {
+            return thread_cache_small_.get_hits(reset) +
+                thread_cache_medium_.get_hits(reset) +
+                thread_cache_large_.get_hits(reset) +
+                thread_cache_huge_.get_hits(reset) +
+                thread_cache_nostack_.get_hits(reset);
+        }
 
-            for (auto t : thread_heap_nostack_)
-                deallocate(get_thread_id_data(t));
+        std::int64_t get_thread_cache_misses(bool reset)
+        {
+            return thread_cache_small_.get_misses(reset) +
+                thread_cache_medium_.get_misses(reset) +
+                thread_cache_large_.get_misses(reset) +
+                thread_cache_huge_.get_misses(reset) +
+                thread_cache_nostack_.get_misses(reset);
         }
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
@@ -536,6 +548,13 @@ namespace hpx { namespace threads { namespace policies {
             return work_items_count_.data_.load(order);
         }
 
+        // This gives access to the pending queue itself, this is used by
+        // schedulers which need to inspect the queue's contents
+        work_items_type const& get_work_items() const noexcept
+        {
+            return work_items_;
+        }
+
         // This returns the current length of the staged queue
         std::int64_t get_staged_queue_length(
             std::memory_order order = std::memory_order_acquire) const
@@ -728,9 +747,9 @@ namespace hpx { namespace threads { namespace policies {
             // away (can't be scheduled).
             if (data.initial_state != thread_schedule_state::pending)
             {
-                HPX_THROW_EXCEPTION(bad_parameter,
-                    "thread_queue::create_thread",
+                HPX_THROWS_IF(ec, bad_parameter, "thread_queue::create_thread",
                     "staged tasks must have 'pending' as their initial state");
+                return;
             }
 
             // do not execute the work, but register a task description for
@@ -749,6 +768,62 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
+        // register task descriptions for the later creation of count threads
+        // at once, all of them must be staged and have 'pending' as their
+        // initial state. All work items are verified before the first one is
+        // registered, no work item is registered if any of them is invalid.
+        void create_threads_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+                if (d.run_now ||
+                    d.initial_state != thread_schedule_state::pending)
+                {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "thread_queue::create_threads_bulk",
+                        "staged tasks must have 'pending' as their initial "
+                        "state");
+                    return;
+                }
+
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = get_self_stacksize_enum();
+                }
+                HPX_ASSERT(d.stacksize != threads::thread_stacksize::current);
+            }
+
+            constexpr std::size_t batch_size = 64;
+            task_description* tds[batch_size];
+
+            while (count != 0)
+            {
+                std::size_t const n = (std::min)(count, batch_size);
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    tds[i] = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                    new (tds[i]) task_description{HPX_MOVE(data[i]),
+                        hpx::chrono::high_resolution_clock::now()};
+#else
+                    new (tds[i]) task_description{HPX_MOVE(data[i])};    //-V106
+#endif
+                }
+
+                // publish the whole batch with a single queue operation
+                new_tasks_count_.data_ += static_cast<std::int64_t>(n);
+                new_tasks_.push_bulk(tds, n);
+
+                data += n;
+                count -= n;
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description_ptr trd;
@@ -774,6 +849,38 @@ namespace hpx { namespace threads { namespace policies {
             }
         }
 
+        // steal half of the pending work items of the given queue, returns
+        // the number of work items moved to this queue
+        std::int64_t steal_half_work_items_from(thread_queue* src)
+        {
+            std::int64_t count =
+                src->work_items_count_.data_.load(std::memory_order_relaxed) /
+                2;
+
+            std::int64_t moved = 0;
+            thread_description_ptr trd;
+            while (moved != count && src->work_items_.pop(trd, true))
+            {
+                --src->work_items_count_.data_;
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                if (get_maintain_queue_wait_times_enabled())
+                {
+                    std::uint64_t now =
+                        hpx::chrono::high_resolution_clock::now();
+                    src->work_items_wait_ += now - trd->waittime;
+                    ++src->work_items_wait_count_;
+                    trd->waittime = now;
+                }
+#endif
+
+                ++work_items_count_.data_;
+                work_items_.push(trd);
+                ++moved;
+            }
+            return moved;
+        }
+
         void move_task_items_from(thread_queue* src, std::int64_t count)
         {
             task_description* task = nullptr;
@@ -1069,7 +1176,7 @@ namespace hpx { namespace threads { namespace policies {
                     // Before exiting each of the OS threads deletes the
                     // remaining terminated HPX threads
                     // REVIEW: Should we be doing this if we are stealing?
-                    bool canexit = cleanup_terminated_locked(true);
+                    bool canexit = cleanup_terminated_locked(lk, true);
                     if (!running && canexit)
                     {
                         // we don't have any registered work items anymore
@@ -1080,7 +1187,7 @@ namespace hpx { namespace threads { namespace policies {
                 }
                 else
                 {
-                    cleanup_terminated_locked();
+                    cleanup_terminated_locked(lk);
                     return false;
                 }
             }
@@ -1118,10 +1225,18 @@ namespace hpx { namespace threads { namespace policies {
         ///////////////////////////////////////////////////////////////////////
         void on_start_thread(std::size_t /* num_thread */)
         {
-            thread_heap_small_.reserve(parameters_.init_threads_count_);
-            thread_heap_medium_.reserve(parameters_.init_threads_count_);
-            thread_heap_large_.reserve(parameters_.init_threads_count_);
-            thread_heap_huge_.reserve(parameters_.init_threads_count_);
+            // The calling OS thread services this queue from now on, it
+            // takes ownership of the caches of recycled thread objects.
+            thread_cache_small_.set_owner();
+            thread_cache_medium_.set_owner();
+            thread_cache_large_.set_owner();
+            thread_cache_huge_.set_owner();
+            thread_cache_nostack_.set_owner();
+
+            thread_cache_small_.reserve(parameters_.init_threads_count_);
+            thread_cache_medium_.reserve(parameters_.init_threads_count_);
+            thread_cache_large_.reserve(parameters_.init_threads_count_);
+            thread_cache_huge_.reserve(parameters_.init_threads_count_);
 
             // Pre-allocate init_threads_count threads, with accompanying stack,
             // with the default stack size
@@ -1150,7 +1265,7 @@ namespace hpx { namespace threads { namespace policies {
                 p->init();
 
                 // Finally, store the thread for later use
-                thread_heap_small_.emplace_back(p);
+                thread_cache_small_.put(p);
             }
         }
         void on_stop_thread(std::size_t /* num_thread */) {}
@@ -1191,11 +1306,12 @@ namespace hpx { namespace threads { namespace policies {
         std::atomic<std::int64_t> new_tasks_wait_count_;
 #endif
 
-        thread_heap_type thread_heap_small_;
-        thread_heap_type thread_heap_medium_;
-        thread_heap_type thread_heap_large_;
-        thread_heap_type thread_heap_huge_;
-        thread_heap_type thread_heap_nostack_;
+        // caches of recycled thread objects, one per stack size
+        thread_cache_type thread_cache_small_;
+        thread_cache_type thread_cache_medium_;
+        thread_cache_type thread_cache_large_;
+        thread_cache_type thread_cache_huge_;
+        thread_cache_type thread_cache_nostack_;
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
@@ -0,0 +1,125 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the deadline scheduler runs pending threads in
+// earliest-deadline-first order.
+
+#include <hpx/executors/deadline_executor.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using deadline_type = hpx::threads::thread_init_data::deadline_type;
+
+// Threads created with an explicit deadline in thread_init_data
+void test_thread_init_data()
+{
+    std::vector<int> order;
+    deadline_type const now = std::chrono::steady_clock::now();
+
+    // The threads are created in reverse order of their deadlines. They
+    // can't run before this thread suspends as there is only one worker.
+    int const deadlines[] = {5, 4, 1, 3, 2};
+    for (int deadline : deadlines)
+    {
+        hpx::threads::thread_init_data data(
+            hpx::threads::make_thread_function_nullary(
+                [&order, deadline]() { order.push_back(deadline); }),
+            "deadline_scheduler", hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(0));
+        data.run_now = true;
+        data.deadline = now + std::chrono::seconds(deadline);
+
+        hpx::threads::register_thread(data);
+    }
+
+    // This thread does not have a deadline, it will run again only after all
+    // other threads have finished.
+    hpx::this_thread::suspend(hpx::threads::thread_schedule_state::pending);
+
+    HPX_TEST_EQ(order.size(), std::size_t(5));
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], static_cast<int>(i + 1));
+    }
+}
+
+// Threads launched through hpx::async with a deadline_executor are ordered
+// by their deadlines, threads created by them inherit the deadline.
+void test_deadline_executor()
+{
+    std::vector<int> order;
+    deadline_type const now = std::chrono::steady_clock::now();
+
+    std::vector<hpx::future<void>> futures;
+    int const deadlines[] = {5, 4, 1, 3, 2};
+    for (int deadline : deadlines)
+    {
+        hpx::execution::experimental::deadline_executor exec(
+            hpx::execution::parallel_executor(),
+            now + std::chrono::seconds(deadline));
+
+        futures.push_back(hpx::async(exec, [&order, deadline, now]() {
+            deadline_type const expected = now + std::chrono::seconds(deadline);
+            HPX_TEST(hpx::threads::get_thread_deadline(
+                         hpx::threads::get_self_id()) == expected);
+
+            order.push_back(deadline);
+
+            // threads created without an explicit deadline inherit it
+            deadline_type const inherited = hpx::async([]() {
+                return hpx::threads::get_thread_deadline(
+                    hpx::threads::get_self_id());
+            }).get();
+            HPX_TEST(inherited == expected);
+        }));
+    }
+
+    // the deadline of this thread is not changed by launching the work
+    HPX_TEST(hpx::threads::get_thread_deadline(hpx::threads::get_self_id()) ==
+        deadline_type::max());
+
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(order.size(), std::size_t(5));
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], static_cast<int>(i + 1));
+    }
+}
+
+int hpx_main()
+{
+    test_thread_init_data();
+    test_deadline_executor();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=1"};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool(
+            "default", hpx::resource::scheduling_policy::deadline);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
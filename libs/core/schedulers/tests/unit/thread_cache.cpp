@@ -0,0 +1,144 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that thread objects of short-lived tasks are recycled through the
+// caches of the thread queues.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/schedulers/thread_cache.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using thread_cache_type =
+    hpx::threads::policies::thread_cache<hpx::threads::policies::lockfree_fifo>;
+
+// The cache never touches the objects it holds, except when it is destroyed
+// while still holding some. Use distinct addresses which are never
+// dereferenced and drain the cache before destroying it.
+hpx::threads::thread_data* make_thread_object(char* storage, std::size_t i)
+{
+    return reinterpret_cast<hpx::threads::thread_data*>(storage + i);
+}
+
+// The thread object handed back by the cache is the one recycled last.
+void test_cache_reuse()
+{
+    thread_cache_type cache;
+    cache.set_owner();
+
+    char storage[10];
+    HPX_TEST(cache.get() == nullptr);
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        HPX_TEST(cache.put(make_thread_object(storage, i)));
+    }
+    for (std::size_t i = 10; i != 0; --i)
+    {
+        HPX_TEST(cache.get() == make_thread_object(storage, i - 1));
+    }
+    HPX_TEST(cache.get() == nullptr);
+
+    HPX_TEST_EQ(cache.get_hits(false), std::int64_t(10));
+    HPX_TEST_EQ(cache.get_misses(false), std::int64_t(2));
+}
+
+// Threads other than the owner may not grow the cache beyond its limit.
+void test_cache_limit()
+{
+    std::int64_t const max_remote_count = 4;
+    thread_cache_type cache(max_remote_count);
+    cache.set_owner();
+
+    char storage[10];
+    std::thread([&]() {
+        for (std::size_t i = 0; i != 10; ++i)
+        {
+            bool const accepted = cache.put(make_thread_object(storage, i));
+            HPX_TEST_EQ(accepted, std::int64_t(i) < max_remote_count);
+        }
+    }).join();
+
+    std::set<hpx::threads::thread_data*> returned;
+    while (hpx::threads::thread_data* p = cache.get())
+    {
+        returned.insert(p);
+    }
+    HPX_TEST_EQ(returned.size(), std::size_t(max_remote_count));
+
+    // the owner is not limited
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        HPX_TEST(cache.put(make_thread_object(storage, i)));
+    }
+    while (cache.get() != nullptr)
+    {
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_cache_reuse();
+    test_cache_limit();
+
+    auto const sched = hpx::threads::get_self_id_data()->get_scheduler_base();
+
+    // reset the counters
+    sched->get_thread_cache_hits(std::size_t(-1), true);
+    sched->get_thread_cache_misses(std::size_t(-1), true);
+
+    std::int64_t const num_tasks = 1000;
+    std::set<hpx::threads::thread_data*> thread_objects;
+    for (std::int64_t i = 0; i != num_tasks; ++i)
+    {
+        thread_objects.insert(
+            hpx::async([]() { return hpx::threads::get_self_id_data(); })
+                .get());
+    }
+
+    std::int64_t const hits =
+        sched->get_thread_cache_hits(std::size_t(-1), false);
+    std::int64_t const misses =
+        sched->get_thread_cache_misses(std::size_t(-1), false);
+
+    // ASAN disables the reuse of thread objects altogether
+#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
+    // every thread object is either taken from a cache or newly allocated
+    HPX_TEST_LTE(num_tasks, hits + misses);
+
+    // the tasks run one after another, most of them should be able to reuse
+    // the thread object of a previous task
+    HPX_TEST_LT(misses, hits);
+    HPX_TEST_LT(thread_objects.size(), std::size_t(num_tasks / 2));
+#else
+    HPX_UNUSED(hits);
+    HPX_UNUSED(misses);
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
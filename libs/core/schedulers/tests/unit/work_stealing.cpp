@@ -0,0 +1,174 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The victims of the local priority scheduler are grouped into tiers following
+// the cache hierarchy of a known (synthetic) topology, and work which is
+// created on a single worker thread is run to completion by all worker threads
+// for every combination of the work stealing modes.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+// The test is run on the synthetic topology "package:1 l3:2 l2:2 core:2 pu:2"
+// (set through HWLOC_SYNTHETIC by CMake): 2 L3 caches with 2 L2 caches each,
+// 2 cores with 2 PUs each per L2 cache, one worker thread per PU.
+std::size_t const num_pus = 16;
+
+using hpx::threads::policies::scheduler_mode;
+
+///////////////////////////////////////////////////////////////////////////////
+// The PUs sharing a cache are consecutive, the PUs of a core share both
+// caches.
+void test_cache_affinity_masks()
+{
+    auto const& topo = hpx::threads::create_topology();
+    HPX_TEST_EQ(topo.get_number_of_pus(), num_pus);
+    HPX_TEST_EQ(hpx::get_num_worker_threads(), num_pus);
+
+    for (std::size_t pu = 0; pu != num_pus; ++pu)
+    {
+        auto const l2_mask = topo.get_cache_affinity_mask(pu, 2);
+        auto const l3_mask = topo.get_cache_affinity_mask(pu, 3);
+
+        for (std::size_t other = 0; other != num_pus; ++other)
+        {
+            HPX_TEST_EQ(
+                hpx::threads::test(l2_mask, other), pu / 4 == other / 4);
+            HPX_TEST_EQ(
+                hpx::threads::test(l3_mask, other), pu / 8 == other / 8);
+        }
+    }
+}
+
+// Every worker thread steals from the other PUs of its core first, then from
+// the other cores sharing its L2 cache, then from the other L2 caches sharing
+// its L3 cache, and finally from the rest of the (single) NUMA domain.
+void test_victim_tiers()
+{
+    using scheduler_type =
+        hpx::threads::policies::local_priority_queue_scheduler<>;
+
+    auto* scheduler = dynamic_cast<scheduler_type*>(
+        hpx::threads::get_self_id_data()->get_scheduler_base());
+    HPX_TEST(scheduler != nullptr);
+    if (scheduler == nullptr)
+        return;
+
+    for (std::size_t num_thread = 0; num_thread != num_pus; ++num_thread)
+    {
+        // a bound thread on the boundary of the NUMA domain gets an
+        // additional tier for the other NUMA domains, which is empty here
+        auto const tiers = scheduler->get_victim_tiers(num_thread);
+        HPX_TEST(tiers.size() == 4 || (num_thread == 0 && tiers.size() == 5));
+        if (tiers.size() < 4)
+            continue;
+        if (tiers.size() == 5)
+            HPX_TEST(tiers[4].empty());
+
+        std::size_t const divisors[] = {2, 4, 8, num_pus};
+        for (std::size_t tier = 0; tier != 4; ++tier)
+        {
+            std::set<std::size_t> expected;
+            for (std::size_t other = 0; other != num_pus; ++other)
+            {
+                bool const closer = tier != 0 &&
+                    other / divisors[tier - 1] ==
+                        num_thread / divisors[tier - 1];
+                if (other != num_thread && !closer &&
+                    other / divisors[tier] == num_thread / divisors[tier])
+                {
+                    expected.insert(other);
+                }
+            }
+
+            std::set<std::size_t> victims(
+                tiers[tier].begin(), tiers[tier].end());
+            HPX_TEST_EQ(victims.size(), tiers[tier].size());
+            HPX_TEST(victims == expected);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// All work is created on worker thread 0, the other worker threads can only
+// run it by stealing.
+void test_work_stealing(scheduler_mode mode)
+{
+    auto* scheduler = hpx::threads::get_self_id_data()->get_scheduler_base();
+    scheduler->add_scheduler_mode(mode);
+
+    std::size_t const num_tasks = 1000;
+    std::vector<std::size_t> worker_threads(num_tasks, std::size_t(-1));
+
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_schedule_hint(0));
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async(exec, [&worker_threads, i]() {
+            // keep worker thread 0 busy for long enough for the others to
+            // find the work
+            auto const until = std::chrono::steady_clock::now() +
+                std::chrono::microseconds(50);
+            while (std::chrono::steady_clock::now() < until)
+                ;
+            worker_threads[i] = hpx::get_worker_thread_num();
+        }));
+    }
+    hpx::wait_all(futures);
+
+    scheduler->remove_scheduler_mode(mode);
+
+    std::set<std::size_t> workers;
+    for (std::size_t worker : worker_threads)
+    {
+        HPX_TEST_NEQ(worker, std::size_t(-1));
+        workers.insert(worker);
+    }
+    HPX_TEST_LT(std::size_t(1), workers.size());
+}
+
+int hpx_main()
+{
+    test_cache_affinity_masks();
+    test_victim_tiers();
+
+    using namespace hpx::threads::policies;
+
+    test_work_stealing(scheduler_mode(0));
+    test_work_stealing(steal_randomized_victims);
+    test_work_stealing(steal_half);
+    test_work_stealing(scheduler_mode(steal_randomized_victims | steal_half));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=local-priority-fifo"};
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
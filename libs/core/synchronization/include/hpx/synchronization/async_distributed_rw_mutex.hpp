@@ -0,0 +1,474 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/synchronization/async_rw_mutex.hpp>
+#include <hpx/synchronization/distributed_shared_mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace experimental {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The state of an async_distributed_rw_mutex. Readers and writers
+        // are represented by continuations which are invoked once access
+        // was granted, the continuations of blocked readers and writers are
+        // queued until the writer holding the lock releases it.
+        class async_distributed_rw_lock
+        {
+        private:
+            using mutex_type = hpx::lcos::local::spinlock;
+            using continuation_type = hpx::util::unique_function_nonser<void()>;
+
+        public:
+            explicit async_distributed_rw_lock(std::size_t num_slots)
+              : readers_(num_slots)
+              , writer_(false)
+            {
+            }
+
+            async_distributed_rw_lock(
+                async_distributed_rw_lock const&) = delete;
+            async_distributed_rw_lock& operator=(
+                async_distributed_rw_lock const&) = delete;
+
+            ~async_distributed_rw_lock()
+            {
+                HPX_ASSERT(!writer_.load(std::memory_order_relaxed));
+                HPX_ASSERT(read_waiters_.empty() && write_waiters_.empty());
+            }
+
+            template <typename F>
+            void acquire_read(F&& f)
+            {
+                while (true)
+                {
+                    readers_.increment();
+                    if (HPX_LIKELY(!writer_.load(std::memory_order_seq_cst)))
+                    {
+                        f();
+                        return;
+                    }
+
+                    // back off, the writer may be waiting for this reader
+                    // already
+                    release_read();
+
+                    std::unique_lock<mutex_type> l(mtx_);
+                    if (writer_.load(std::memory_order_relaxed))
+                    {
+                        read_waiters_.emplace_back(HPX_FORWARD(F, f));
+                        return;
+                    }
+                }
+            }
+
+            void release_read()
+            {
+                readers_.decrement();
+                if (HPX_UNLIKELY(writer_.load(std::memory_order_seq_cst)))
+                {
+                    std::unique_lock<mutex_type> l(mtx_);
+                    if (!pending_writer_.empty() && readers_.empty())
+                    {
+                        continuation_type f = HPX_MOVE(pending_writer_);
+                        pending_writer_.reset();
+                        l.unlock();
+
+                        f();
+                    }
+                }
+            }
+
+            template <typename F>
+            void acquire_write(F&& f)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (writer_.load(std::memory_order_relaxed))
+                {
+                    write_waiters_.emplace_back(HPX_FORWARD(F, f));
+                    return;
+                }
+
+                writer_.store(true, std::memory_order_seq_cst);
+                start_write(HPX_MOVE(l), HPX_FORWARD(F, f));
+            }
+
+            void release_write()
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                HPX_ASSERT(writer_.load(std::memory_order_relaxed));
+
+                // hand the lock over to the next writer directly if no
+                // reader is waiting
+                std::vector<continuation_type> readers;
+                readers.swap(read_waiters_);
+                if (readers.empty() && !write_waiters_.empty())
+                {
+                    continuation_type next = HPX_MOVE(write_waiters_.front());
+                    write_waiters_.pop_front();
+                    start_write(HPX_MOVE(l), HPX_MOVE(next));
+                    return;
+                }
+
+                continuation_type next;
+                if (!write_waiters_.empty())
+                {
+                    next = HPX_MOVE(write_waiters_.front());
+                    write_waiters_.pop_front();
+                }
+
+                writer_.store(false, std::memory_order_seq_cst);
+                l.unlock();
+
+                // the readers are granted access before the next writer
+                // raises the flag again
+                for (auto& reader : readers)
+                {
+                    acquire_read(HPX_MOVE(reader));
+                }
+                if (!next.empty())
+                {
+                    acquire_write(HPX_MOVE(next));
+                }
+            }
+
+        private:
+            // The writer flag is set, wait for the readers to leave.
+            template <typename F>
+            void start_write(std::unique_lock<mutex_type> l, F&& f)
+            {
+                if (readers_.empty())
+                {
+                    l.unlock();
+                    f();
+                    return;
+                }
+
+                HPX_ASSERT(pending_writer_.empty());
+                pending_writer_ = HPX_FORWARD(F, f);
+            }
+
+            hpx::lcos::local::detail::distributed_reader_count readers_;
+
+            // a writer holds the lock or waits for the readers to leave
+            std::atomic<bool> writer_;
+
+            mutex_type mtx_;
+            continuation_type pending_writer_;
+            std::vector<continuation_type> read_waiters_;
+            std::deque<continuation_type> write_waiters_;
+        };
+
+        template <typename T>
+        struct async_distributed_rw_mutex_storage
+        {
+            template <typename... Ts>
+            explicit async_distributed_rw_mutex_storage(Ts&&... ts)
+              : value(HPX_FORWARD(Ts, ts)...)
+            {
+            }
+
+            T* get() noexcept
+            {
+                return &value;
+            }
+
+            T value;
+        };
+
+        template <>
+        struct async_distributed_rw_mutex_storage<void>
+        {
+            void* get() noexcept
+            {
+                return nullptr;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Access to the value of an async_distributed_rw_mutex, the access
+        // is released when the wrapper goes out of scope.
+        template <async_rw_mutex_access_type AccessType>
+        class async_distributed_rw_mutex_access_base
+        {
+        public:
+            explicit async_distributed_rw_mutex_access_base(
+                async_distributed_rw_lock* lock) noexcept
+              : lock_(lock)
+            {
+            }
+
+            async_distributed_rw_mutex_access_base(
+                async_distributed_rw_mutex_access_base&& rhs) noexcept
+              : lock_(rhs.lock_)
+            {
+                rhs.lock_ = nullptr;
+            }
+
+            async_distributed_rw_mutex_access_base& operator=(
+                async_distributed_rw_mutex_access_base&& rhs) noexcept
+            {
+                if (this != &rhs)
+                {
+                    release();
+                    lock_ = rhs.lock_;
+                    rhs.lock_ = nullptr;
+                }
+                return *this;
+            }
+
+            async_distributed_rw_mutex_access_base(
+                async_distributed_rw_mutex_access_base const&) = delete;
+            async_distributed_rw_mutex_access_base& operator=(
+                async_distributed_rw_mutex_access_base const&) = delete;
+
+            ~async_distributed_rw_mutex_access_base()
+            {
+                release();
+            }
+
+        protected:
+            bool owns_access() const noexcept
+            {
+                return lock_ != nullptr;
+            }
+
+        private:
+            void release()
+            {
+                if (lock_ != nullptr)
+                {
+                    if constexpr (AccessType ==
+                        async_rw_mutex_access_type::read)
+                    {
+                        lock_->release_read();
+                    }
+                    else
+                    {
+                        lock_->release_write();
+                    }
+                    lock_ = nullptr;
+                }
+            }
+
+            async_distributed_rw_lock* lock_;
+        };
+
+        template <typename T, async_rw_mutex_access_type AccessType>
+        class async_distributed_rw_mutex_access
+          : public async_distributed_rw_mutex_access_base<AccessType>
+        {
+        private:
+            using base_type =
+                async_distributed_rw_mutex_access_base<AccessType>;
+            using value_type = std::conditional_t<
+                AccessType == async_rw_mutex_access_type::read, T const, T>;
+
+        public:
+            async_distributed_rw_mutex_access(
+                async_distributed_rw_lock* lock, T* value) noexcept
+              : base_type(lock)
+              , value_(value)
+            {
+            }
+
+            value_type& get() const
+            {
+                HPX_ASSERT(this->owns_access());
+                return *value_;
+            }
+
+            operator value_type&() const
+            {
+                return get();
+            }
+
+        private:
+            T* value_;
+        };
+
+        template <async_rw_mutex_access_type AccessType>
+        class async_distributed_rw_mutex_access<void, AccessType>
+          : public async_distributed_rw_mutex_access_base<AccessType>
+        {
+        private:
+            using base_type =
+                async_distributed_rw_mutex_access_base<AccessType>;
+
+        public:
+            async_distributed_rw_mutex_access(
+                async_distributed_rw_lock* lock, void*) noexcept
+              : base_type(lock)
+            {
+            }
+        };
+    }    // namespace detail
+
+    /// Read-write mutex where access is granted to a value through senders,
+    /// built for read-mostly values accessed from many cores.
+    ///
+    /// \warning Unlike for \a async_rw_mutex, access is granted in the order
+    ///          the senders are \em started, not in the order they are
+    ///          retrieved from \a read and \a readwrite. A sender retrieved
+    ///          later but started earlier is granted access first. For a
+    ///          reader to observe a write, its sender has to be started
+    ///          after the sender of the writer. Code relying on the
+    ///          retrieval order of \a async_rw_mutex can't use this mutex
+    ///          unchanged.
+    ///
+    /// The interface follows \a hpx::experimental::async_rw_mutex, read and
+    /// readwrite return senders which call set_value on a connected receiver
+    /// with a wrapper of the value once it is safe to read or write. Unlike
+    /// for \a async_rw_mutex, readers are counted per worker thread (as for
+    /// \a hpx::lcos::local::distributed_shared_mutex), read access is granted
+    /// without touching any memory shared between cores as long as no writer
+    /// is present. Writers are preferred over readers.
+    ///
+    /// Retrieving, connecting and starting senders is thread-safe. The
+    /// access wrappers are move-only, access is released when the wrapper
+    /// is destroyed.
+    ///
+    /// The mutex is neither copyable nor movable and has to outlive all of
+    /// its senders.
+    template <typename T = void>
+    class async_distributed_rw_mutex
+    {
+    private:
+        template <detail::async_rw_mutex_access_type AccessType>
+        struct sender;
+
+    public:
+        using value_type = T;
+
+        using read_access_type = detail::async_distributed_rw_mutex_access<T,
+            detail::async_rw_mutex_access_type::read>;
+        using readwrite_access_type =
+            detail::async_distributed_rw_mutex_access<T,
+                detail::async_rw_mutex_access_type::readwrite>;
+
+        template <typename... Ts>
+        explicit async_distributed_rw_mutex(Ts&&... ts)
+          : lock_(hpx::threads::hardware_concurrency())
+          , storage_(HPX_FORWARD(Ts, ts)...)
+        {
+        }
+
+        async_distributed_rw_mutex(async_distributed_rw_mutex&&) = delete;
+        async_distributed_rw_mutex& operator=(
+            async_distributed_rw_mutex&&) = delete;
+
+        sender<detail::async_rw_mutex_access_type::read> read() noexcept
+        {
+            return {this};
+        }
+
+        sender<detail::async_rw_mutex_access_type::readwrite>
+        readwrite() noexcept
+        {
+            return {this};
+        }
+
+    private:
+        template <detail::async_rw_mutex_access_type AccessType>
+        struct sender
+        {
+            async_distributed_rw_mutex* mtx;
+
+            using access_type =
+                detail::async_distributed_rw_mutex_access<T, AccessType>;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<Tuple<access_type>>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename R>
+            struct operation_state
+            {
+                std::decay_t<R> r;
+                async_distributed_rw_mutex* mtx;
+
+                template <typename R_>
+                operation_state(R_&& r, async_distributed_rw_mutex* mtx)
+                  : r(HPX_FORWARD(R_, r))
+                  , mtx(mtx)
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void start() noexcept
+                {
+                    // the operation state stays alive until the receiver
+                    // was signaled
+                    auto continuation = [this]() {
+                        try
+                        {
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(r),
+                                access_type{&mtx->lock_, mtx->storage_.get()});
+                        }
+                        catch (...)
+                        {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(r), std::current_exception());
+                        }
+                    };
+
+                    if constexpr (AccessType ==
+                        detail::async_rw_mutex_access_type::read)
+                    {
+                        mtx->lock_.acquire_read(HPX_MOVE(continuation));
+                    }
+                    else
+                    {
+                        mtx->lock_.acquire_write(HPX_MOVE(continuation));
+                    }
+                }
+
+                friend void tag_invoke(hpx::execution::experimental::start_t,
+                    operation_state& os) noexcept
+                {
+                    os.start();
+                }
+            };
+
+            template <typename R>
+            friend auto tag_invoke(
+                hpx::execution::experimental::connect_t, sender&& s, R&& r)
+            {
+                return operation_state<R>{HPX_FORWARD(R, r), s.mtx};
+            }
+        };
+
+        detail::async_distributed_rw_lock lock_;
+        detail::async_distributed_rw_mutex_storage<T> storage_;
+    };
+}}    // namespace hpx::experimental
@@ -159,6 +159,63 @@ namespace hpx { namespace lcos { namespace local {
             return true;
         }
 
+        // Receive up to max values in one go, the values are assigned to
+        // the elements starting at dest. Returns the number of values
+        // received.
+        template <typename OutIter>
+        std::size_t get_n(OutIter dest, std::size_t max) const noexcept
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            if (closed_)
+            {
+                return 0;
+            }
+
+            std::size_t head = head_.data_;
+
+            std::size_t count = 0;
+            while (count != max && !is_empty(head))
+            {
+                *dest = HPX_MOVE(buffer_[head]);
+                ++dest;
+                if (++head >= size_)
+                {
+                    head = 0;
+                }
+                ++count;
+            }
+            head_.data_ = head;
+
+            return count;
+        }
+
+        // Send the values in [first, last) in one go, as many as fit into
+        // the channel. The values are moved from. Returns an iterator
+        // referring to the first value which was not sent.
+        template <typename Iter>
+        Iter set_range(Iter first, Iter last) noexcept
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            if (closed_)
+            {
+                return first;
+            }
+
+            std::size_t tail = tail_.data_;
+
+            for (/**/; first != last && !is_full(tail); ++first)
+            {
+                buffer_[tail] = HPX_MOVE(*first);
+                if (++tail >= size_)
+                {
+                    tail = 0;
+                }
+            }
+            tail_.data_ = tail;
+
+            return first;
+        }
+
         std::size_t close()
         {
             std::unique_lock<mutex_type> l(mtx_.data_);
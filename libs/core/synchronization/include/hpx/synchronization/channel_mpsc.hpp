@@ -172,6 +172,66 @@ namespace hpx { namespace lcos { namespace local {
             return true;
         }
 
+        // Receive up to max values in one go, the values are assigned to
+        // the elements starting at dest. Returns the number of values
+        // received.
+        template <typename OutIter>
+        std::size_t get_n(OutIter dest, std::size_t max) const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            std::size_t head = head_.data_.load(std::memory_order_relaxed);
+            std::size_t const tail =
+                tail_.data_.tail_.load(std::memory_order_acquire);
+
+            std::size_t count = 0;
+            while (count != max && head != tail)
+            {
+                *dest = HPX_MOVE(buffer_[head]);
+                ++dest;
+                if (++head >= size_)
+                {
+                    head = 0;
+                }
+                ++count;
+            }
+            head_.data_.store(head, std::memory_order_release);
+
+            return count;
+        }
+
+        // Send the values in [first, last) in one go, as many as fit into
+        // the channel. The values are moved from. Returns an iterator
+        // referring to the first value which was not sent.
+        template <typename Iter>
+        Iter set_range(Iter first, Iter last) noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return first;
+            }
+
+            std::unique_lock<mutex_type> l(tail_.data_.mtx_);
+
+            std::size_t tail =
+                tail_.data_.tail_.load(std::memory_order_acquire);
+
+            for (/**/; first != last && !is_full(tail); ++first)
+            {
+                buffer_[tail] = HPX_MOVE(*first);
+                if (++tail >= size_)
+                {
+                    tail = 0;
+                }
+            }
+            tail_.data_.tail_.store(tail, std::memory_order_release);
+
+            return first;
+        }
+
         std::size_t close()
         {
             bool expected = false;
@@ -0,0 +1,212 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace local {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The number of readers holding a lock, spread over one counter per
+        // worker thread such that readers running on different cores don't
+        // touch the same cache line.
+        //
+        // A reader may be resumed on another worker thread than the one it
+        // was suspended on, a counter may therefore drop below zero. Only
+        // the sum of all counters is meaningful.
+        //
+        // Threads not managed by HPX share an additional last counter.
+        class distributed_reader_count
+        {
+        public:
+            explicit distributed_reader_count(std::size_t num_slots)
+              : slots_((num_slots == 0 ? 1 : num_slots) + 1)
+            {
+            }
+
+            void increment() noexcept
+            {
+                local_slot().fetch_add(1, std::memory_order_seq_cst);
+            }
+
+            void decrement() noexcept
+            {
+                local_slot().fetch_sub(1, std::memory_order_seq_cst);
+            }
+
+            // Every reader incrementing a counter before a writer flag was
+            // set is seen by a sweep started after setting the flag.
+            bool empty() const noexcept
+            {
+                std::int64_t count = 0;
+                for (auto const& slot : slots_)
+                {
+                    count += slot.data_.load(std::memory_order_seq_cst);
+                }
+                HPX_ASSERT(count >= 0);
+                return count == 0;
+            }
+
+        private:
+            std::atomic<std::int64_t>& local_slot() noexcept
+            {
+                std::size_t const num_thread = hpx::get_worker_thread_num();
+                if (num_thread == std::size_t(-1))
+                {
+                    return slots_.back().data_;
+                }
+                return slots_[num_thread % (slots_.size() - 1)].data_;
+            }
+
+            std::vector<util::cache_aligned_data<std::atomic<std::int64_t>>>
+                slots_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A reader-writer lock for read-mostly data.
+    ///
+    /// Readers announce themselves on a counter of their own worker thread
+    /// only, \a lock_shared and \a unlock_shared don't write to any memory
+    /// shared with readers on other cores as long as no writer is present.
+    /// A writer raises a flag turning readers away, and waits until the
+    /// counters of all worker threads sum up to zero. Writers are preferred
+    /// over readers.
+    ///
+    /// Blocked readers and writers suspend the calling HPX thread.
+    ///
+    /// \note Acquiring the lock exclusively is considerably more expensive
+    ///       than for \a hpx::lcos::local::shared_mutex, the cost grows with
+    ///       the number of worker threads.
+    class distributed_shared_mutex
+    {
+    private:
+        using mutex_type = lcos::local::spinlock;
+
+    public:
+        /// Construct a \a distributed_shared_mutex with one reader counter
+        /// for each of \a num_slots worker threads and one shared by all
+        /// threads not managed by HPX.
+        explicit distributed_shared_mutex(
+            std::size_t num_slots = threads::hardware_concurrency())
+          : readers_(num_slots)
+          , writer_(false)
+        {
+        }
+
+        distributed_shared_mutex(distributed_shared_mutex const&) = delete;
+        distributed_shared_mutex& operator=(
+            distributed_shared_mutex const&) = delete;
+
+        void lock_shared()
+        {
+            while (!try_lock_shared())
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                while (writer_.load(std::memory_order_relaxed))
+                {
+                    reader_cond_.wait(l);
+                }
+            }
+        }
+
+        bool try_lock_shared()
+        {
+            readers_.increment();
+            if (HPX_LIKELY(!writer_.load(std::memory_order_seq_cst)))
+            {
+                return true;
+            }
+
+            // back off, the writer may be waiting for this reader already
+            unlock_shared();
+            return false;
+        }
+
+        void unlock_shared()
+        {
+            readers_.decrement();
+            if (HPX_UNLIKELY(writer_.load(std::memory_order_seq_cst)))
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (readers_.empty())
+                {
+                    drain_cond_.notify_one(HPX_MOVE(l));
+                }
+            }
+        }
+
+        void lock()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            while (writer_.load(std::memory_order_relaxed))
+            {
+                writer_cond_.wait(l);
+            }
+
+            writer_.store(true, std::memory_order_seq_cst);
+            while (!readers_.empty())
+            {
+                drain_cond_.wait(l);
+            }
+        }
+
+        bool try_lock()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (writer_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            writer_.store(true, std::memory_order_seq_cst);
+            if (!readers_.empty())
+            {
+                release_writer(HPX_MOVE(l));
+                return false;
+            }
+            return true;
+        }
+
+        void unlock()
+        {
+            release_writer(std::unique_lock<mutex_type>(mtx_));
+        }
+
+    private:
+        void release_writer(std::unique_lock<mutex_type> l)
+        {
+            HPX_ASSERT(writer_.load(std::memory_order_relaxed));
+            writer_.store(false, std::memory_order_seq_cst);
+
+            reader_cond_.notify_all(HPX_MOVE(l));
+            writer_cond_.notify_one(std::unique_lock<mutex_type>(mtx_));
+        }
+
+        detail::distributed_reader_count readers_;
+
+        // a writer holds the lock or waits for the readers to leave
+        std::atomic<bool> writer_;
+
+        mutex_type mtx_;
+        lcos::local::detail::condition_variable reader_cond_;
+        lcos::local::detail::condition_variable writer_cond_;
+        lcos::local::detail::condition_variable drain_cond_;
+    };
+}}}    // namespace hpx::lcos::local
@@ -16,6 +16,11 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
 namespace hpx { namespace threads {
 
     using thread_id_ref_type = thread_id_ref;
@@ -32,7 +37,57 @@ namespace hpx { namespace threads {
 }}    // namespace hpx::threads
 
 namespace hpx { namespace lcos { namespace local {
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+    ///////////////////////////////////////////////////////////////////////////
+    /// Acquisition statistics of a \a mutex, all times are in nanoseconds.
+    /// They are collected only if HPX was configured with
+    /// HPXLocal_WITH_MUTEX_STATISTICS=ON.
+    struct mutex_statistics
+    {
+        /// The number of buckets of the histograms. Bucket 0 counts the
+        /// times below 128ns, bucket i counts the times in [2^(i+6),
+        /// 2^(i+7)), the last bucket counts all times of 2^21ns and more.
+        static constexpr std::size_t num_buckets = 16;
+
+        static constexpr std::size_t bucket(std::uint64_t time) noexcept
+        {
+            std::size_t b = 0;
+            for (time >>= 7; time != 0 && b != num_buckets - 1; time >>= 1)
+            {
+                ++b;
+            }
+            return b;
+        }
+
+        static constexpr std::uint64_t bucket_lower_bound(
+            std::size_t b) noexcept
+        {
+            return b == 0 ? 0 : std::uint64_t(1) << (b + 6);
+        }
+
+        std::uint64_t acquisitions = 0;    // all acquisitions
+        std::uint64_t contended = 0;       // acquisitions of a locked mutex
+        std::uint64_t spin_acquisitions = 0;    // contended, not suspended
+        std::uint64_t suspensions = 0;          // times a thread suspended
+        std::uint64_t handoffs = 0;    // acquisitions passed on by unlock
+
+        // the times the mutex was held and the times suspended threads
+        // waited for it
+        std::array<std::uint64_t, num_buckets> hold_times = {};
+        std::array<std::uint64_t, num_buckets> wait_times = {};
+    };
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
+    /// A mutex suspending the HPX threads waiting for it.
+    ///
+    /// A thread finding the mutex locked spins for twice as many iterations
+    /// as the previous successful spins needed (based on their moving
+    /// average) before it suspends, short critical sections don't incur a
+    /// suspension. Failed spins halve the estimate, threads stop spinning
+    /// on mutexes held for long. Once threads are suspended, \a unlock
+    /// hands the mutex over to the first of them directly, spinning threads
+    /// can't overtake a suspended one.
     class mutex
     {
     public:
@@ -64,10 +119,51 @@ namespace hpx { namespace lcos { namespace local {
 
         HPX_LOCAL_EXPORT void unlock(error_code& ec = throws);
 
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+        /// Return the acquisition statistics collected since the mutex was
+        /// constructed or the statistics were reset.
+        HPX_LOCAL_EXPORT mutex_statistics get_statistics() const;
+
+        HPX_LOCAL_EXPORT void reset_statistics();
+#endif
+
     protected:
+        // The number of spin iterations is bounded by roughly the cost of a
+        // suspension.
+        static constexpr std::size_t min_spin_count = 16;
+        static constexpr std::size_t max_spin_count = 2000;
+
+        bool is_locked() const noexcept
+        {
+            return owner_id_ != threads::invalid_thread_id || handoff_;
+        }
+
+        void acquire(threads::thread_id_type const& self_id, bool contended,
+            std::uint64_t wait_start);
+
+        void accept_handoff() noexcept;
+
+        std::size_t get_spin_count() const noexcept;
+
+        void update_spin_estimate(std::size_t spins, bool acquired) noexcept;
+
         mutable mutex_type mtx_;
         threads::thread_id_type owner_id_;
         lcos::local::detail::condition_variable cond_;
+
+        // the mutex was unlocked but belongs to the next suspended thread
+        bool handoff_;
+
+        // mirrors is_locked() for the spinning threads
+        std::atomic<bool> locked_;
+
+        // the moving average of the iterations successful spins needed
+        std::size_t spin_estimate_;
+
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+        std::uint64_t acquired_at_;
+        mutex_statistics stats_;
+#endif
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -81,6 +177,10 @@ namespace hpx { namespace lcos { namespace local {
 
         HPX_LOCAL_EXPORT ~timed_mutex();
 
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+        using mutex::get_statistics;
+        using mutex::reset_statistics;
+#endif
         using mutex::lock;
         using mutex::try_lock;
         using mutex::unlock;
@@ -0,0 +1,703 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/local/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace local {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // An asynchronous receiver waiting for a value of an unbounded
+        // channel. The waiter has to stay alive until either deliver or
+        // closed was called.
+        template <typename T>
+        struct unbounded_channel_waiter
+        {
+            virtual ~unbounded_channel_waiter() = default;
+
+            virtual void deliver(T&& t) noexcept = 0;
+            virtual void closed() noexcept = 0;
+
+            unbounded_channel_waiter* next_ = nullptr;
+        };
+    }    // namespace detail
+
+    template <typename T>
+    class unbounded_channel_iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An unbounded multi-producer multi-consumer channel.
+    ///
+    /// The values are stored in a lock-free queue made of fixed size blocks
+    /// of slots. Producers and consumers claim slots by atomically advancing
+    /// per-block indices, empty blocks are recycled through a free list.
+    /// Sending and receiving a value doesn't take any lock as long as no
+    /// receiver is suspended. A receiver finding the channel empty announces
+    /// itself on a counter which is checked by the producers after storing a
+    /// value, the lock protecting the suspended receivers is taken only if
+    /// the counter is non-zero.
+    ///
+    /// Values sent through the same \a producer_token are received in the
+    /// order they were sent. Without a token, this holds only for values
+    /// sent from the same OS thread without the sending HPX thread being
+    /// suspended in between. There is no order between values sent through
+    /// different tokens or by different threads.
+    ///
+    /// \note \a T has to be default constructible and move assignable, the
+    ///       values are received by assigning them to existing objects.
+    template <typename T>
+    class unbounded_channel
+    {
+        static_assert(std::is_default_constructible_v<T> &&
+                std::is_move_assignable_v<T>,
+            "the values of an unbounded_channel have to be default "
+            "constructible and move assignable");
+
+    private:
+        using mutex_type = lcos::local::spinlock;
+        using waiter_type = detail::unbounded_channel_waiter<T>;
+
+        template <typename U>
+        struct send_sender;
+        struct receive_sender;
+
+    public:
+        /// Values sent through the same token are received in the order
+        /// they were sent, independently of the threads sending them. A
+        /// token may be used by one thread at a time only, and must not
+        /// outlive its channel.
+        using producer_token =
+            typename hpx::concurrency::ConcurrentQueue<T>::producer_token_t;
+
+        unbounded_channel()
+          : closed_(false)
+          , head_(nullptr)
+          , tail_(nullptr)
+        {
+        }
+
+        unbounded_channel(unbounded_channel const&) = delete;
+        unbounded_channel& operator=(unbounded_channel const&) = delete;
+
+        ~unbounded_channel()
+        {
+            HPX_ASSERT(head_ == nullptr);
+        }
+
+        /// Create a token for sending values in order.
+        producer_token make_producer_token()
+        {
+            return producer_token(queue_);
+        }
+
+        /// Send a value, returns false if the channel was closed.
+        bool set(T const& t)
+        {
+            return set_impl(T(t));
+        }
+
+        bool set(T&& t)
+        {
+            return set_impl(HPX_MOVE(t));
+        }
+
+        bool set(producer_token const& token, T const& t)
+        {
+            return set_impl(T(t), token);
+        }
+
+        bool set(producer_token const& token, T&& t)
+        {
+            return set_impl(HPX_MOVE(t), token);
+        }
+
+        /// Receive a value if one is available, never suspends.
+        bool try_get(T& t)
+        {
+            return queue_.try_dequeue(t);
+        }
+
+        /// Receive a value, suspends the calling HPX thread until a value
+        /// is available. Returns false if the channel was closed and all
+        /// values sent before were received.
+        bool get(T& t)
+        {
+            while (!queue_.try_dequeue(t))
+            {
+                if (closed_.load(std::memory_order_acquire))
+                {
+                    return queue_.try_dequeue(t);
+                }
+                wait();
+            }
+            return true;
+        }
+
+        /// Send the values in [first, last) in one go, the values are moved
+        /// from. Returns false if the channel was closed.
+        template <typename Iter>
+        bool set_range(Iter first, Iter last)
+        {
+            return set_range_impl(first, last);
+        }
+
+        template <typename Iter>
+        bool set_range(producer_token const& token, Iter first, Iter last)
+        {
+            return set_range_impl(first, last, token);
+        }
+
+        /// Receive up to max values which are available right away, never
+        /// suspends. The values are assigned to the elements starting at
+        /// dest. Returns the number of values received.
+        template <typename OutIter>
+        std::size_t try_get_n(OutIter dest, std::size_t max)
+        {
+            return queue_.try_dequeue_bulk(dest, max);
+        }
+
+        /// Receive up to max values in one go, suspends the calling HPX
+        /// thread until at least one value is available. The values are
+        /// assigned to the elements starting at dest. Returns the number of
+        /// values received, zero if the channel was closed and all values
+        /// sent before were received.
+        template <typename OutIter>
+        std::size_t get_n(OutIter dest, std::size_t max)
+        {
+            if (max == 0)
+            {
+                return 0;
+            }
+
+            while (true)
+            {
+                std::size_t const count = queue_.try_dequeue_bulk(dest, max);
+                if (count != 0)
+                {
+                    return count;
+                }
+
+                if (closed_.load(std::memory_order_acquire))
+                {
+                    return queue_.try_dequeue_bulk(dest, max);
+                }
+                wait();
+            }
+        }
+
+        /// Close the channel, wakes up all suspended receivers. Returns the
+        /// number of receivers which were waiting.
+        std::size_t close()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                l.unlock();
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::unbounded_channel::close",
+                    "attempting to close an already closed channel");
+                return 0;
+            }
+
+            closed_.store(true, std::memory_order_seq_cst);
+
+            waiter_type* waiters = head_;
+            head_ = tail_ = nullptr;
+            std::size_t const count =
+                waiting_.data_.exchange(0, std::memory_order_relaxed);
+
+            cond_.notify_all(HPX_MOVE(l));
+
+            // the waiters still receive the values sent concurrently
+            while (waiters != nullptr)
+            {
+                waiter_type* next = waiters->next_;
+                receive(*waiters);
+                waiters = next;
+            }
+            return count;
+        }
+
+        /// Returns whether the channel was closed and all values sent before
+        /// were received.
+        bool is_drained() const noexcept
+        {
+            return closed_.load(std::memory_order_acquire) &&
+                queue_.size_approx() == 0;
+        }
+
+        /// Returns an iterator receiving the values of the channel, up to
+        /// \a batch_size values are received at once. The iterator is equal
+        /// to \a end once the channel was closed and all values were
+        /// received.
+        unbounded_channel_iterator<T> begin(std::size_t batch_size = 64)
+        {
+            return unbounded_channel_iterator<T>(this, batch_size);
+        }
+
+        unbounded_channel_iterator<T> end() noexcept
+        {
+            return unbounded_channel_iterator<T>();
+        }
+
+        /// Returns a sender sending \a t when started. The sender completes
+        /// with set_error if the channel was closed.
+        template <typename U>
+        send_sender<std::decay_t<U>> async_send(U&& t)
+        {
+            return {this, HPX_FORWARD(U, t)};
+        }
+
+        /// Returns a sender receiving a value when started. The receiver
+        /// connected to it may be signaled on the thread sending the value.
+        /// The sender completes with set_error if the channel is closed and
+        /// all values sent before were received.
+        receive_sender async_receive() noexcept
+        {
+            return {this};
+        }
+
+    private:
+        // The values are sent through the given producer token, if any.
+        template <typename... Token>
+        bool set_impl(T&& t, Token const&... token)
+        {
+            if (closed_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            if (HPX_UNLIKELY(!queue_.enqueue(token..., HPX_MOVE(t))))
+            {
+                HPX_THROW_EXCEPTION(hpx::out_of_memory,
+                    "hpx::lcos::local::unbounded_channel::set",
+                    "could not allocate a block of the channel");
+            }
+
+            notify_sent(1);
+            return true;
+        }
+
+        template <typename Iter, typename... Token>
+        bool set_range_impl(Iter first, Iter last, Token const&... token)
+        {
+            if (closed_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            std::size_t const count = std::distance(first, last);
+            if (HPX_UNLIKELY(!queue_.enqueue_bulk(
+                    token..., std::make_move_iterator(first), count)))
+            {
+                HPX_THROW_EXCEPTION(hpx::out_of_memory,
+                    "hpx::lcos::local::unbounded_channel::set_range",
+                    "could not allocate a block of the channel");
+            }
+
+            notify_sent(count);
+            return true;
+        }
+
+        // Wake up a suspended receiver for each of the values just sent.
+        void notify_sent(std::size_t count)
+        {
+            // a receiver either finds the value or is seen on the counter
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (waiting_.data_.load(std::memory_order_relaxed) == 0)
+                {
+                    break;
+                }
+                notify_one();
+            }
+        }
+
+        // Announces a receiver which is about to be suspended, returns false
+        // if a value was sent or the channel was closed in the meantime.
+        bool prepare_wait()
+        {
+            waiting_.data_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (queue_.size_approx() != 0 ||
+                closed_.load(std::memory_order_relaxed))
+            {
+                waiting_.data_.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        // Suspend the calling HPX thread until a value was sent or the
+        // channel was closed.
+        void wait()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (prepare_wait())
+            {
+                // a producer removing this thread from the queue of
+                // suspended receivers has decremented the counter
+                if (cond_.wait(l) != threads::thread_restart_state::signaled)
+                {
+                    waiting_.data_.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Wake up one suspended receiver, which retries to receive a value.
+        void notify_one()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (waiter_type* w = head_)
+            {
+                head_ = w->next_;
+                if (head_ == nullptr)
+                {
+                    tail_ = nullptr;
+                }
+                waiting_.data_.fetch_sub(1, std::memory_order_relaxed);
+                l.unlock();
+
+                receive(*w);
+            }
+            else if (!cond_.empty(l))
+            {
+                waiting_.data_.fetch_sub(1, std::memory_order_relaxed);
+                cond_.notify_one(HPX_MOVE(l));
+            }
+        }
+
+        // Hand a value to the given waiter, or queue it if none is available.
+        void receive(waiter_type& w)
+        {
+            T t;
+            while (!queue_.try_dequeue(t))
+            {
+                if (closed_.load(std::memory_order_acquire))
+                {
+                    if (queue_.try_dequeue(t))
+                    {
+                        break;
+                    }
+                    w.closed();
+                    return;
+                }
+
+                std::unique_lock<mutex_type> l(mtx_);
+                if (prepare_wait())
+                {
+                    w.next_ = nullptr;
+                    if (tail_ == nullptr)
+                    {
+                        head_ = &w;
+                    }
+                    else
+                    {
+                        tail_->next_ = &w;
+                    }
+                    tail_ = &w;
+                    return;
+                }
+            }
+            w.deliver(HPX_MOVE(t));
+        }
+
+        template <typename U>
+        struct send_sender
+        {
+            unbounded_channel* ch;
+            U value;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<Tuple<>>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename R>
+            struct operation_state
+            {
+                std::decay_t<R> r;
+                unbounded_channel* ch;
+                U value;
+
+                template <typename R_>
+                operation_state(R_&& r, unbounded_channel* ch, U&& value)
+                  : r(HPX_FORWARD(R_, r))
+                  , ch(ch)
+                  , value(HPX_MOVE(value))
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void start() noexcept
+                {
+                    try
+                    {
+                        if (ch->set(HPX_MOVE(value)))
+                        {
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(r));
+                            return;
+                        }
+                        hpx::execution::experimental::set_error(HPX_MOVE(r),
+                            HPX_GET_EXCEPTION(hpx::invalid_status,
+                                "hpx::lcos::local::unbounded_channel::"
+                                "async_send",
+                                "attempting to write to a closed channel"));
+                    }
+                    catch (...)
+                    {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r), std::current_exception());
+                    }
+                }
+
+                friend void tag_invoke(hpx::execution::experimental::start_t,
+                    operation_state& os) noexcept
+                {
+                    os.start();
+                }
+            };
+
+            template <typename R>
+            friend auto tag_invoke(
+                hpx::execution::experimental::connect_t, send_sender&& s, R&& r)
+            {
+                return operation_state<R>{
+                    HPX_FORWARD(R, r), s.ch, HPX_MOVE(s.value)};
+            }
+        };
+
+        struct receive_sender
+        {
+            unbounded_channel* ch;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<Tuple<T>>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename R>
+            struct operation_state : waiter_type
+            {
+                std::decay_t<R> r;
+                unbounded_channel* ch;
+
+                template <typename R_>
+                operation_state(R_&& r, unbounded_channel* ch)
+                  : r(HPX_FORWARD(R_, r))
+                  , ch(ch)
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void deliver(T&& t) noexcept override
+                {
+                    try
+                    {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(r), HPX_MOVE(t));
+                    }
+                    catch (...)
+                    {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r), std::current_exception());
+                    }
+                }
+
+                void closed() noexcept override
+                {
+                    hpx::execution::experimental::set_error(HPX_MOVE(r),
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::unbounded_channel::"
+                            "async_receive",
+                            "this channel is empty and was closed"));
+                }
+
+                void start() noexcept
+                {
+                    try
+                    {
+                        ch->receive(*this);
+                    }
+                    catch (...)
+                    {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r), std::current_exception());
+                    }
+                }
+
+                friend void tag_invoke(hpx::execution::experimental::start_t,
+                    operation_state& os) noexcept
+                {
+                    os.start();
+                }
+            };
+
+            template <typename R>
+            friend auto tag_invoke(hpx::execution::experimental::connect_t,
+                receive_sender&& s, R&& r)
+            {
+                return operation_state<R>{HPX_FORWARD(R, r), s.ch};
+            }
+        };
+
+        hpx::concurrency::ConcurrentQueue<T> queue_;
+
+        // number of receivers announced to be suspended
+        util::cache_aligned_data<std::atomic<std::size_t>> waiting_;
+        std::atomic<bool> closed_;
+
+        // suspended receivers, the HPX threads blocked in get are queued
+        // in the condition variable, the asynchronous ones in the list
+        mutex_type mtx_;
+        lcos::local::detail::condition_variable cond_;
+        waiter_type* head_;
+        waiter_type* tail_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An input iterator over the values received from an unbounded channel.
+    /// The values are received in batches, the iterator suspends only if
+    /// all values of the last batch were consumed and the channel is empty.
+    template <typename T>
+    class unbounded_channel_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const*;
+        using reference = T const&;
+
+        unbounded_channel_iterator() noexcept
+          : channel_(nullptr)
+          , batch_size_(0)
+          , pos_(0)
+        {
+        }
+
+        unbounded_channel_iterator(
+            unbounded_channel<T>* c, std::size_t batch_size)
+          : channel_(c)
+          , batch_size_(batch_size)
+          , pos_(0)
+        {
+            HPX_ASSERT(batch_size != 0);
+            buffer_.reserve(batch_size);
+            receive();
+        }
+
+        reference operator*() const
+        {
+            HPX_ASSERT(channel_ != nullptr && pos_ != buffer_.size());
+            return buffer_[pos_];
+        }
+
+        pointer operator->() const
+        {
+            return &**this;
+        }
+
+        unbounded_channel_iterator& operator++()
+        {
+            HPX_ASSERT(channel_ != nullptr);
+            if (++pos_ == buffer_.size())
+            {
+                receive();
+            }
+            return *this;
+        }
+
+        unbounded_channel_iterator operator++(int)
+        {
+            unbounded_channel_iterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        // iterators are equal if both are past the end or if both refer to
+        // the same channel and neither is past the end
+        friend bool operator==(unbounded_channel_iterator const& lhs,
+            unbounded_channel_iterator const& rhs) noexcept
+        {
+            bool const lhs_at_end = lhs.at_end();
+            if (lhs_at_end || rhs.at_end())
+            {
+                return lhs_at_end == rhs.at_end();
+            }
+            return lhs.channel_ == rhs.channel_;
+        }
+
+        friend bool operator!=(unbounded_channel_iterator const& lhs,
+            unbounded_channel_iterator const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        // An iterator is past the end if it has no channel, or if it has
+        // consumed all received values and the channel was closed and
+        // drained.
+        bool at_end() const noexcept
+        {
+            return channel_ == nullptr ||
+                (pos_ == buffer_.size() && channel_->is_drained());
+        }
+
+        void receive()
+        {
+            buffer_.clear();
+            pos_ = 0;
+            if (channel_->get_n(std::back_inserter(buffer_), batch_size_) == 0)
+            {
+                channel_ = nullptr;
+            }
+        }
+
+        unbounded_channel<T>* channel_;
+        std::size_t batch_size_;
+        std::size_t pos_;
+        std::vector<T> buffer_;
+    };
+}}}    // namespace hpx::lcos::local
@@ -15,9 +15,14 @@
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <utility>
 
@@ -25,6 +30,12 @@ namespace hpx { namespace lcos { namespace local {
     ///////////////////////////////////////////////////////////////////////////
     mutex::mutex(char const* const description)
       : owner_id_(threads::invalid_thread_id)
+      , handoff_(false)
+      , locked_(false)
+      , spin_estimate_(0)
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+      , acquired_at_(0)
+#endif
     {
         HPX_ITT_SYNC_CREATE(this, "lcos::local::mutex", description);
         HPX_ITT_SYNC_RENAME(this, "lcos::local::mutex");
@@ -52,19 +63,60 @@ namespace hpx { namespace lcos { namespace local {
             return;
         }
 
-        while (owner_id_ != threads::invalid_thread_id)
+        bool const contended = is_locked();
+        std::uint64_t wait_start = 0;
+        if (contended)
         {
-            cond_.wait(l, ec);
-            if (ec)
+            // spin without holding the internal lock for as long as the
+            // owner is expected to hold the mutex
+            std::size_t const spin_count = get_spin_count();
+            std::size_t spins = 0;
+
+            l.unlock();
+            while (locked_.load(std::memory_order_relaxed) &&
+                spins != spin_count)
             {
-                HPX_ITT_SYNC_CANCEL(this);
-                return;
+                HPX_SMT_PAUSE;
+                ++spins;
+            }
+            l.lock();
+
+            update_spin_estimate(spins, !is_locked());
+
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+            // the clock is read only once spinning has failed
+            if (!is_locked())
+            {
+                ++stats_.spin_acquisitions;
+            }
+            else
+            {
+                wait_start = hpx::chrono::high_resolution_clock::now();
+            }
+#endif
+
+            while (is_locked())
+            {
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+                ++stats_.suspensions;
+#endif
+
+                threads::thread_restart_state const reason =
+                    cond_.wait(l, ec);
+                if (ec)
+                {
+                    HPX_ITT_SYNC_CANCEL(this);
+                    return;
+                }
+
+                if (reason == threads::thread_restart_state::signaled)
+                {
+                    accept_handoff();
+                }
             }
         }
 
-        util::register_lock(this);
-        HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
+        acquire(self_id, contended, wait_start);
     }
 
     bool mutex::try_lock(char const* /* description */, error_code& /* ec */)
@@ -74,16 +126,13 @@ namespace hpx { namespace lcos { namespace local {
         HPX_ITT_SYNC_PREPARE(this);
         std::unique_lock<mutex_type> l(mtx_);
 
-        if (owner_id_ != threads::invalid_thread_id)
+        if (is_locked())
         {
             HPX_ITT_SYNC_CANCEL(this);
             return false;
         }
 
-        threads::thread_id_type self_id = threads::get_self_id();
-        util::register_lock(this);
-        HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
+        acquire(threads::get_self_id(), false, 0);
         return true;
     }
 
@@ -105,9 +154,23 @@ namespace hpx { namespace lcos { namespace local {
             return;
         }
 
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+        ++stats_.hold_times[mutex_statistics::bucket(
+            hpx::chrono::high_resolution_clock::now() - acquired_at_)];
+#endif
+
         HPX_ITT_SYNC_RELEASED(this);
         owner_id_ = threads::invalid_thread_id;
 
+        if (cond_.empty(l))
+        {
+            locked_.store(false, std::memory_order_relaxed);
+            return;
+        }
+
+        // the mutex stays locked until the first suspended thread resumes
+        handoff_ = true;
+
         {
             util::ignore_while_checking il(&l);
             HPX_UNUSED(il);
@@ -116,6 +179,78 @@ namespace hpx { namespace lcos { namespace local {
         }
     }
 
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+    mutex_statistics mutex::get_statistics() const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return stats_;
+    }
+
+    void mutex::reset_statistics()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        stats_ = mutex_statistics();
+    }
+#endif
+
+    // The internal lock has to be held by the calling thread.
+    void mutex::acquire(threads::thread_id_type const& self_id,
+        bool contended, std::uint64_t wait_start)
+    {
+        util::register_lock(this);
+        HPX_ITT_SYNC_ACQUIRED(this);
+        owner_id_ = self_id;
+        locked_.store(true, std::memory_order_relaxed);
+
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+        acquired_at_ = hpx::chrono::high_resolution_clock::now();
+        ++stats_.acquisitions;
+        if (contended)
+        {
+            ++stats_.contended;
+        }
+        if (wait_start != 0)
+        {
+            ++stats_.wait_times[mutex_statistics::bucket(
+                acquired_at_ - wait_start)];
+        }
+#else
+        HPX_UNUSED(contended);
+        HPX_UNUSED(wait_start);
+#endif
+    }
+
+    // A thread resumed by unlock owns the mutex.
+    void mutex::accept_handoff() noexcept
+    {
+        if (handoff_)
+        {
+            handoff_ = false;
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+            ++stats_.handoffs;
+#endif
+        }
+    }
+
+    // The internal lock has to be held by the calling thread.
+    std::size_t mutex::get_spin_count() const noexcept
+    {
+        return (std::min)(2 * spin_estimate_ + min_spin_count, max_spin_count);
+    }
+
+    // The internal lock has to be held by the calling thread.
+    void mutex::update_spin_estimate(std::size_t spins, bool acquired) noexcept
+    {
+        if (acquired)
+        {
+            spin_estimate_ = (7 * spin_estimate_ + spins) / 8;
+        }
+        else
+        {
+            spin_estimate_ /= 2;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     timed_mutex::timed_mutex(char const* const description)
       : mutex(description)
@@ -133,9 +268,15 @@ namespace hpx { namespace lcos { namespace local {
         HPX_ITT_SYNC_PREPARE(this);
         std::unique_lock<mutex_type> l(mtx_);
 
-        threads::thread_id_type self_id = threads::get_self_id();
-        if (owner_id_ != threads::invalid_thread_id)
+        bool const contended = is_locked();
+        std::uint64_t wait_start = 0;
+        if (contended)
         {
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+            wait_start = hpx::chrono::high_resolution_clock::now();
+            ++stats_.suspensions;
+#endif
+
             threads::thread_restart_state const reason =
                 cond_.wait_until(l, abs_time, ec);
             if (ec)
@@ -150,16 +291,15 @@ namespace hpx { namespace lcos { namespace local {
                 return false;
             }
 
-            if (owner_id_ != threads::invalid_thread_id)    //-V110
+            accept_handoff();
+            if (is_locked())    //-V110
             {
                 HPX_ITT_SYNC_CANCEL(this);
                 return false;
             }
         }
 
-        util::register_lock(this);
-        HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
+        acquire(threads::get_self_id(), contended, wait_start);
         return true;
     }
 }}}    // namespace hpx::lcos::local
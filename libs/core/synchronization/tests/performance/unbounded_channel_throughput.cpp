@@ -0,0 +1,125 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/synchronization/unbounded_channel.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data() = default;
+
+    explicit data(int d)
+    {
+        data_[0] = d;
+    }
+
+    int data_[8];
+};
+
+#if HPX_DEBUG
+constexpr int NUM_TESTS = 1000000;
+#else
+constexpr int NUM_TESTS = 100000000;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Produce
+double thread_func_0(
+    hpx::lcos::local::unbounded_channel<data>& c, int num_values)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != num_values; ++i)
+    {
+        c.set(data{i});
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+// Consume
+double thread_func_1(
+    hpx::lcos::local::unbounded_channel<data>& c, int num_values)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    data d;
+    for (int i = 0; i != num_values; ++i)
+    {
+        if (!c.get(d))
+        {
+            std::cout << "Error!\n";
+        }
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+int hpx_main()
+{
+    hpx::lcos::local::unbounded_channel<data> c;
+
+    // as many producers as consumers, sharing the values evenly
+    std::size_t num_threads = hpx::get_os_thread_count() / 2;
+    if (num_threads == 0)
+    {
+        num_threads = 1;
+    }
+    int const num_values = NUM_TESTS / static_cast<int>(num_threads);
+    int const total = num_values * static_cast<int>(num_threads);
+
+    std::vector<hpx::future<double>> producers;
+    std::vector<hpx::future<double>> consumers;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        producers.push_back(
+            hpx::async(thread_func_0, std::ref(c), num_values));
+        consumers.push_back(
+            hpx::async(thread_func_1, std::ref(c), num_values));
+    }
+
+    double producer_time = 0;
+    for (auto& f : producers)
+    {
+        producer_time = (std::max)(producer_time, f.get());
+    }
+    std::cout << "Producers: " << num_threads << "\n";
+    std::cout << "Producer throughput: " << (total / producer_time)
+              << " [op/s] (" << (producer_time / total) << " [s/op])\n";
+
+    double consumer_time = 0;
+    for (auto& f : consumers)
+    {
+        consumer_time = (std::max)(consumer_time, f.get());
+    }
+    std::cout << "Consumer throughput: " << (total / consumer_time)
+              << " [op/s] (" << (consumer_time / total) << " [s/op])\n";
+
+    c.close();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
@@ -0,0 +1,225 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/async_distributed_rw_mutex.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using hpx::execution::experimental::sync_wait;
+using hpx::execution::experimental::then;
+using hpx::experimental::async_distributed_rw_mutex;
+
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+using size_t_read_access_type =
+    async_distributed_rw_mutex<std::size_t>::read_access_type;
+using size_t_readwrite_access_type =
+    async_distributed_rw_mutex<std::size_t>::readwrite_access_type;
+
+static_assert(
+    std::is_convertible<size_t_read_access_type, std::size_t const&>::value,
+    "The read access type must be convertible to a const reference of the "
+    "given template type");
+static_assert(
+    !std::is_convertible<size_t_read_access_type, std::size_t&>::value,
+    "The read access type must not be convertible to a reference of the "
+    "given template type");
+static_assert(
+    std::is_convertible<size_t_readwrite_access_type, std::size_t&>::value,
+    "The read-write access type must be convertible to a reference of the "
+    "given template type");
+static_assert(!std::is_copy_constructible<size_t_read_access_type>::value,
+    "The access types release the access when destroyed");
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_single_access(async_distributed_rw_mutex<T>& rwm)
+{
+    std::atomic<bool> called{false};
+    rwm.read() | then([&](auto) { called = true; }) | sync_wait();
+    HPX_TEST(called);
+
+    called = false;
+    rwm.readwrite() | then([&](auto) { called = true; }) | sync_wait();
+    HPX_TEST(called);
+}
+
+// A writer is blocked by a reader holding on to its access, and the other
+// way around.
+void test_exclusion()
+{
+    async_distributed_rw_mutex<std::size_t> rwm(0);
+
+    std::atomic<bool> written{false};
+    hpx::future<void> f;
+    {
+        auto access = sync_wait(rwm.read());
+        HPX_TEST_EQ(access.get(), std::size_t(0));
+
+        f = hpx::async([&]() {
+            rwm.readwrite() | then([&](size_t_readwrite_access_type a) {
+                ++a.get();
+                written = true;
+            }) | sync_wait();
+        });
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+        HPX_TEST(!written);
+
+        // other readers are turned away while a writer is waiting
+        std::atomic<bool> read{false};
+        auto r = hpx::async([&]() {
+            rwm.read() | then([&](size_t_read_access_type a) {
+                HPX_TEST_EQ(a.get(), std::size_t(1));
+                read = true;
+            }) | sync_wait();
+        });
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+        HPX_TEST(!read);
+
+        // release the read access
+        [](size_t_read_access_type) {}(std::move(access));
+
+        f.get();
+        HPX_TEST(written);
+
+        r.get();
+        HPX_TEST(read);
+    }
+}
+
+// Access is granted in the order the senders are started, not in the order
+// they are retrieved.
+void test_start_order()
+{
+    async_distributed_rw_mutex<std::size_t> rwm(0);
+
+    auto w = rwm.readwrite();
+    auto r = rwm.read();
+
+    std::move(r) | then([](size_t_read_access_type a) {
+        HPX_TEST_EQ(a.get(), std::size_t(0));
+    }) | sync_wait();
+    std::move(w) |
+        then([](size_t_readwrite_access_type a) { ++a.get(); }) | sync_wait();
+
+    rwm.read() | then([](size_t_read_access_type a) {
+        HPX_TEST_EQ(a.get(), std::size_t(1));
+    }) | sync_wait();
+}
+
+// Readers never overlap with a writer, writers never overlap with each
+// other.
+template <typename T>
+void test_multiple_accesses(
+    async_distributed_rw_mutex<T>& rwm, std::size_t num_accesses)
+{
+    std::atomic<std::size_t> readers{0};
+    std::atomic<std::size_t> writers{0};
+    std::atomic<std::size_t> num_writes{0};
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 9);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_accesses);
+    for (std::size_t i = 0; i != num_accesses; ++i)
+    {
+        if (dist(gen) != 0)
+        {
+            futures.push_back(hpx::async([&]() {
+                rwm.read() | then([&](auto) {
+                    ++readers;
+                    HPX_TEST_EQ(writers.load(), std::size_t(0));
+                    --readers;
+                }) | sync_wait();
+            }));
+        }
+        else
+        {
+            futures.push_back(hpx::async([&]() {
+                rwm.readwrite() | then([&](auto) {
+                    HPX_TEST_EQ(++writers, std::size_t(1));
+                    HPX_TEST_EQ(readers.load(), std::size_t(0));
+                    ++num_writes;
+                    --writers;
+                }) | sync_wait();
+            }));
+        }
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(readers.load(), std::size_t(0));
+    HPX_TEST_EQ(writers.load(), std::size_t(0));
+
+    if constexpr (!std::is_void<T>::value)
+    {
+        using read_access_type =
+            typename async_distributed_rw_mutex<T>::read_access_type;
+        using readwrite_access_type =
+            typename async_distributed_rw_mutex<T>::readwrite_access_type;
+
+        rwm.readwrite() | then([&](readwrite_access_type a) {
+            a.get() = num_writes;
+        }) | sync_wait();
+        rwm.read() | then([&](read_access_type a) {
+            HPX_TEST_EQ(a.get(), num_writes.load());
+        }) | sync_wait();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+    }
+
+    {
+        async_distributed_rw_mutex<> rwm;
+        test_single_access(rwm);
+        test_multiple_accesses(rwm, 10000);
+    }
+
+    {
+        async_distributed_rw_mutex<std::size_t> rwm(0);
+        test_single_access(rwm);
+        test_multiple_accesses(rwm, 10000);
+    }
+
+    test_exclusion();
+    test_start_order();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params i;
+    hpx::program_options::options_description desc_cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+    desc_cmdline.add_options()("seed,s",
+        hpx::program_options::value<unsigned int>(),
+        "the random number generator seed to use for this run");
+    i.desc_cmdline = desc_cmdline;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, i), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,123 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+#include <hpx/synchronization/channel_mpsc.hpp>
+#include <hpx/synchronization/channel_spsc.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+void test_get_n_set_range()
+{
+    Channel c(10);
+
+    std::vector<int> values(15);
+    for (int i = 0; i != 15; ++i)
+    {
+        values[i] = i;
+    }
+
+    // only as many values as fit into the channel are sent
+    auto it = c.set_range(values.begin(), values.end());
+    HPX_TEST(it == values.begin() + 10);
+    HPX_TEST(c.set_range(it, values.end()) == it);
+
+    std::vector<int> received(15, -1);
+    HPX_TEST_EQ(c.get_n(received.begin(), 4), std::size_t(4));
+    HPX_TEST_EQ(c.get_n(received.begin() + 4, 10), std::size_t(6));
+    HPX_TEST_EQ(c.get_n(received.begin() + 10, 10), std::size_t(0));
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(received[i], i);
+    }
+
+    // the ring buffer wraps around
+    HPX_TEST(c.set_range(it, values.end()) == values.end());
+    HPX_TEST_EQ(c.get_n(received.begin() + 10, 10), std::size_t(5));
+    for (int i = 0; i != 15; ++i)
+    {
+        HPX_TEST_EQ(received[i], i);
+    }
+
+    c.close();
+    HPX_TEST(c.set_range(values.begin(), values.end()) == values.begin());
+    HPX_TEST_EQ(c.get_n(received.begin(), 10), std::size_t(0));
+}
+
+// A producer sending batches and a consumer draining the channel in batches
+// see the values in order.
+template <typename Channel>
+void test_batches()
+{
+    Channel c(100);
+
+    int const num_values = 100000;
+
+    hpx::future<void> producer = hpx::async([&]() {
+        std::vector<int> batch(37);
+        for (int i = 0; i < num_values; i += 37)
+        {
+            int n = 0;
+            for (/**/; n != 37 && i + n != num_values; ++n)
+            {
+                batch[n] = i + n;
+            }
+
+            auto first = batch.begin();
+            while (first != batch.begin() + n)
+            {
+                first = c.set_range(first, batch.begin() + n);
+                hpx::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<int> batch(64);
+    int expected = 0;
+    while (expected != num_values)
+    {
+        std::size_t const count = c.get_n(batch.begin(), batch.size());
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            HPX_TEST_EQ(batch[i], expected++);
+        }
+        if (count == 0)
+        {
+            hpx::this_thread::yield();
+        }
+    }
+
+    producer.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_get_n_set_range<hpx::lcos::local::channel_mpmc<int>>();
+    test_get_n_set_range<hpx::lcos::local::channel_mpsc<int>>();
+    test_get_n_set_range<hpx::lcos::local::channel_spsc<int>>();
+
+    test_batches<hpx::lcos::local::channel_mpmc<int>>();
+    test_batches<hpx::lcos::local::channel_mpsc<int>>();
+    test_batches<hpx::lcos::local::channel_spsc<int>>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
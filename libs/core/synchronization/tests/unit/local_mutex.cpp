@@ -15,7 +15,10 @@
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/mutex.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -275,10 +278,147 @@ struct test_recursive_lock
     }
 };
 
+// A thread suspended on the mutex owns it as soon as it is unlocked, a thread
+// trying to lock the mutex afterwards has to wait for it.
+template <typename M>
+struct test_handoff
+{
+    typedef M mutex_type;
+
+    void operator()()
+    {
+        mutex_type mtx;
+        std::vector<int> order;
+        std::atomic<bool> waiting(false);
+        hpx::threads::thread_id_type waiter_id;
+
+        mtx.lock();
+
+        hpx::thread waiter([&]() {
+            waiter_id = hpx::threads::get_self_id();
+            waiting = true;
+
+            std::lock_guard<mutex_type> l(mtx);
+            order.push_back(1);
+        });
+
+        // wait for the waiter to give up spinning and to suspend
+        while (!waiting ||
+            hpx::threads::get_thread_state(waiter_id).state() !=
+                hpx::threads::thread_schedule_state::suspended)
+        {
+            hpx::this_thread::yield();
+        }
+
+        mtx.unlock();
+
+        // the mutex has been handed to the waiter, even though it may not
+        // have run yet
+        bool const overtaken = mtx.try_lock();
+        HPX_TEST(!overtaken);
+        if (overtaken)
+        {
+            mtx.unlock();
+        }
+
+        {
+            std::lock_guard<mutex_type> l(mtx);
+            order.push_back(2);
+        }
+        waiter.join();
+
+        HPX_TEST_EQ(order.size(), std::size_t(2));
+        HPX_TEST_EQ(order[0], 1);
+        HPX_TEST_EQ(order[1], 2);
+    }
+};
+
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+template <typename M>
+struct test_statistics
+{
+    typedef M mutex_type;
+
+    template <typename Histogram>
+    static std::uint64_t sum(Histogram const& histogram)
+    {
+        std::uint64_t result = 0;
+        for (std::uint64_t count : histogram)
+        {
+            result += count;
+        }
+        return result;
+    }
+
+    void operator()()
+    {
+        using hpx::lcos::local::mutex_statistics;
+
+        HPX_TEST_EQ(mutex_statistics::bucket(0), std::size_t(0));
+        HPX_TEST_EQ(mutex_statistics::bucket(127), std::size_t(0));
+        HPX_TEST_EQ(mutex_statistics::bucket(128), std::size_t(1));
+        HPX_TEST_EQ(mutex_statistics::bucket(1000), std::size_t(3));
+        HPX_TEST_EQ(mutex_statistics::bucket(std::uint64_t(-1)),
+            mutex_statistics::num_buckets - 1);
+        for (std::size_t b = 0; b != mutex_statistics::num_buckets; ++b)
+        {
+            HPX_TEST_EQ(mutex_statistics::bucket(
+                            mutex_statistics::bucket_lower_bound(b)),
+                b);
+        }
+
+        mutex_type mtx;
+        std::size_t const num_threads = 8;
+        std::size_t const num_iterations = 1000;
+        std::size_t counter = 0;
+
+        std::vector<hpx::thread> threads;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            threads.emplace_back([&]() {
+                for (std::size_t j = 0; j != num_iterations; ++j)
+                {
+                    std::lock_guard<mutex_type> l(mtx);
+                    ++counter;
+                }
+            });
+        }
+        for (hpx::thread& t : threads)
+        {
+            t.join();
+        }
+        HPX_TEST_EQ(counter, num_threads * num_iterations);
+
+        mutex_statistics stats = mtx.get_statistics();
+        HPX_TEST_EQ(stats.acquisitions, std::uint64_t(counter));
+        HPX_TEST_EQ(sum(stats.hold_times), stats.acquisitions);
+        HPX_TEST(stats.contended <= stats.acquisitions);
+        HPX_TEST(stats.spin_acquisitions <= stats.contended);
+        HPX_TEST_EQ(sum(stats.wait_times),
+            stats.contended - stats.spin_acquisitions);
+        HPX_TEST(stats.handoffs <= stats.suspensions);
+
+        mtx.reset_statistics();
+        stats = mtx.get_statistics();
+        HPX_TEST_EQ(stats.acquisitions, std::uint64_t(0));
+        HPX_TEST_EQ(sum(stats.hold_times), std::uint64_t(0));
+
+        HPX_TEST(mtx.try_lock());
+        HPX_TEST(!mtx.try_lock());
+        mtx.unlock();
+        HPX_TEST_EQ(mtx.get_statistics().acquisitions, std::uint64_t(1));
+    }
+};
+#endif
+
 void test_mutex()
 {
     test_lock<hpx::lcos::local::mutex>()();
     test_trylock<hpx::lcos::local::mutex>()();
+    test_handoff<hpx::lcos::local::mutex>()();
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+    test_statistics<hpx::lcos::local::mutex>()();
+#endif
 }
 
 void test_timed_mutex()
@@ -286,6 +426,10 @@ void test_timed_mutex()
     test_lock<hpx::lcos::local::timed_mutex>()();
     test_trylock<hpx::lcos::local::timed_mutex>()();
     test_timedlock<hpx::lcos::local::timed_mutex>()();
+    test_handoff<hpx::lcos::local::timed_mutex>()();
+#if defined(HPX_HAVE_MUTEX_STATISTICS)
+    test_statistics<hpx::lcos::local::timed_mutex>()();
+#endif
 }
 
 //void test_recursive_mutex()
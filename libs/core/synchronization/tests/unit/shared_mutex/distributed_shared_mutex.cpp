@@ -0,0 +1,175 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/shared_mutex.hpp>
+#include <hpx/local/thread.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using hpx::distributed_shared_mutex;
+
+void test_try_lock()
+{
+    distributed_shared_mutex rw_mutex;
+
+    {
+        std::shared_lock<distributed_shared_mutex> r1(rw_mutex);
+        std::shared_lock<distributed_shared_mutex> r2(
+            rw_mutex, std::try_to_lock);
+        HPX_TEST(r2.owns_lock());
+        HPX_TEST(!rw_mutex.try_lock());
+    }
+
+    {
+        std::unique_lock<distributed_shared_mutex> w(rw_mutex);
+        HPX_TEST(!rw_mutex.try_lock_shared());
+        HPX_TEST(!rw_mutex.try_lock());
+    }
+
+    HPX_TEST(rw_mutex.try_lock());
+    rw_mutex.unlock();
+    HPX_TEST(rw_mutex.try_lock_shared());
+    rw_mutex.unlock_shared();
+}
+
+// Threads not managed by HPX count as readers as well.
+void test_external_readers()
+{
+    distributed_shared_mutex rw_mutex(2);
+
+    std::thread([&]() { HPX_TEST(rw_mutex.try_lock_shared()); }).join();
+    HPX_TEST(!rw_mutex.try_lock());
+
+    {
+        std::shared_lock<distributed_shared_mutex> r(rw_mutex);
+        std::thread([&]() { rw_mutex.unlock_shared(); }).join();
+        HPX_TEST(!rw_mutex.try_lock());
+    }
+
+    HPX_TEST(rw_mutex.try_lock());
+    std::thread([&]() { HPX_TEST(!rw_mutex.try_lock_shared()); }).join();
+    rw_mutex.unlock();
+}
+
+// A reader holding the lock blocks a writer, which in turn blocks the
+// readers arriving after it.
+void test_reader_blocks_writer()
+{
+    distributed_shared_mutex rw_mutex;
+    std::atomic<bool> written(false);
+    std::atomic<bool> read(false);
+
+    rw_mutex.lock_shared();
+
+    hpx::future<void> w = hpx::async([&]() {
+        std::unique_lock<distributed_shared_mutex> l(rw_mutex);
+        written = true;
+    });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST(!written);
+
+    hpx::future<void> r = hpx::async([&]() {
+        std::shared_lock<distributed_shared_mutex> l(rw_mutex);
+        HPX_TEST(written);
+        read = true;
+    });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST(!read);
+
+    rw_mutex.unlock_shared();
+
+    w.get();
+    r.get();
+    HPX_TEST(written);
+    HPX_TEST(read);
+}
+
+// Readers never overlap with a writer, writers never overlap with each
+// other. The HPX threads may be resumed on other worker threads while
+// holding the lock.
+void test_multiple_readers_and_writers()
+{
+    distributed_shared_mutex rw_mutex;
+
+    std::atomic<std::size_t> readers(0);
+    std::atomic<std::size_t> writers(0);
+    std::size_t value = 0;
+
+    std::size_t const num_tasks = 1000;
+    std::size_t const num_iterations = 100;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                if ((i + j) % 16 == 0)
+                {
+                    std::unique_lock<distributed_shared_mutex> l(rw_mutex);
+                    HPX_TEST_EQ(++writers, std::size_t(1));
+                    HPX_TEST_EQ(readers.load(), std::size_t(0));
+                    ++value;
+                    --writers;
+                }
+                else
+                {
+                    std::shared_lock<distributed_shared_mutex> l(rw_mutex);
+                    ++readers;
+                    HPX_TEST_EQ(writers.load(), std::size_t(0));
+                    hpx::this_thread::yield();
+                    --readers;
+                }
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        for (std::size_t j = 0; j != num_iterations; ++j)
+        {
+            if ((i + j) % 16 == 0)
+            {
+                ++expected;
+            }
+        }
+    }
+
+    HPX_TEST_EQ(value, expected);
+}
+
+int hpx_main()
+{
+    test_try_lock();
+    test_external_readers();
+    test_reader_blocks_writer();
+    test_multiple_readers_and_writers();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
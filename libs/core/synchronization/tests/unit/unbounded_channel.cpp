@@ -0,0 +1,446 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/unbounded_channel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::execution::experimental::sync_wait;
+using hpx::execution::experimental::then;
+using hpx::execution::experimental::when_all;
+using hpx::lcos::local::unbounded_channel;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_set_get()
+{
+    unbounded_channel<std::string> c;
+
+    std::string s;
+    HPX_TEST(!c.try_get(s));
+
+    // the values sent by one thread without suspending are received in
+    // order
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(c.set(std::to_string(i)));
+    }
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(c.get(s));
+        HPX_TEST_EQ(s, std::to_string(i));
+    }
+    HPX_TEST(!c.try_get(s));
+
+    HPX_TEST(c.set(std::string("last")));
+    HPX_TEST_EQ(c.close(), std::size_t(0));
+    HPX_TEST(!c.set(std::string("closed")));
+
+    // values sent before closing the channel are still received
+    HPX_TEST(c.get(s));
+    HPX_TEST_EQ(s, std::string("last"));
+    HPX_TEST(!c.get(s));
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// A receiver suspends until a value is sent, or the channel is closed.
+void test_suspended_receiver()
+{
+    unbounded_channel<int> c;
+
+    std::atomic<bool> received(false);
+    hpx::future<void> f = hpx::async([&]() {
+        int value = 0;
+        HPX_TEST(c.get(value));
+        HPX_TEST_EQ(value, 42);
+        received = true;
+        HPX_TEST(!c.get(value));
+    });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST(!received);
+
+    c.set(42);
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST(received);
+
+    c.close();
+    f.get();
+}
+
+// Every value sent by any of the producers is received exactly once.
+void test_multiple_producers_consumers(
+    std::size_t num_producers, std::size_t num_consumers)
+{
+    unbounded_channel<std::size_t> c;
+
+    std::size_t const num_values = 10000;
+
+    std::vector<std::atomic<std::size_t>> received(
+        num_producers * num_values);
+    for (auto& r : received)
+    {
+        r = 0;
+    }
+
+    std::vector<hpx::future<void>> consumers;
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async([&]() {
+            std::size_t value = 0;
+            while (c.get(value))
+            {
+                ++received[value];
+            }
+        }));
+    }
+
+    std::vector<hpx::future<void>> producers;
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        producers.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 0; j != num_values; ++j)
+            {
+                HPX_TEST(c.set(i * num_values + j));
+            }
+        }));
+    }
+
+    hpx::wait_all(producers);
+    c.close();
+    hpx::wait_all(consumers);
+
+    for (auto& r : received)
+    {
+        HPX_TEST_EQ(r.load(), std::size_t(1));
+    }
+}
+
+// The values sent through a producer token are received in order, even if
+// the producers are suspended and resumed on other worker threads while
+// sending.
+void test_producer_token(std::size_t num_producers)
+{
+    unbounded_channel<std::pair<std::size_t, std::size_t>> c;
+
+    std::size_t const num_values = 10000;
+
+    hpx::future<void> consumer = hpx::async([&]() {
+        std::vector<std::size_t> next(num_producers, 0);
+        std::pair<std::size_t, std::size_t> value;
+        while (c.get(value))
+        {
+            HPX_TEST_EQ(value.second, next[value.first]);
+            ++next[value.first];
+        }
+        for (std::size_t n : next)
+        {
+            HPX_TEST_EQ(n, num_values);
+        }
+    });
+
+    std::vector<hpx::future<void>> producers;
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        producers.push_back(hpx::async([&, i]() {
+            auto token = c.make_producer_token();
+            for (std::size_t j = 0; j != num_values; j += 2)
+            {
+                HPX_TEST(c.set(token, std::make_pair(i, j)));
+                hpx::this_thread::yield();
+
+                std::pair<std::size_t, std::size_t> values[] = {{i, j + 1}};
+                HPX_TEST(c.set_range(
+                    token, std::begin(values), std::end(values)));
+            }
+        }));
+    }
+
+    hpx::wait_all(producers);
+    c.close();
+    consumer.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_get_n_set_range()
+{
+    unbounded_channel<int> c;
+
+    std::vector<int> values(100);
+    for (int i = 0; i != 100; ++i)
+    {
+        values[i] = i;
+    }
+    HPX_TEST(c.set_range(values.begin(), values.end()));
+
+    std::vector<int> received(100, -1);
+    HPX_TEST_EQ(c.try_get_n(received.begin(), 30), std::size_t(30));
+    HPX_TEST_EQ(c.get_n(received.begin() + 30, 100), std::size_t(70));
+    HPX_TEST_EQ(c.try_get_n(received.begin(), 100), std::size_t(0));
+    HPX_TEST(received == values);
+
+    // a suspended receiver wakes up and receives the whole batch
+    hpx::future<std::size_t> f = hpx::async([&]() {
+        std::vector<int> batch;
+        std::size_t const count = c.get_n(std::back_inserter(batch), 100);
+        HPX_TEST_EQ(batch.size(), count);
+        return count;
+    });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST(!f.is_ready());
+
+    HPX_TEST(c.set_range(values.begin(), values.begin() + 10));
+    HPX_TEST_EQ(f.get(), std::size_t(10));
+
+    c.close();
+    HPX_TEST(!c.set_range(values.begin(), values.end()));
+    HPX_TEST_EQ(c.get_n(received.begin(), 100), std::size_t(0));
+}
+
+// Consumers iterating over the channel receive every value exactly once.
+void test_iterator()
+{
+    unbounded_channel<std::size_t> c;
+
+    std::size_t const num_values = 100000;
+
+    std::vector<hpx::future<std::size_t>> consumers;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        consumers.push_back(hpx::async([&, i]() {
+            std::size_t sum = 0;
+            for (auto it = c.begin(i + 1); it != c.end(); ++it)
+            {
+                sum += *it;
+            }
+            return sum;
+        }));
+    }
+
+    std::vector<std::size_t> batch;
+    for (std::size_t i = 1; i <= num_values; ++i)
+    {
+        batch.push_back(i);
+        if (batch.size() == 100)
+        {
+            c.set_range(batch.begin(), batch.end());
+            batch.clear();
+        }
+    }
+    c.set_range(batch.begin(), batch.end());
+    c.close();
+
+    std::size_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+    HPX_TEST_EQ(sum, num_values * (num_values + 1) / 2);
+}
+
+// Iterators compare equal to the end iterator once the channel was closed
+// and all values were received.
+void test_iterator_end()
+{
+    unbounded_channel<int> c1;
+    unbounded_channel<int> c2;
+
+    HPX_TEST(c1.end() == c2.end());
+
+    c1.set(1);
+    c1.set(2);
+    c2.set(3);
+    c1.close();
+    c2.close();
+
+    auto it1 = c1.begin(1);
+    auto it2 = c2.begin();
+    HPX_TEST(it1 != c1.end());
+    HPX_TEST(c1.end() != it1);
+    HPX_TEST(it1 != it2);
+    HPX_TEST(it1 == it1);
+
+    // the channel is drained, but the iterator still holds a value
+    ++it1;
+    HPX_TEST(c1.is_drained());
+    HPX_TEST(it1 != c1.end());
+    HPX_TEST_EQ(*it1, 2);
+
+    ++it1;
+    ++it2;
+    HPX_TEST(it1 == c1.end());
+    HPX_TEST(it1 == it2);
+    HPX_TEST(c1.begin() == c2.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_senders()
+{
+    unbounded_channel<int> c;
+
+    sync_wait(c.async_send(1));
+    HPX_TEST_EQ(sync_wait(c.async_receive()), 1);
+
+    sync_wait(when_all(c.async_send(2), c.async_send(3)));
+    int sum = sync_wait(when_all(c.async_receive(), c.async_receive()) |
+        then([](int a, int b) { return a + b; }));
+    HPX_TEST_EQ(sum, 5);
+
+    // a receiver started on an empty channel completes once a value is sent
+    hpx::future<int> f = hpx::async(
+        [&]() { return sync_wait(c.async_receive() | then([](int i) {
+                                     return i + 1;
+                                 })); });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST(!f.is_ready());
+
+    c.set(41);
+    HPX_TEST_EQ(f.get(), 42);
+
+    // receivers waiting on a closed channel complete with an error
+    std::vector<hpx::future<void>> receivers;
+    std::atomic<std::size_t> errors(0);
+    for (int i = 0; i != 10; ++i)
+    {
+        receivers.push_back(hpx::async([&]() {
+            try
+            {
+                sync_wait(c.async_receive());
+            }
+            catch (hpx::exception const&)
+            {
+                ++errors;
+            }
+        }));
+    }
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST_EQ(c.close(), std::size_t(10));
+    hpx::wait_all(receivers);
+    HPX_TEST_EQ(errors.load(), std::size_t(10));
+
+    bool caught_exception = false;
+    try
+    {
+        sync_wait(c.async_send(1));
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// Producers and consumers using the senders and the blocking functions are
+// mixed on the same channel.
+void test_mixed_receivers()
+{
+    unbounded_channel<std::size_t> c;
+
+    std::size_t const num_values = 10000;
+    std::atomic<std::size_t> sum(0);
+
+    std::vector<hpx::future<void>> consumers;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        consumers.push_back(hpx::async([&, i]() {
+            if (i % 2 == 0)
+            {
+                std::size_t value = 0;
+                while (c.get(value))
+                {
+                    sum += value;
+                }
+                return;
+            }
+
+            while (true)
+            {
+                try
+                {
+                    sum += sync_wait(c.async_receive());
+                }
+                catch (hpx::exception const&)
+                {
+                    return;
+                }
+            }
+        }));
+    }
+
+    std::vector<hpx::future<void>> producers;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        producers.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 1; j <= num_values; ++j)
+            {
+                if (i % 2 == 0)
+                {
+                    c.set(j);
+                }
+                else
+                {
+                    sync_wait(c.async_send(j));
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(producers);
+    c.close();
+    hpx::wait_all(consumers);
+
+    HPX_TEST_EQ(sum.load(), 4 * num_values * (num_values + 1) / 2);
+}
+
+int hpx_main()
+{
+    test_set_get();
+    test_suspended_receiver();
+    test_multiple_producers_consumers(1, 1);
+    test_multiple_producers_consumers(1, 8);
+    test_multiple_producers_consumers(8, 1);
+    test_multiple_producers_consumers(16, 16);
+    test_producer_token(1);
+    test_producer_token(8);
+    test_get_n_set_range();
+    test_iterator();
+    test_iterator_end();
+    test_senders();
+    test_mixed_receivers();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
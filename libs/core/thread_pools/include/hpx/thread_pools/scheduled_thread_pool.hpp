@@ -77,6 +77,9 @@ namespace hpx { namespace threads { namespace detail {
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
 
+        void create_work_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
@@ -183,6 +186,17 @@ namespace hpx { namespace threads { namespace detail {
             return active_os_thread_count;
         }
 
+        std::int64_t get_thread_cache_hits(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_thread_cache_hits(num, reset);
+        }
+
+        std::int64_t get_thread_cache_misses(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_thread_cache_misses(num, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(
             std::size_t num, bool reset) override
@@ -233,7 +233,7 @@ namespace hpx { namespace threads { namespace detail {
             sched_->Scheduler::set_all_states_at_least(state_stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(std::size_t(-1));
+            sched_->Scheduler::wake_up_all_idle_threads();
 
             if (blocking)
             {
@@ -246,7 +246,7 @@ namespace hpx { namespace threads { namespace detail {
                     // make sure no OS thread is waiting
                     LTM_(info).format("stop: {} notify_all", id_.name());
 
-                    sched_->Scheduler::do_some_work(std::size_t(-1));
+                    sched_->Scheduler::wake_up_all_idle_threads();
 
                     LTM_(info).format("stop: {} join:{}", id_.name(), i);
 
@@ -639,6 +639,26 @@ namespace hpx { namespace threads { namespace detail {
         return id;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 && !sched_->Scheduler::is_state(state_running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, invalid_status,
+                "thread_pool<Scheduler>::create_work_bulk",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        detail::create_work_bulk(sched_.get(), data, count, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
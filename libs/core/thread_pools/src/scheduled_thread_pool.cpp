@@ -5,8 +5,10 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/local/config.hpp>
+#include <hpx/schedulers/local_deadline_queue_scheduler.hpp>
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/local_workstealing_queue_scheduler.hpp>
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_queue_scheduler.hpp>
@@ -62,3 +64,20 @@ template class HPX_LOCAL_EXPORT
     hpx::threads::policies::shared_priority_queue_scheduler<>;
 template class HPX_LOCAL_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::shared_priority_queue_scheduler<>>;
+
+template class HPX_LOCAL_EXPORT
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_chase_lev,
+        hpx::threads::policies::lockfree_chase_lev>;
+template class HPX_LOCAL_EXPORT
+    hpx::threads::policies::local_workstealing_queue_scheduler<>;
+template class HPX_LOCAL_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_workstealing_queue_scheduler<>>;
+
+template class HPX_LOCAL_EXPORT
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::deadline_heap>;
+template class HPX_LOCAL_EXPORT
+    hpx::threads::policies::local_deadline_queue_scheduler<>;
+template class HPX_LOCAL_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_deadline_queue_scheduler<>>;
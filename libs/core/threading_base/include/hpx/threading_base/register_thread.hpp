@@ -209,6 +209,59 @@ namespace hpx { namespace threads {
     {
         return register_work(data, detail::get_self_or_default_pool(), ec);
     }
+
+    /// \brief Create several new work items at once using the given data.
+    ///
+    /// This is equivalent to calling \a register_work for each element of
+    /// the given range, but allows the scheduler to enqueue all of the work
+    /// items with as few queue operations as possible. The elements of the
+    /// range are left in a moved-from state.
+    ///
+    /// \param data       [in] Points to the data to use for creating the
+    ///                   threads.
+    /// \param count      [in] The number of work items to create.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    inline void register_work_bulk(threads::thread_init_data* data,
+        std::size_t count, threads::thread_pool_base* pool,
+        error_code& ec = throws)
+    {
+        HPX_ASSERT(pool);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            data[i].run_now = false;
+        }
+        pool->create_work_bulk(data, count, ec);
+    }
+
+    /// \brief Create several new work items at once using the given data on
+    ///        the same thread pool as the calling thread, or on the default
+    ///        thread pool if not on an HPX thread.
+    ///
+    /// \param data       [in] Points to the data to use for creating the
+    ///                   threads.
+    /// \param count      [in] The number of work items to create.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    inline void register_work_bulk(threads::thread_init_data* data,
+        std::size_t count, error_code& ec = throws)
+    {
+        register_work_bulk(
+            data, count, detail::get_self_or_default_pool(), ec);
+    }
 }}    // namespace hpx::threads
 
 /// \endcond
@@ -93,12 +93,24 @@ namespace hpx { namespace threads { namespace policies {
             return description_;
         }
 
+        /// This function gets called by the scheduling loop of the given OS
+        /// thread whenever it has been idle for a while. If idle backoff is
+        /// enabled, the OS thread first yields for an adaptively chosen number
+        /// of times and then parks itself (with an exponentially growing
+        /// timeout) until it is woken up by \a do_some_work.
         void idle_callback(std::size_t num_thread);
 
         /// This function gets called by the thread-manager whenever new work
-        /// has been added, allowing the scheduler to reactivate one or more of
-        /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        /// has been added, allowing the scheduler to reactivate one of
+        /// possibly idling OS threads. If num_thread refers to one of the OS
+        /// threads of this scheduler that thread is woken up if it is parked,
+        /// otherwise exactly one other parked OS thread is woken up (which
+        /// may then steal the new work).
+        void do_some_work(std::size_t num_thread);
+
+        /// Wake up all parked OS threads, used whenever all of them have to
+        /// notice a change of state (e.g. when stopping the pool).
+        void wake_up_all_idle_threads();
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
@@ -174,6 +186,19 @@ namespace hpx { namespace threads { namespace policies {
         virtual std::uint64_t get_cleanup_time(bool reset) = 0;
 #endif
 
+        // Number of thread objects which could (hits) or could not (misses)
+        // be reused from the caches of recycled threads
+        virtual std::int64_t get_thread_cache_hits(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_thread_cache_misses(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         virtual std::int64_t get_num_pending_misses(
             std::size_t num_thread, bool reset) = 0;
@@ -222,6 +247,12 @@ namespace hpx { namespace threads { namespace policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        /// Create \a count new threads at once. Schedulers which can enqueue
+        /// several threads more efficiently than one by one override this,
+        /// the default calls \a create_thread for each element.
+        virtual void create_threads_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             threads::thread_id_ref_type& thrd, bool enable_stealing) = 0;
 
@@ -374,15 +405,31 @@ namespace hpx { namespace threads { namespace policies {
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        std::condition_variable cond_;
+        // support for parking OS threads on idle queues, each OS thread parks
+        // on its own condition variable to allow for waking up exactly the
+        // OS thread new work was scheduled on
         struct idle_backoff_data
         {
+            pu_mutex_type mtx_;
+            std::condition_variable cond_;
+
+            // set while the OS thread is (about to be) parked
+            std::atomic<bool> parked_;
+            // set by do_some_work, reset by the OS thread once it has noticed
+            std::atomic<bool> wakeup_;
+
             std::uint32_t wait_count_;
+            std::uint32_t yield_count_;
             double max_idle_backoff_time_;
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // number of currently parked OS threads, allows to skip looking for
+        // a parked OS thread if there is none
+        util::cache_line_data<std::atomic<std::size_t>> num_parked_threads_;
+
+        bool wake_parked_thread(idle_backoff_data& data);
+        bool wake_any_parked_thread(std::size_t first);
 #endif
 
         // support for suspension of pus
@@ -58,6 +58,14 @@ namespace hpx { namespace threads { namespace policies {
         /// This option allows for certain schedulers to explicitly disable
         /// exponential idle-back off
         enable_idle_backoff = 0x0800,
+        /// This option tells schedulers that support it to start looking for
+        /// work at a random victim among the equally close (in terms of the
+        /// hardware topology) other queues, instead of always following the
+        /// same order
+        steal_randomized_victims = 0x1000,
+        /// This option tells schedulers that support it to steal half of the
+        /// pending work items of a victim at once instead of a single one
+        steal_half = 0x2000,
 
         // clang-format off
         /// This option represents the default mode.
@@ -83,7 +91,9 @@ namespace hpx { namespace threads { namespace policies {
             assign_work_thread_parent |
             steal_high_priority_first |
             steal_after_local |
-            enable_idle_backoff
+            enable_idle_backoff |
+            steal_randomized_victims |
+            steal_half
         // clang-format on
     };
 }}}    // namespace hpx::threads::policies
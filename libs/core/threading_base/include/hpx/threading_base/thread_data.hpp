@@ -28,6 +28,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <forward_list>
@@ -464,6 +465,18 @@ namespace hpx { namespace threads {
             priority_ = priority;
         }
 
+        using deadline_type = thread_init_data::deadline_type;
+
+        // the deadline is deadline_type::max() for threads without deadline
+        deadline_type get_deadline() const noexcept
+        {
+            return deadline_;
+        }
+        void set_deadline(deadline_type deadline) noexcept
+        {
+            deadline_ = deadline;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -640,6 +653,7 @@ namespace hpx { namespace threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        deadline_type deadline_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
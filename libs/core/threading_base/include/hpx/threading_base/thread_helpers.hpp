@@ -17,6 +17,7 @@
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
@@ -359,6 +360,51 @@ namespace hpx { namespace threads {
     HPX_LOCAL_EXPORT threads::thread_priority get_thread_priority(
         thread_id_type const& id, error_code& ec = throws);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Return the deadline of the given thread
+    ///
+    /// \param id         [in] The thread id of the thread whose deadline
+    ///                   is queried.
+    /// \param ec         [in,out] this represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \returns          The deadline of the thread, this is
+    ///                   thread_init_data::deadline_type::max() if the thread
+    ///                   does not have a deadline.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    HPX_LOCAL_EXPORT thread_init_data::deadline_type get_thread_deadline(
+        thread_id_type const& id, error_code& ec = throws);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Set the deadline of the given thread
+    ///
+    /// \param id         [in] The thread id of the thread whose deadline
+    ///                   is changed.
+    /// \param deadline   [in] The new deadline of the thread. All threads
+    ///                   created by this thread without an explicit deadline
+    ///                   inherit it. Deadline based schedulers use it when
+    ///                   the thread is scheduled the next time.
+    /// \param ec         [in,out] this represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \returns          The previous deadline of the thread.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    HPX_LOCAL_EXPORT thread_init_data::deadline_type set_thread_deadline(
+        thread_id_type const& id, thread_init_data::deadline_type deadline,
+        error_code& ec = throws);
+
     ///////////////////////////////////////////////////////////////////////////
     /// Return stack size of the given thread
     ///
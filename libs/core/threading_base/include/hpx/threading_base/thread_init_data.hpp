@@ -16,6 +16,7 @@
 #endif
 #include <hpx/type_support/unused.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -26,6 +27,8 @@ namespace hpx { namespace threads {
     class thread_init_data
     {
     public:
+        using deadline_type = std::chrono::steady_clock::time_point;
+
         thread_init_data()
           : func()
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
@@ -44,6 +47,7 @@ namespace hpx { namespace threads {
           , stacksize(thread_stacksize::default_)
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
+          , deadline(deadline_type::max())
           , scheduler_base(nullptr)
         {
             if (initial_state == thread_schedule_state::staged)
@@ -62,6 +66,7 @@ namespace hpx { namespace threads {
             stacksize = rhs.stacksize;
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
+            deadline = rhs.deadline;
             scheduler_base = rhs.scheduler_base;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
@@ -100,6 +105,7 @@ namespace hpx { namespace threads {
           , stacksize(rhs.stacksize)
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
+          , deadline(rhs.deadline)
           , scheduler_base(rhs.scheduler_base)
         {
         }
@@ -133,6 +139,7 @@ namespace hpx { namespace threads {
           , stacksize(stacksize_)
           , initial_state(initial_state_)
           , run_now(run_now_)
+          , deadline(deadline_type::max())
           , scheduler_base(scheduler_base_)
         {
             HPX_UNUSED(desc);
@@ -167,6 +174,11 @@ namespace hpx { namespace threads {
         thread_schedule_state initial_state;
         bool run_now;
 
+        // Deadline based schedulers run the threads with the earliest
+        // deadline first. Threads without a deadline (deadline_type::max())
+        // inherit the deadline of the thread creating them.
+        deadline_type deadline;
+
         policies::scheduler_base* scheduler_base;
     };
 }}    // namespace hpx::threads
@@ -240,6 +240,8 @@ namespace hpx { namespace threads {
             thread_init_data& data, thread_id_ref_type& id, error_code& ec) = 0;
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
+        virtual void create_work_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
 
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
@@ -402,6 +404,17 @@ namespace hpx { namespace threads {
         }
 #endif
 
+        virtual std::int64_t get_thread_cache_hits(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_thread_cache_misses(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
 #if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
         virtual std::int64_t get_num_pending_misses(
             std::size_t /*thread_num*/, bool /*reset*/)
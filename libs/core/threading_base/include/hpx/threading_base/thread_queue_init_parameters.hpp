@@ -39,7 +39,9 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE)
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            std::int64_t max_remote_cached_threads = std::int64_t(
+                HPX_THREAD_QUEUE_MAX_REMOTE_CACHED_THREADS))
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -55,6 +57,7 @@ namespace hpx { namespace threads { namespace policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , max_remote_cached_threads_(max_remote_cached_threads)
         {
         }
 
@@ -73,5 +76,6 @@ namespace hpx { namespace threads { namespace policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        std::int64_t max_remote_cached_threads_;
     };
 }}}    // namespace hpx::threads::policies
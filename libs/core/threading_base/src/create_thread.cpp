@@ -79,6 +79,14 @@ namespace hpx { namespace threads { namespace detail {
             {
                 data.priority = thread_priority::high_recursive;
             }
+
+            // Pass the deadline from parent to child (but only if none is
+            // explicitly specified).
+            if (data.deadline == thread_init_data::deadline_type::max())
+            {
+                data.deadline =
+                    get_thread_id_data(threads::get_self_id())->get_deadline();
+            }
         }
 
         if (data.priority == thread_priority::default_)
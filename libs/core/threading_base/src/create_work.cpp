@@ -13,84 +13,110 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace hpx { namespace threads { namespace detail {
 
-    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
-        threads::thread_init_data& data, error_code& ec)
-    {
-        // verify parameters
-        switch (data.initial_state)
-        {
-        case thread_schedule_state::pending:
-        case thread_schedule_state::pending_do_not_schedule:
-        case thread_schedule_state::pending_boost:
-        case thread_schedule_state::suspended:
-            break;
+    namespace {
 
-        default:
+        // verify the parameters of a new work item and fill in defaults
+        bool prepare_work(policies::scheduler_base* scheduler,
+            threads::thread_init_data& data, thread_self* self,
+            error_code& ec)
         {
-            HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
-                "invalid initial state: {}", data.initial_state);
-            return invalid_thread_id;
-        }
-        }
+            // verify parameters
+            switch (data.initial_state)
+            {
+            case thread_schedule_state::pending:
+            case thread_schedule_state::pending_do_not_schedule:
+            case thread_schedule_state::pending_boost:
+            case thread_schedule_state::suspended:
+                break;
+
+            default:
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "thread::detail::create_work", "invalid initial state: {}",
+                    data.initial_state);
+                return false;
+            }
+            }
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-        if (!data.description)
-        {
-            HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
-                "description is nullptr");
-            return invalid_thread_id;
-        }
+            if (!data.description)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "thread::detail::create_work", "description is nullptr");
+                return false;
+            }
 #endif
 
-        LTM_(info)
-            .format("create_work: pool({}), scheduler({}), initial_state({}), "
-                    "thread_priority({})",
-                *scheduler->get_parent_pool(), *scheduler,
-                get_thread_state_name(data.initial_state),
-                get_thread_priority_name(data.priority))
+            LTM_(info)
+                .format("create_work: pool({}), scheduler({}), "
+                        "initial_state({}), thread_priority({})",
+                    *scheduler->get_parent_pool(), *scheduler,
+                    get_thread_state_name(data.initial_state),
+                    get_thread_priority_name(data.priority))
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-            .format(", description({})", data.description)
+                .format(", description({})", data.description)
 #endif
-            ;
-
-        thread_self* self = get_self_ptr();
+                ;
 
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        if (nullptr == data.parent_id)
-        {
-            if (self)
+            if (nullptr == data.parent_id)
             {
-                data.parent_id = get_thread_id_data(self->get_thread_id());
-                data.parent_phase = self->get_thread_phase();
+                if (self)
+                {
+                    data.parent_id = get_thread_id_data(self->get_thread_id());
+                    data.parent_phase = self->get_thread_phase();
+                }
             }
-        }
-        if (0 == data.parent_locality_id)
-            data.parent_locality_id = detail::get_locality_id(hpx::throws);
+            if (0 == data.parent_locality_id)
+                data.parent_locality_id =
+                    detail::get_locality_id(hpx::throws);
 #endif
 
-        if (nullptr == data.scheduler_base)
-            data.scheduler_base = scheduler;
+            if (nullptr == data.scheduler_base)
+                data.scheduler_base = scheduler;
 
-        // Pass critical priority from parent to child.
-        if (self)
-        {
-            if (data.priority == thread_priority::default_ &&
-                thread_priority::high_recursive ==
-                    get_thread_id_data(self->get_thread_id())->get_priority())
+            // Pass critical priority from parent to child.
+            if (self)
             {
-                data.priority = thread_priority::high_recursive;
+                if (data.priority == thread_priority::default_ &&
+                    thread_priority::high_recursive ==
+                        get_thread_id_data(self->get_thread_id())
+                            ->get_priority())
+                {
+                    data.priority = thread_priority::high_recursive;
+                }
+
+                // Pass the deadline from parent to child (but only if none
+                // is explicitly specified).
+                if (data.deadline == thread_init_data::deadline_type::max())
+                {
+                    data.deadline = get_thread_id_data(self->get_thread_id())
+                                        ->get_deadline();
+                }
             }
-        }
 
-        // create the new thread
-        if (data.priority == thread_priority::default_)
-            data.priority = thread_priority::normal;
+            // create the new thread
+            if (data.priority == thread_priority::default_)
+                data.priority = thread_priority::normal;
+
+            data.run_now = (thread_priority::high == data.priority ||
+                thread_priority::high_recursive == data.priority ||
+                thread_priority::boost == data.priority);
+
+            return true;
+        }
+    }    // namespace
 
-        data.run_now = (thread_priority::high == data.priority ||
-            thread_priority::high_recursive == data.priority ||
-            thread_priority::boost == data.priority);
+    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data& data, error_code& ec)
+    {
+        if (!prepare_work(scheduler, data, get_self_ptr(), ec))
+            return invalid_thread_id;
 
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
@@ -101,4 +127,32 @@ namespace hpx { namespace threads { namespace detail {
 
         return id;
     }
+
+    void create_work_bulk(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        thread_self* self = get_self_ptr();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (!prepare_work(scheduler, data[i], self, ec))
+                return;
+        }
+
+        scheduler->create_threads_bulk(data, count, ec);
+        if (ec)
+            return;
+
+        // Wake up one thread for each distinct queue the work items have
+        // been placed on. Consecutive items usually share the same queue.
+        std::int16_t last_hint = -1;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            std::int16_t const hint = data[i].schedulehint.hint;
+            if (i == 0 || hint != last_hint)
+            {
+                scheduler->do_some_work(hint);
+                last_hint = hint;
+            }
+        }
+    }
 }}}    // namespace hpx::threads::detail
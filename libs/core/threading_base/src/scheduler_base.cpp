@@ -30,6 +30,7 @@
 #include <ostream>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -56,18 +57,35 @@ namespace hpx { namespace threads { namespace policies {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         double max_time = thread_queue_init.max_idle_backoff_time_;
 
-        wait_counts_.resize(num_threads);
+        wait_counts_ =
+            std::vector<util::cache_line_data<idle_backoff_data>>(num_threads);
         for (auto&& data : wait_counts_)
         {
+            data.data_.parked_.store(false, std::memory_order_relaxed);
+            data.data_.wakeup_.store(false, std::memory_order_relaxed);
             data.data_.wait_count_ = 0;
+            data.data_.yield_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
+        num_parked_threads_.data_.store(0, std::memory_order_relaxed);
 #endif
 
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].store(state_initialized);
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+        // upper limit for the number of times an idle OS thread yields
+        // before parking itself
+        constexpr std::uint32_t max_idle_yield_count = 256;
+
+        // an OS thread which is woken up this quickly after having been
+        // parked would have been better off yielding for a while instead
+        constexpr std::chrono::microseconds short_park_duration(200);
+    }    // namespace
+#endif
+
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
@@ -76,9 +94,30 @@ namespace hpx { namespace threads { namespace policies {
         {
             // Put this thread to sleep for some time, additionally it gets
             // woken up on new work.
-
             idle_backoff_data& data = wait_counts_[num_thread].data_;
 
+            // A wakeup request which was made while this thread was busy is
+            // consumed here, new work may have arrived in the meantime. It
+            // does not tell anything about how long this thread would have
+            // been parked.
+            if (data.wakeup_.exchange(false, std::memory_order_acquire))
+            {
+                data.wait_count_ = 0;
+                return;
+            }
+
+            // First yield the OS thread for a while, new work may arrive
+            // shortly.
+            for (std::uint32_t i = 0; i != data.yield_count_; ++i)
+            {
+                if (data.wakeup_.exchange(false, std::memory_order_acquire))
+                {
+                    data.wait_count_ = 0;
+                    return;
+                }
+                std::this_thread::yield();
+            }
+
             // Exponential back-off with a maximum sleep time.
             double exponent = (std::min)(double(data.wait_count_),
                 double(std::numeric_limits<double>::max_exponent - 1));
@@ -88,11 +127,41 @@ namespace hpx { namespace threads { namespace policies {
 
             ++data.wait_count_;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) == std::cv_status::no_timeout)
+            auto const start = std::chrono::steady_clock::now();
+
+            bool woken_up = false;
+            {
+                std::unique_lock<pu_mutex_type> l(data.mtx_);
+                data.parked_.store(true);
+                ++num_parked_threads_.data_;
+                woken_up = data.cond_.wait_for(
+                    l, period, [&]() { return data.wakeup_.load(); });
+                --num_parked_threads_.data_;
+                data.parked_.store(false, std::memory_order_relaxed);
+            }
+            data.wakeup_.store(false, std::memory_order_relaxed);
+
+            if (woken_up)
             {
                 // reset counter if thread was woken up
                 data.wait_count_ = 0;
+
+                // Adapt the number of yields before parking next time based
+                // on how long this thread was parked.
+                if (std::chrono::steady_clock::now() - start <
+                    short_park_duration)
+                {
+                    data.yield_count_ = (std::min)(
+                        2 * data.yield_count_ + 1, max_idle_yield_count);
+                }
+                else
+                {
+                    data.yield_count_ /= 2;
+                }
+            }
+            else
+            {
+                data.yield_count_ /= 2;
             }
         }
 #else
@@ -100,20 +169,100 @@ namespace hpx { namespace threads { namespace policies {
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    // Wake up the OS thread associated with the given data if it is parked.
+    // Returns whether the thread was parked.
+    bool scheduler_base::wake_parked_thread(idle_backoff_data& data)
+    {
+        // The stores/loads to wakeup_ and parked_ are sequentially
+        // consistent so that either the parking thread sees the wakeup
+        // request, or we see the thread as parked.
+        data.wakeup_.store(true);
+        if (!data.parked_.load())
+        {
+            return false;
+        }
+
+        std::lock_guard<pu_mutex_type> l(data.mtx_);
+        data.cond_.notify_one();
+        return true;
+    }
+
+    // Wake up exactly one parked OS thread, starting the search at the given
+    // index. Returns whether a parked thread was found.
+    bool scheduler_base::wake_any_parked_thread(std::size_t first)
+    {
+        if (num_parked_threads_.data_.load() == 0)
+        {
+            return false;
+        }
+
+        std::size_t const num_threads = wait_counts_.size();
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            // don't leave a wakeup request with threads which are busy
+            idle_backoff_data& data =
+                wait_counts_[(first + i) % num_threads].data_;
+            if (data.parked_.load() && wake_parked_thread(data))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::enable_idle_backoff)
         {
-            cond_.notify_all();
+            if (num_thread < wait_counts_.size())
+            {
+                // wake up the OS thread the work was scheduled on, if that
+                // thread is busy wake up another one which may steal the
+                // work instead
+                if (!wake_parked_thread(wait_counts_[num_thread].data_))
+                {
+                    wake_any_parked_thread(num_thread + 1);
+                }
+                return;
+            }
+
+            // wake up a single OS thread for work without a hint
+            wake_any_parked_thread(0);
+        }
+#else
+        (void) num_thread;
+#endif
+    }
+
+    void scheduler_base::wake_up_all_idle_threads()
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        for (auto&& data : wait_counts_)
+        {
+            wake_parked_thread(data.data_);
         }
 #endif
     }
 
+    void scheduler_base::create_threads_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            thread_id_ref_type id = invalid_thread_id;
+            create_thread(data[i], data[i].run_now ? &id : nullptr, ec);
+            if (ec)
+                return;
+        }
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -318,7 +467,7 @@ namespace hpx { namespace threads { namespace policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(std::size_t(-1));
+        wake_up_all_idle_threads();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
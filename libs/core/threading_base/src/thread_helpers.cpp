@@ -88,6 +88,34 @@ namespace hpx { namespace threads {
                     thread_priority::unknown;
     }
 
+    thread_init_data::deadline_type get_thread_deadline(
+        thread_id_type const& id, error_code& /* ec */)
+    {
+        return id ? get_thread_id_data(id)->get_deadline() :
+                    thread_init_data::deadline_type::max();
+    }
+
+    thread_init_data::deadline_type set_thread_deadline(
+        thread_id_type const& id, thread_init_data::deadline_type deadline,
+        error_code& ec)
+    {
+        if (HPX_UNLIKELY(!id))
+        {
+            HPX_THROWS_IF(ec, null_thread_id,
+                "hpx::threads::set_thread_deadline",
+                "null thread id encountered");
+            return thread_init_data::deadline_type::max();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        thread_data* thrd = get_thread_id_data(id);
+        thread_init_data::deadline_type const previous = thrd->get_deadline();
+        thrd->set_deadline(deadline);
+        return previous;
+    }
+
     std::ptrdiff_t get_stack_size(
         thread_id_type const& id, error_code& /* ec */)
     {
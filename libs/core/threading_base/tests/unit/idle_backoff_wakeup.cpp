@@ -0,0 +1,71 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// A task spawned by a busy worker thread is picked up by a parked worker
+// thread without waiting for the idle backoff timeout to expire.
+
+#include <hpx/local/config.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// the maximal time a parked worker thread sleeps before looking for work
+constexpr int max_idle_backoff_time = 1000;
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    // keep this worker thread busy until the other one is parked for the
+    // maximal time
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(3 * max_idle_backoff_time));
+
+    std::atomic<bool> started(false);
+
+    // the new task is scheduled on the busy worker thread
+    hpx::execution::parallel_executor exec(hpx::threads::thread_schedule_hint(
+        static_cast<std::int16_t>(hpx::get_worker_thread_num())));
+
+    auto const start = std::chrono::steady_clock::now();
+    hpx::future<void> f = hpx::async(exec, [&]() { started = true; });
+
+    // don't give this worker thread a chance to run the task itself
+    while (!started &&
+        std::chrono::steady_clock::now() - start <
+            std::chrono::milliseconds(2 * max_idle_backoff_time))
+    {
+    }
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    HPX_TEST(started);
+    HPX_TEST(elapsed < std::chrono::milliseconds(max_idle_backoff_time / 10));
+
+    f.get();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=2",
+        "hpx.max_idle_backoff_time=" + std::to_string(max_idle_backoff_time)};
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,155 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Work items registered in bulk are all run, work items with a schedule hint
+// are run by the worker thread given by the hint, and errors are reported
+// through the error_code passed by the caller.
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::size_t const num_items = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+// All work items are run exactly once, more work items than are published
+// with a single queue operation are registered at once.
+void test_all_items_run()
+{
+    std::vector<std::atomic<int>> calls(num_items);
+    hpx::latch l(num_items + 1);
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_items);
+    for (std::size_t i = 0; i != num_items; ++i)
+    {
+        data.emplace_back(hpx::threads::make_thread_function_nullary([&, i]() {
+            ++calls[i];
+            l.count_down(1);
+        }),
+            "test_all_items_run");
+    }
+
+    hpx::threads::register_work_bulk(data.data(), data.size());
+    l.arrive_and_wait();
+
+    for (auto& c : calls)
+    {
+        HPX_TEST_EQ(c.load(), 1);
+    }
+}
+
+// The scheduler is configured not to steal, the work items have to be run by
+// the worker threads they were given as their hint.
+void test_schedule_hints()
+{
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    std::vector<std::size_t> worker_threads(num_items, std::size_t(-1));
+    hpx::latch l(num_items + 1);
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_items);
+    for (std::size_t i = 0; i != num_items; ++i)
+    {
+        // consecutive work items target the same worker thread in runs of
+        // different lengths, hints beyond the number of worker threads wrap
+        // around
+        auto hint = static_cast<std::int16_t>((i / (i % 7 + 1)) % 19);
+        data.emplace_back(hpx::threads::make_thread_function_nullary([&, i]() {
+            worker_threads[i] = hpx::get_worker_thread_num();
+            l.count_down(1);
+        }),
+            "test_schedule_hints", hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(hint));
+    }
+
+    hpx::threads::register_work_bulk(data.data(), data.size());
+    l.arrive_and_wait();
+
+    for (std::size_t i = 0; i != num_items; ++i)
+    {
+        std::size_t const hint = (i / (i % 7 + 1)) % 19;
+        HPX_TEST_EQ(worker_threads[i], hint % num_threads);
+    }
+}
+
+// Errors are reported through the given error_code, no work item is run.
+void test_error_code(hpx::threads::thread_schedule_state initial_state)
+{
+    std::atomic<std::size_t> calls(0);
+
+    using hpx::threads::thread_schedule_state;
+
+    std::vector<hpx::threads::thread_init_data> data;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        data.emplace_back(
+            hpx::threads::make_thread_function_nullary([&]() { ++calls; }),
+            "test_error_code", hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(),
+            hpx::threads::thread_stacksize::default_,
+            i == 0 ? initial_state : thread_schedule_state::pending);
+    }
+
+    {
+        hpx::error_code ec(hpx::lightweight);
+        hpx::threads::register_work_bulk(data.data(), data.size(), ec);
+        HPX_TEST(ec);
+        HPX_TEST_EQ(ec.value(), hpx::bad_parameter);
+    }
+
+    {
+        bool caught_exception = false;
+        try
+        {
+            hpx::threads::register_work_bulk(data.data(), data.size());
+            HPX_TEST(false);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    HPX_TEST_EQ(calls.load(), std::size_t(0));
+}
+
+int hpx_main()
+{
+    test_all_items_run();
+    test_schedule_hints();
+
+    // invalid initial states are rejected before any work item is created,
+    // suspended work items can't be staged
+    test_error_code(hpx::threads::thread_schedule_state::terminated);
+    test_error_code(hpx::threads::thread_schedule_state::suspended);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the static scheduler does not steal work from other worker threads
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=all", "hpx.scheduler=static-priority"};
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -56,6 +56,43 @@ namespace hpx { namespace threads {
                     "than number of threads (--hpx:threads)");
             }
         }
+
+        // Create a thread pool managed by a scheduler which has the same
+        // queue layout as the local_priority_queue_scheduler.
+        template <typename Scheduler>
+        std::unique_ptr<thread_pool_base> create_priority_queue_pool(
+            hpx::util::runtime_configuration const& rtcfg,
+            thread_pool_init_parameters const& thread_pool_init,
+            policies::thread_queue_init_parameters const& thread_queue_init,
+            char const* description, std::size_t numa_sensitive)
+        {
+            // set parameters for scheduler and pool instantiation and
+            // perform compatibility checks
+            std::size_t num_high_priority_queues =
+                hpx::util::get_entry_as<std::size_t>(rtcfg,
+                    "hpx.thread_queue.high_priority_queues",
+                    thread_pool_init.num_threads_);
+            check_num_high_priority_queues(
+                thread_pool_init.num_threads_, num_high_priority_queues);
+
+            // instantiate the scheduler
+            typename Scheduler::init_parameter_type init(
+                thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+                num_high_priority_queues, thread_queue_init, description);
+
+            std::unique_ptr<Scheduler> sched(new Scheduler(init));
+
+            // set the default scheduler flags
+            sched->set_scheduler_mode(thread_pool_init.mode_);
+            // conditionally set/unset this flag
+            sched->update_scheduler_mode(
+                policies::enable_stealing_numa, !numa_sensitive);
+
+            // instantiate the pool
+            return std::unique_ptr<thread_pool_base>(
+                new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+                    HPX_MOVE(sched), thread_pool_init));
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -141,6 +178,10 @@ namespace hpx { namespace threads {
             hpx::util::get_entry_as<std::int64_t>(rtcfg_,
                 "hpx.thread_queue.init_threads_count",
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
+        std::int64_t const max_remote_cached_threads =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.max_remote_cached_threads",
+                HPX_THREAD_QUEUE_MAX_REMOTE_CACHED_THREADS);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
 
@@ -158,7 +199,8 @@ namespace hpx { namespace threads {
             min_tasks_to_steal_staged, min_add_new_count, max_add_new_count,
             min_delete_count, max_delete_count, max_terminated_threads,
             init_threads_count, max_idle_backoff_time, small_stacksize,
-            medium_stacksize, large_stacksize, huge_stacksize);
+            medium_stacksize, large_stacksize, huge_stacksize,
+            max_remote_cached_threads);
 
         if (!rtcfg_.enable_networking())
         {
@@ -480,6 +522,32 @@ namespace hpx { namespace threads {
                 break;
             }
 
+            case resource::work_stealing:
+            {
+                using local_sched_type = hpx::threads::policies::
+                    local_workstealing_queue_scheduler<>;
+
+                pools_.push_back(
+                    detail::create_priority_queue_pool<local_sched_type>(
+                        rtcfg_, thread_pool_init, thread_queue_init,
+                        "core-local_workstealing_queue_scheduler",
+                        numa_sensitive));
+                break;
+            }
+
+            case resource::deadline:
+            {
+                using local_sched_type =
+                    hpx::threads::policies::local_deadline_queue_scheduler<>;
+
+                pools_.push_back(
+                    detail::create_priority_queue_pool<local_sched_type>(
+                        rtcfg_, thread_pool_init, thread_queue_init,
+                        "core-local_deadline_queue_scheduler",
+                        numa_sensitive));
+                break;
+            }
+
             case resource::shared_priority:
             {
                 // instantiate the scheduler
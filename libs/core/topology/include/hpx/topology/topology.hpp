@@ -187,6 +187,13 @@ namespace hpx { namespace threads {
         mask_cref_type get_core_affinity_mask(
             std::size_t num_thread, error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the cache of the given level
+        ///        (1 for L1, 2 for L2, etc.) with the given thread. The
+        ///        returned mask is empty if no such cache is known.
+        mask_type get_cache_affinity_mask(
+            std::size_t num_thread, unsigned cache_level) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
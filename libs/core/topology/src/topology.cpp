@@ -1119,6 +1119,40 @@ namespace hpx { namespace threads {
         return default_mask;
     }    // }}}
 
+    mask_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, unsigned cache_level) const
+    {    // {{{
+        mask_type mask = mask_type();
+        resize(mask, get_number_of_pus());
+
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t obj = nullptr;
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+        }
+
+        // walk up the tree until we find the cache of the requested level
+        for (/**/; obj != nullptr; obj = obj->parent)
+        {
+#if HWLOC_API_VERSION >= 0x00020000
+            if (hwloc_obj_type_is_cache(obj->type) &&
+                obj->attr->cache.depth == cache_level)
+#else
+            if (obj->type == HWLOC_OBJ_CACHE &&
+                obj->attr->cache.depth == cache_level)
+#endif
+            {
+                extract_node_mask(obj, mask);
+                break;
+            }
+        }
+
+        return mask;
+    }    // }}}
+
     mask_type topology::init_thread_affinity_mask(std::size_t num_thread) const
     {    // {{{
 
@@ -17,12 +17,14 @@
 #include <hpx/local/init.hpp>
 #include <hpx/local/thread.hpp>
 #include <hpx/local/version.hpp>
+#include <hpx/executors/numa_allocator.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -311,16 +313,17 @@ struct triad_step
 };
 
 ///////////////////////////////////////////////////////////////////////////////
-template <typename Policy>
+template <typename Allocator = std::allocator<STREAM_TYPE>, typename Policy>
 std::vector<std::vector<double>> run_benchmark(std::size_t warmup_iterations,
-    std::size_t iterations, std::size_t size, Policy&& policy)
+    std::size_t iterations, std::size_t size, Policy&& policy,
+    Allocator const& alloc = Allocator())
 {
     // Allocate our data
-    using vector_type = std::vector<STREAM_TYPE>;
+    using vector_type = std::vector<STREAM_TYPE, Allocator>;
 
-    vector_type a(size);
-    vector_type b(size);
-    vector_type c(size);
+    vector_type a(size, alloc);
+    vector_type b(size, alloc);
+    vector_type c(size, alloc);
 
     // Initialize arrays
     hpx::fill(policy, a.begin(), a.end(), 1.0);
@@ -533,10 +536,21 @@ int hpx_main(hpx::program_options::variables_map& vm)
         timing = run_benchmark<>(
             warmup_iterations, iterations, vector_size, std::move(policy));
     }
+    else if (executor == 3)
+    {
+        // Parallel executor with NUMA aware allocator, every chunk of the
+        // arrays is processed by the core it was first touched by.
+        hpx::execution::experimental::numa_allocator<STREAM_TYPE> alloc;
+
+        auto policy = hpx::execution::par.on(alloc.executor())
+                          .with(alloc.parameters());
+        timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
+            std::move(policy), alloc);
+    }
     else
     {
         HPX_THROW_EXCEPTION(hpx::commandline_option_error, "hpx_main",
-            "Invalid executor id given (0-4 allowed");
+            "Invalid executor id given (0-3 allowed)");
     }
     time_total = mysecond() - time_total;
 
@@ -589,9 +603,9 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 "max,add_bytes,add_bw,add_avg,add_min,add_max,triad_bytes,"
                 "triad_bw,triad_avg,triad_min,triad_max\n");
         }
-        std::size_t const num_executors = 5;
-        const char* executors[num_executors] = {"parallel-serial", "block",
-            "parallel-parallel", "fork_join_executor", "scheduler_executor"};
+        std::size_t const num_executors = 4;
+        const char* executors[num_executors] = {"parallel-serial",
+            "fork_join_executor", "scheduler_executor", "parallel-numa"};
         hpx::util::format_to(std::cout, "{},{},{},", executors[executor],
             hpx::get_os_thread_count(), vector_size);
     }
@@ -667,7 +681,7 @@ int main(int argc, char* argv[])
             "size of vector (default: 1024)")
         (   "executor",
             hpx::program_options::value<std::size_t>()->default_value(2),
-            "executor to use (0-2) (default: 0, parallel_executor)")
+            "executor to use (0-3) (default: 0, parallel_executor)")
         ;
     // clang-format on
 